@@ -9,18 +9,27 @@
 
 #include <cameraserver/CameraServer.h>
 
+#include <auton/AutonPlanCache.h>
 #include <auton/CyclePrimitives.h>
+#include <auton/TrajectoryCache.h>
 #include <chassis/differential/ArcadeDrive.h>
 #include <chassis/ChassisFactory.h>
 #include <chassis/IChassis.h>
 #include <chassis/holonomic/HolonomicDrive.h>
 #include <chassis/mecanum/MecanumChassis.h>
+#include <hw/DragonLimelight.h>
+#include <hw/DragonPowerManager.h>
+#include <hw/factories/LimelightFactory.h>
 #include <mechanisms/StateMgrHelper.h>
+#include <mechanisms/controllers/RioControlLoop.h>
+#include <mechanisms/controllers/StateDataTuner.h>
 #include <RobotXmlParser.h>
 #include <TeleopControl.h>
 #include <utils/Logger.h>
+#include <utils/XmlConfigDocument.h>
 #include <utils/LoggerData.h>
 #include <utils/LoggerEnums.h>
+#include <vision/DragonVision.h>
 #include <LoggableItemMgr.h>
 
 using namespace std;
@@ -37,6 +46,10 @@ void Robot::RobotInit()
     auto XmlParser = new RobotXmlParser();
     XmlParser->ParseXML();
 
+    // subscribe to the cameras before the chassis starts reading their measurements
+    DragonVision::GetDragonVision()->Init();
+    m_dragonLimeLight = LimelightFactory::GetLimelightFactory()->GetLimelight();
+
     auto factory = ChassisFactory::GetChassisFactory();
     m_chassis = factory->GetIChassis();
     m_holonomic = nullptr;
@@ -50,7 +63,19 @@ void Robot::RobotInit()
     
     StateMgrHelper::InitStateMgrs();
 
+    // the states registered any roborio side controllers while they were created
+    RioControlLoop::GetRioControlLoop()->Start(units::time::millisecond_t(1.0));
+
     m_cyclePrims = new CyclePrimitives();
+
+    // auton plans are parsed once here and re-parsed during DisabledPeriodic only if they are redeployed
+    AutonPlanCache::GetAutonPlanCache()->LoadAllPlans();
+
+    // paths get loaded during DisabledPeriodic, so they are ready before autonomous starts
+    TrajectoryCache::GetTrajectoryCache()->FindAutonPaths();
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("XmlConfigDocument"), string("files loaded"), XmlConfigDocument::GetNumLoads());
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("XmlConfigDocument"), string("KB loaded"), XmlConfigDocument::GetBytesLoaded() / 1024.0);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("XmlConfigDocument"), string("load time (ms)"), units::time::millisecond_t(XmlConfigDocument::GetLoadTime()).to<double>());
     Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("ArrivedAt"), string("RobotInit"), string("end"));
 
     m_startLogging = true;
@@ -66,6 +91,9 @@ void Robot::RobotInit()
  */
 void Robot::RobotPeriodic() 
 {
+    // the mode periodic has commanded the motors for this loop, so predict their draw for the next one
+    DragonPowerManager::GetPowerManager()->Periodic();
+    DragonVision::GetDragonVision()->Periodic();
     if (m_chassis != nullptr)
     {
         m_chassis->UpdateOdometry();
@@ -163,7 +191,9 @@ void Robot::DisabledInit()
 
 void Robot::DisabledPeriodic() 
 {
-
+    AutonPlanCache::GetAutonPlanCache()->CheckNextPlan();
+    TrajectoryCache::GetTrajectoryCache()->LoadNextPath();
+    StateDataTuner::GetStateDataTuner()->DisabledPeriodic();
 }
 
 void Robot::TestInit() 
@@ -48,6 +48,8 @@
 #include <mechanisms/base/MechanismXmlParser.h>
 #include <RobotXmlParser.h>
 #include <utils/Logger.h>
+#include <utils/XmlConfigDocument.h>
+#include <utils/XmlName.h>
 
 // Third Party Includes
 #include <pugixml/pugixml.hpp>
@@ -71,8 +73,9 @@ void RobotXmlParser::ParseXML()
     try
     {
        // load the xml file into memory (parse it)
-        xml_document doc;
-        xml_parse_result result = doc.load_file(filename.c_str());
+        XmlConfigDocument config;
+        xml_parse_result result = config.Load(filename);
+        auto& doc = config.GetDocument();
 
         // if it is good
         if (result)
@@ -93,43 +96,47 @@ void RobotXmlParser::ParseXML()
                 // loop through the direct children of <robot> and call the appropriate parser
                 for (xml_node child = node.first_child(); child; child = child.next_sibling())
                 {
-                    if (strcmp(child.name(), "chassis") == 0)
+                    switch ( XmlName::Hash( child.name() ) )
                     {
-                        chassisXML.get()->ParseXML(child);
-                    }
-                    else if (strcmp(child.name(), "mechanism") == 0)
-                    {
-                        mechanismXML.get()->ParseXML(child);
-                    }
-                    else if (strcmp(child.name(), "roborio") == 0)
-                    {
-                        roborioXML.get()->ParseXML(child);
-                    }
-                    else if (strcmp(child.name(), "camera") == 0)
-                    {
-                        cameraXML.get()->ParseXML(child);
-                    }
-                    else if (strcmp(child.name(), "pdp") == 0)
-                    {
-                        pdpXML.get()->ParseXML(child);
-                    }
-                    else if ( strcmp(child.name(), "pigeon") == 0 )
-                    {
-                        pigeonXML.get()->ParseXML( child);
-                    }
-                    else if ( strcmp(child.name(), "limelight") == 0 )
-                    {
-                        limelightXML.get()->ParseXML( child);
-                    }
-                    else if ( strcmp(child.name(), "led") == 0 )
-                    {
-                        ledXML.get()->ParseXML(child);
-                    }
-                    else
-                    {
-                        string msg = "unknown child ";
-                        msg += child.name();
-                        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("RobotXmlParser"), string("ParseXML"), msg );
+                        case XmlName::Hash( "chassis" ):
+                            chassisXML.get()->ParseXML(child);
+                            break;
+
+                        case XmlName::Hash( "mechanism" ):
+                            mechanismXML.get()->ParseXML(child);
+                            break;
+
+                        case XmlName::Hash( "roborio" ):
+                            roborioXML.get()->ParseXML(child);
+                            break;
+
+                        case XmlName::Hash( "camera" ):
+                            cameraXML.get()->ParseXML(child);
+                            break;
+
+                        case XmlName::Hash( "pdp" ):
+                            pdpXML.get()->ParseXML(child);
+                            break;
+
+                        case XmlName::Hash( "pigeon" ):
+                            pigeonXML.get()->ParseXML( child);
+                            break;
+
+                        case XmlName::Hash( "limelight" ):
+                            limelightXML.get()->ParseXML( child);
+                            break;
+
+                        case XmlName::Hash( "led" ):
+                            ledXML.get()->ParseXML(child);
+                            break;
+
+                        default:
+                        {
+                            string msg = "unknown child ";
+                            msg += child.name();
+                            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("RobotXmlParser"), string("ParseXML"), msg );
+                            break;
+                        }
                     }
                 }
             }
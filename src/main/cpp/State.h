@@ -19,6 +19,8 @@
 
 #include <LoggableItem.h>
 
+class MechanismTargetData;
+
 ///	 @interface     State
 ///  @brief      	Interface for state classes
 class State : public LoggableItem
@@ -36,6 +38,9 @@ class State : public LoggableItem
         virtual void Run() = 0;
         virtual void Exit() = 0;
         virtual bool AtTarget() const = 0;
+
+        /// @brief  pick up new targets after the state data was tuned (the targets are copied when the state is created)
+        virtual void UpdateTargets( const MechanismTargetData* targetData ) {}
         void LogInformation() const override;
         
         inline std::string GetStateName() const {return m_stateName;}
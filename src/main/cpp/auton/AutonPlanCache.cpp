@@ -0,0 +1,253 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#ifdef __linux
+#include <dirent.h>
+#endif
+
+// FRC includes
+#include <frc/Filesystem.h>
+#include <frc/Timer.h>
+
+// Team 302 includes
+#include <auton/AutonPlanCache.h>
+#include <auton/PrimitiveEnums.h>
+#include <auton/PrimitiveParams.h>
+#include <auton/PrimitiveParser.h>
+#include <auton/TrajectoryCache.h>
+#include <auton/WaypointPathGenerator.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+AutonPlanCache* AutonPlanCache::m_instance = nullptr;
+AutonPlanCache* AutonPlanCache::GetAutonPlanCache()
+{
+    if ( AutonPlanCache::m_instance == nullptr )
+    {
+        AutonPlanCache::m_instance = new AutonPlanCache();
+    }
+    return AutonPlanCache::m_instance;
+}
+
+AutonPlanCache::AutonPlanCache() : m_plans(),
+                                   m_fileNames(),
+                                   m_nextCheck(0),
+                                   m_loadTime(units::time::second_t(0.0))
+{
+}
+
+void AutonPlanCache::LoadAllPlans()
+{
+#ifdef __linux__
+    auto autonDir = frc::filesystem::GetDeployDirectory() + "/auton/";
+    DIR* directory = opendir(autonDir.c_str());
+    if (directory != nullptr)
+    {
+        for (auto file = readdir(directory); file != nullptr; file = readdir(directory))
+        {
+            auto filename = string(file->d_name);
+            if (filename.size() > 4 && filename.compare(filename.size()-4, 4, ".xml") == 0)
+            {
+                LoadPlan(filename);
+            }
+        }
+        closedir(directory);
+    }
+    else
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("AutonPlanCache"), string("LoadAllPlans"), string("can't open ") + autonDir);
+    }
+#endif
+    LogCacheStats();
+}
+
+void AutonPlanCache::CheckNextPlan()
+{
+    if (m_fileNames.empty())
+    {
+        return;
+    }
+
+    m_nextCheck = m_nextCheck < m_fileNames.size() ? m_nextCheck : 0;
+    auto fileName = m_fileNames[m_nextCheck];
+    m_nextCheck++;
+
+    error_code error;
+    auto modified = filesystem::last_write_time(frc::filesystem::GetDeployDirectory() + "/auton/" + fileName, error);
+    auto itr = m_plans.find(fileName);
+    if (!error && itr != m_plans.end() && modified != itr->second.modified)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("AutonPlanCache"), string("Reloading"), fileName);
+        LoadPlan(fileName);
+        LogCacheStats();
+
+        // queue any paths the new version of the plan added
+        TrajectoryCache::GetTrajectoryCache()->FindAutonPaths();
+    }
+}
+
+const vector<PrimitiveParams>* AutonPlanCache::GetPlan
+(
+    const string&   fileName
+)
+{
+    auto itr = m_plans.find(fileName);
+    if (itr == m_plans.end())
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("AutonPlanCache"), string("plan wasn't preloaded"), fileName);
+        auto& plan = LoadPlan(fileName);
+        return plan.isValid ? &plan.primitives : nullptr;
+    }
+    return itr->second.isValid ? &itr->second.primitives : nullptr;
+}
+
+AutonPlanCache::AutonPlan& AutonPlanCache::LoadPlan
+(
+    const string&   fileName
+)
+{
+    auto start = frc::Timer::GetFPGATimestamp();
+
+    auto itr = m_plans.find(fileName);
+    if (itr == m_plans.end())
+    {
+        itr = m_plans.emplace(fileName, AutonPlan{vector<PrimitiveParams>(), filesystem::file_time_type(), false}).first;
+        m_fileNames.emplace_back(fileName);
+    }
+    auto& plan = itr->second;
+    for (auto& primitive : plan.primitives)
+    {
+        if (primitive.GetGeneratedPathID() > -1)
+        {
+            WaypointPathGenerator::GetWaypointPathGenerator()->Release(primitive.GetGeneratedPathID());
+        }
+    }
+
+    // take the timestamp before parsing so a file written while it is being parsed gets parsed again
+    error_code error;
+    plan.modified = filesystem::last_write_time(frc::filesystem::GetDeployDirectory() + "/auton/" + fileName, error);
+
+    auto parsed = PrimitiveParser::ParseXML(fileName, plan.primitives);
+    plan.isValid = parsed && ValidatePlan(fileName, plan.primitives);
+    plan.primitives.shrink_to_fit();
+    if (!plan.isValid)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("AutonPlanCache"), string("invalid plan"), fileName);
+        plan.primitives.clear();
+    }
+
+    // waypoint paths that don't depend on where the robot is get generated in the background now, while disabled
+    for (auto& primitive : plan.primitives)
+    {
+        if (primitive.GetID() == DRIVE_PATH && primitive.HasWaypoints() && !primitive.GetWaypointPath().startFromRobot)
+        {
+            primitive.SetGeneratedPathID(WaypointPathGenerator::GetWaypointPathGenerator()->Generate(primitive.GetWaypointPath()));
+        }
+    }
+
+    m_loadTime += frc::Timer::GetFPGATimestamp() - start;
+    return plan;
+}
+
+bool AutonPlanCache::ValidatePlan
+(
+    const string&                   fileName,
+    const vector<PrimitiveParams>&  primitives
+) const
+{
+    auto isValid = !primitives.empty();
+    if (!isValid)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("AutonPlanCache"), string("no primitives"), fileName);
+    }
+
+    auto pathDir = frc::filesystem::GetDeployDirectory() + "/paths/";
+    auto plannerDir = frc::filesystem::GetDeployDirectory() + "/pathplanner/";
+    for (unsigned int inx=0; inx<primitives.size(); ++inx)
+    {
+        auto& primitive = primitives[inx];
+        auto slot = fileName + string(" primitive ") + to_string(inx+1);
+        if (primitive.GetID() <= UNKNOWN_PRIMITIVE || primitive.GetID() >= MAX_AUTON_PRIMITIVES)
+        {
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("AutonPlanCache"), string("missing id"), slot);
+            isValid = false;
+        }
+        if (primitive.GetTime() <= 0.0)
+        {
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("AutonPlanCache"), string("invalid time"), slot);
+            isValid = false;
+        }
+        if (primitive.GetID() == DRIVE_PATH && primitive.HasWaypoints())
+        {
+            auto& path = primitive.GetWaypointPath();
+            if (path.waypoints.size() < (path.startFromRobot ? 1U : 2U))
+            {
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("AutonPlanCache"), string("not enough waypoints"), slot);
+                isValid = false;
+            }
+        }
+        else if (primitive.GetID() == DRIVE_PATH)
+        {
+            error_code error;
+            auto dir = TrajectoryCache::IsPlannerPath(primitive.GetPathName()) ? plannerDir : pathDir;
+            if (primitive.GetPathName().empty() || !filesystem::exists(dir + primitive.GetPathName(), error))
+            {
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("AutonPlanCache"), string("missing path"), slot);
+                isValid = false;
+            }
+        }
+
+        // every primitive type drives the chassis, so a group can have one chassis primitive; the other members have to be DO_NOTHING (mechanism states only)
+        if (primitive.GetGroupID() > -1 && primitive.GetID() != DO_NOTHING)
+        {
+            for (unsigned int other=0; other<inx; ++other)
+            {
+                if (primitives[other].GetGroupID() == primitive.GetGroupID() && primitives[other].GetID() != DO_NOTHING)
+                {
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("AutonPlanCache"), string("more than one chassis primitive in group"), slot);
+                    isValid = false;
+                    break;
+                }
+            }
+        }
+    }
+    return isValid;
+}
+
+void AutonPlanCache::LogCacheStats() const
+{
+    auto numValid = 0;
+    auto numPrimitives = 0;
+    for (auto& [fileName, plan] : m_plans)
+    {
+        numValid += plan.isValid ? 1 : 0;
+        numPrimitives += static_cast<int>(plan.primitives.size());
+    }
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("AutonPlanCache"), string("Plans loaded"), static_cast<int>(m_plans.size()));
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("AutonPlanCache"), string("Invalid plans"), static_cast<int>(m_plans.size()) - numValid);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("AutonPlanCache"), string("Primitives"), numPrimitives);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("AutonPlanCache"), string("Load time (ms)"), units::time::millisecond_t(m_loadTime).to<double>());
+}
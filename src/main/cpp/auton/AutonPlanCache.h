@@ -0,0 +1,90 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <units/time.h>
+
+// Team 302 includes
+#include <auton/PrimitiveParams.h>
+
+// Third Party Includes
+
+/// @class AutonPlanCache
+/// @brief Parses and validates every auton XML file once at RobotInit so AutonomousInit only has to look up the
+///        selected plan.  While disabled, CheckNextPlan watches the file timestamps (one file per call) and re-parses
+///        any plan that was redeployed.  Plans are never modified while enabled, so a plan returned by GetPlan
+///        stays valid until the robot is disabled again.
+class AutonPlanCache
+{
+    public:
+        /// @brief Find or create the auton plan cache
+        static AutonPlanCache* GetAutonPlanCache();
+
+        /// @brief Parse and validate every auton XML file in the deploy auton directory
+        void LoadAllPlans();
+
+        /// @brief Re-parse the next plan if its file changed since it was parsed.  Call from DisabledPeriodic.
+        void CheckNextPlan();
+
+        /// @brief Look up a plan.  If it wasn't preloaded it is parsed now (and an error is logged).
+        /// @param [in] const std::string& fileName: auton file name in the deploy auton directory
+        /// @returns const std::vector<PrimitiveParams>* primitives in run order or nullptr if the plan is missing or invalid
+        const std::vector<PrimitiveParams>* GetPlan
+        (
+            const std::string&  fileName
+        );
+
+    private:
+        AutonPlanCache();
+        ~AutonPlanCache() = default;
+
+        struct AutonPlan
+        {
+            std::vector<PrimitiveParams>        primitives;
+            std::filesystem::file_time_type     modified;
+            bool                                isValid;
+        };
+
+        AutonPlan& LoadPlan
+        (
+            const std::string&  fileName
+        );
+
+        bool ValidatePlan
+        (
+            const std::string&                      fileName,
+            const std::vector<PrimitiveParams>&     primitives
+        ) const;
+
+        void LogCacheStats() const;
+
+        std::map<std::string, AutonPlan>    m_plans;
+        std::vector<std::string>            m_fileNames;
+        size_t                              m_nextCheck;
+        units::time::second_t               m_loadTime;
+
+        static AutonPlanCache*              m_instance;
+};
@@ -15,6 +15,7 @@
 //====================================================================================================================================================
 
 // C++ Includes
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -23,12 +24,11 @@
 #include <frc/Timer.h>
 
 // Team 302 includes
+#include <auton/AutonPlanCache.h>
 #include <auton/AutonSelector.h>
 #include <auton/CyclePrimitives.h>
 #include <auton/PrimitiveEnums.h>
-#include <auton/PrimitiveFactory.h>
 #include <auton/PrimitiveParams.h>
-#include <auton/PrimitiveParser.h>
 #include <auton/drivePrimitives/IPrimitive.h>
 #include <mechanisms/MechanismFactory.h>
 #include <utils/Logger.h>
@@ -39,6 +39,8 @@
 
 // Third Party Includes
 
+using std::all_of;
+using std::any_of;
 using frc::DriverStation;
 using frc::Timer;
 using std::make_unique;
@@ -48,43 +50,83 @@ using std::string;
 CyclePrimitives::CyclePrimitives() : State(string("CyclePrimitives"), 0),
 									 m_primParams(), 
 									 m_currentPrimSlot(0), 
-								     m_currentPrim(nullptr), 
-									 m_primFactory(
-									 PrimitiveFactory::GetInstance()), 
+									 m_group(),
+									 m_groupType(SEQUENTIAL),
+									 m_chassisMember(0),
+									 m_primitives(),
+									 m_driveStopParams(),
 									 m_DriveStop(nullptr), 
 									 m_autonSelector( new AutonSelector()) ,
 									 m_timer( make_unique<Timer>()),
-									 m_maxTime( 0.0 ),
+									 m_planStart( units::time::second_t(0.0) ),
 									 m_isDone( false )
 {
+	m_group.reserve(m_maxGroupSize);
 }
 
 void CyclePrimitives::Init()
 {
 	m_currentPrimSlot = 0; //Reset current prim
+	m_group.clear();
+	m_isDone = false;
 	m_primParams.clear();
+	m_primitives.ReleaseAll();
+	m_DriveStop = nullptr;
+	m_planStart = Timer::GetFPGATimestamp();
 
-	m_primParams = PrimitiveParser::ParseXML( m_autonSelector->GetSelectedAutoFile() );
+	// the plans were parsed and validated at RobotInit; copy the selected one since primitives can update their params
+	auto plan = AutonPlanCache::GetAutonPlanCache()->GetPlan( m_autonSelector->GetSelectedAutoFile() );
+	if (plan != nullptr)
+	{
+		m_primParams.assign(plan->begin(), plan->end());
+	}
 	if (!m_primParams.empty())
 	{
 		GetNextPrim();
+
+		// start the first primitive this cycle instead of waiting for the first periodic call
+		Run();
 	}
 }
 
 void CyclePrimitives::Run()
 {
-	if (m_currentPrim != nullptr)
+	if (!m_group.empty())
 	{
-		m_currentPrim->Run();
+		for (auto& member : m_group)
+		{
+			if (!member.isDone)
+			{
+				if (member.primitive != nullptr)
+				{
+					member.primitive->Run();
+					member.isDone = member.primitive->IsDone();
+				}
+				else
+				{
+					member.isDone = m_timer->HasElapsed(units::time::second_t(member.params->GetTime()));
+				}
+			}
+		}
 		StateMgrHelper::RunCurrentMechanismStates();
 
-		if (m_currentPrim->IsDone())
+		if (IsGroupDone())
 		{
 			GetNextPrim();
 		}
+		else if (m_group[m_chassisMember].isDone)
+		{
+			// the chassis primitive finished but the group is still waiting on mechanisms, so hold the chassis still
+			RunDriveStop();
+		}
 	}
 	else
 	{
+		if (!m_isDone)
+		{
+			Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("CyclePrimitives"), string("Plan time (s)"), (Timer::GetFPGATimestamp() - m_planStart).to<double>());
+			Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("CyclePrimitives"), string("Primitive instances"), m_primitives.GetNumCreated());
+		}
 		m_isDone = true;
 		m_primParams.clear();	// clear the primitive params vector
 		m_currentPrimSlot = 0;  //Reset current prim slot
@@ -104,22 +146,65 @@ bool CyclePrimitives::AtTarget() const
 
 void CyclePrimitives::GetNextPrim()
 {
-	PrimitiveParams* currentPrimParam = (m_currentPrimSlot < (int) m_primParams.size()) ? m_primParams[m_currentPrimSlot] : nullptr;
-
-	m_currentPrim = (currentPrimParam != nullptr) ? m_primFactory->GetIPrimitive(currentPrimParam) : nullptr;
-	if (m_currentPrim != nullptr)
+	// the previous group is finished, so its primitives can be handed out again
+	m_group.clear();
+	m_primitives.ReleaseAll();
+	m_DriveStop = nullptr;
+	if (m_currentPrimSlot >= (int) m_primParams.size())
 	{
-		m_currentPrim->Init(currentPrimParam);
+		return;
+	}
 
-		// @ADDMECH Get your stateMgr, set its current state to match the current primitive parameter and run it
+	// a primitive that isn't in a group is a group of one
+	m_groupType = m_primParams[m_currentPrimSlot].GetGroup();
+	auto groupID = m_primParams[m_currentPrimSlot].GetGroupID();
+	do
+	{
+		m_group.emplace_back(GroupMember{&m_primParams[m_currentPrimSlot], nullptr, false});
+		m_currentPrimSlot++;
+	} while (groupID > -1 && m_currentPrimSlot < (int) m_primParams.size() && m_primParams[m_currentPrimSlot].GetGroupID() == groupID);
+
+	// only one member drives the chassis (the plan validation makes sure there is at most one that isn't DO_NOTHING);
+	// the others only set mechanism states and are done when their time runs out
+	m_chassisMember = 0;
+	for (unsigned int inx=0; inx<m_group.size(); ++inx)
+	{
+		if (m_group[inx].params->GetID() != DO_NOTHING)
+		{
+			m_chassisMember = inx;
+			break;
+		}
+	}
 
+	for (auto& member : m_group)
+	{
+		StateMgrHelper::SetMechanismStateFromParam(member.params);
+	}
 
-		m_maxTime = currentPrimParam->GetTime();
-		m_timer->Reset();
-		m_timer->Start();
+	auto& chassisMember = m_group[m_chassisMember];
+	chassisMember.primitive = m_primitives.Acquire(chassisMember.params->GetID());
+	if (chassisMember.primitive != nullptr)
+	{
+		chassisMember.primitive->Init(chassisMember.params);
 	}
 
-	m_currentPrimSlot++;
+	m_timer->Reset();
+	m_timer->Start();
+}
+
+bool CyclePrimitives::IsGroupDone() const
+{
+	switch (m_groupType)
+	{
+		case RACE:
+			return any_of(m_group.begin(), m_group.end(), [](const GroupMember& member) { return member.isDone; });
+
+		case DEADLINE:
+			return m_group.front().isDone;
+
+		default:
+			return all_of(m_group.begin(), m_group.end(), [](const GroupMember& member) { return member.isDone; });
+	}
 }
 
 void CyclePrimitives::RunDriveStop()
@@ -128,7 +213,7 @@ void CyclePrimitives::RunDriveStop()
 	{	
 		auto time = DriverStation::GetMatchType() != DriverStation::MatchType::kNone ? 
 							 DriverStation::GetMatchTime() : 15.0;
-		auto params = new PrimitiveParams( DO_NOTHING,          // identifier
+		m_driveStopParams.emplace( DO_NOTHING,          // identifier
 		                                   time,              	// time
 		                                   0.0,                 // distance
 		                                   0.0,                 // target x location
@@ -140,8 +225,8 @@ void CyclePrimitives::RunDriveStop()
 										   string()
 										  // @ADDMECH mechanism state
 										 );             
-		m_DriveStop = m_primFactory->GetIPrimitive(params);
-		m_DriveStop->Init(params);
+		m_DriveStop = m_primitives.Acquire(DO_NOTHING);
+		m_DriveStop->Init(&m_driveStopParams.value());
 	}
 	m_DriveStop->Run();
 }
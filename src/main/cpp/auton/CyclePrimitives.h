@@ -18,20 +18,23 @@
 
 // C++ Includes
 #include <memory>
+#include <optional>
 #include <vector>
 
 // FRC includes
 #include <frc/Timer.h>
+#include <units/time.h>
 
 // Team 302 includes
+#include <auton/PrimitiveEnums.h>
+#include <auton/PrimitiveParams.h>
+#include <auton/PrimitivePool.h>
 #include <State.h>
 
 // Third Party Includes
 
 class AutonSelector;
 class IPrimitive;
-class PrimitiveFactory;
-class PrimitiveParams;
 
 class LeftIntakeStateMgr;
 class RightIntakeStateMgr;
@@ -57,14 +60,28 @@ class CyclePrimitives : public State
 		void RunDriveStop();
 
 	private:
-		std::vector<PrimitiveParams*> 	m_primParams;
+		bool IsGroupDone() const;
+
+		struct GroupMember
+		{
+			PrimitiveParams*			params;
+			IPrimitive*					primitive;		// nullptr for the members that only set mechanism states
+			bool						isDone;
+		};
+		static constexpr int			m_maxGroupSize = 8;
+
+		// everything a plan uses lives in these members and is reset together when the next plan starts
+		std::vector<PrimitiveParams> 	m_primParams;
 		int 							m_currentPrimSlot;
-		IPrimitive*						m_currentPrim;
-		PrimitiveFactory* 				m_primFactory;
+		std::vector<GroupMember>		m_group;		// primitives that are running this cycle
+		PRIMITIVE_GROUP					m_groupType;
+		unsigned int					m_chassisMember;
+		PrimitivePool					m_primitives;
+		std::optional<PrimitiveParams>	m_driveStopParams;
 		IPrimitive* 					m_DriveStop;
 		AutonSelector* 					m_autonSelector;
 		std::unique_ptr<frc::Timer>     m_timer;
-		double                          m_maxTime;
+		units::time::second_t			m_planStart;
 		bool							m_isDone;
 };
 
@@ -0,0 +1,155 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <cmath>
+
+// FRC includes
+#include <units/math.h>
+
+// Team 302 includes
+#include <auton/PathCompletion.h>
+
+PathCompletion::PathCompletion() : m_goal(),
+                                   m_totalTime(units::time::second_t(0.0)),
+                                   m_maxTime(units::time::second_t(0.0)),
+                                   m_travelCos(1.0),
+                                   m_travelSin(0.0),
+                                   m_crossTrackError(units::length::meter_t(0.0)),
+                                   m_alongTrackError(units::length::meter_t(0.0)),
+                                   m_inGoalBand(false),
+                                   m_goalChecks(0),
+                                   m_history(),
+                                   m_historyIndex(0),
+                                   m_historyCount(0)
+{
+}
+
+void PathCompletion::Start
+(
+    const frc::Pose2d&          goal,
+    units::time::second_t       totalTime,
+    units::time::second_t       maxTime
+)
+{
+    m_goal = goal;
+    m_totalTime = totalTime;
+    m_maxTime = maxTime;
+    m_travelCos = goal.Rotation().Cos();
+    m_travelSin = goal.Rotation().Sin();
+    m_crossTrackError = units::length::meter_t(0.0);
+    m_alongTrackError = units::length::meter_t(0.0);
+    m_inGoalBand = false;
+    m_goalChecks = 0;
+    m_historyIndex = 0;
+    m_historyCount = 0;
+}
+
+PathCompletion::COMPLETION_REASON PathCompletion::Update
+(
+    units::time::second_t           time,
+    const frc::Pose2d&              pose,
+    const frc::Trajectory::State&   desired
+)
+{
+    // tracking error in the desired state's frame; reversed paths face backwards and have a negative velocity
+    auto direction = desired.velocity.to<double>() < 0.0 ? -1.0 : 1.0;
+    auto pathCos = direction * desired.pose.Rotation().Cos();
+    auto pathSin = direction * desired.pose.Rotation().Sin();
+    auto dx = (pose.X() - desired.pose.X()).to<double>();
+    auto dy = (pose.Y() - desired.pose.Y()).to<double>();
+    m_alongTrackError = units::length::meter_t(dx*pathCos + dy*pathSin);
+    m_crossTrackError = units::length::meter_t(dy*pathCos - dx*pathSin);
+
+    // the last state stops, so remember which way the path was going before that
+    if (std::abs(desired.velocity.to<double>()) > 0.001)
+    {
+        m_travelCos = pathCos;
+        m_travelSin = pathSin;
+    }
+
+    m_history[m_historyIndex] = pose.Translation();
+    auto oldest = (m_historyIndex + 1) % m_historySize;
+    m_historyIndex = oldest;
+    m_historyCount = m_historyCount < m_historySize ? m_historyCount + 1 : m_historySize;
+
+    if (m_maxTime.to<double>() > 0.0 && time > m_maxTime)
+    {
+        return TIMED_OUT;
+    }
+    if (time < m_totalTime)
+    {
+        return NOT_DONE;
+    }
+
+    // error to the goal along and across the final direction of travel
+    auto gx = (pose.X() - m_goal.X()).to<double>();
+    auto gy = (pose.Y() - m_goal.Y()).to<double>();
+    auto goalDistance = units::length::meter_t(std::hypot(gx, gy));
+    auto goalAlong = units::length::meter_t(gx*m_travelCos + gy*m_travelSin);
+    auto goalCross = units::length::meter_t(gy*m_travelCos - gx*m_travelSin);
+
+    m_inGoalBand = m_inGoalBand ? goalDistance < m_goalExitTolerance : goalDistance < m_goalTolerance;
+    m_goalChecks = m_inGoalBand ? m_goalChecks + 1 : 0;
+    if (m_goalChecks >= m_settleChecks)
+    {
+        return AT_GOAL;
+    }
+
+    if (goalAlong > m_passedTolerance && units::math::abs(goalCross) < m_passedCrossTrack)
+    {
+        return PASSED_GOAL;
+    }
+
+    if (m_historyCount == m_historySize && (pose.Translation() - m_history[oldest]).Norm() < m_stallDistance)
+    {
+        return STALLED;
+    }
+
+    if (time > m_totalTime + m_maxSettleTime)
+    {
+        return SETTLE_TIMEOUT;
+    }
+    return NOT_DONE;
+}
+
+const char* PathCompletion::GetReasonName
+(
+    COMPLETION_REASON   reason
+)
+{
+    switch (reason)
+    {
+        case AT_GOAL:
+            return "At goal";
+
+        case PASSED_GOAL:
+            return "Passed goal";
+
+        case STALLED:
+            return "Stopped moving";
+
+        case TIMED_OUT:
+            return "Timed out";
+
+        case SETTLE_TIMEOUT:
+            return "Did not settle at goal";
+
+        default:
+            return "Not done";
+    }
+}
@@ -0,0 +1,113 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <array>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Translation2d.h>
+#include <frc/trajectory/Trajectory.h>
+#include <units/length.h>
+#include <units/time.h>
+
+/// @class PathCompletion
+/// @brief Decides when a followed path is finished.  It uses the trajectory time, the tracking error and a short
+///        history of robot positions, not per cycle pose comparisons:
+///         - nothing finishes before the trajectory time has run out (except the time out from the xml)
+///         - AT_GOAL once the robot has been inside the goal tolerance for a few checks; it has to leave a larger
+///           tolerance before the count starts over (hysteresis), so odometry noise at the edge doesn't reset it
+///         - PASSED_GOAL once the robot is past the goal along the final direction of travel and close to the path
+///         - STALLED once the robot has barely moved over the position history window
+///         - SETTLE_TIMEOUT if none of those happen shortly after the trajectory time
+///        Every check is a few multiplies on values already in hand; nothing is formatted or allocated.
+class PathCompletion
+{
+    public:
+        enum COMPLETION_REASON
+        {
+            NOT_DONE,
+            AT_GOAL,
+            PASSED_GOAL,
+            STALLED,
+            TIMED_OUT,
+            SETTLE_TIMEOUT
+        };
+
+        PathCompletion();
+        ~PathCompletion() = default;
+
+        /// @brief Start checking a new path
+        /// @param [in] const frc::Pose2d&      goal:       final pose of the path
+        /// @param [in] units::second_t         totalTime:  trajectory time
+        /// @param [in] units::second_t         maxTime:    time out from the xml (0 or less for none)
+        void Start
+        (
+            const frc::Pose2d&          goal,
+            units::time::second_t       totalTime,
+            units::time::second_t       maxTime
+        );
+
+        /// @brief Update the errors and check whether the path is finished
+        /// @param [in] units::second_t                 time:       time since the path started
+        /// @param [in] const frc::Pose2d&              pose:       current robot pose
+        /// @param [in] const frc::Trajectory::State&   desired:    state the robot is following this cycle
+        /// @returns COMPLETION_REASON NOT_DONE or the reason the path is finished
+        COMPLETION_REASON Update
+        (
+            units::time::second_t           time,
+            const frc::Pose2d&              pose,
+            const frc::Trajectory::State&   desired
+        );
+
+        /// @brief error to the left (+) or right (-) of the desired state's direction of travel
+        units::length::meter_t GetCrossTrackError() const { return m_crossTrackError; }
+
+        /// @brief error ahead (+) or behind (-) the desired state along its direction of travel
+        units::length::meter_t GetAlongTrackError() const { return m_alongTrackError; }
+
+        /// @brief name of a reason for logging
+        static const char* GetReasonName
+        (
+            COMPLETION_REASON   reason
+        );
+
+    private:
+        static constexpr int                    m_historySize = 25;     // 0.5 seconds of 20 ms cycles
+        static constexpr int                    m_settleChecks = 3;
+        const units::length::meter_t            m_goalTolerance = units::length::meter_t(0.05);
+        const units::length::meter_t            m_goalExitTolerance = units::length::meter_t(0.08);
+        const units::length::meter_t            m_passedTolerance = units::length::meter_t(0.02);
+        const units::length::meter_t            m_passedCrossTrack = units::length::meter_t(0.15);
+        const units::length::meter_t            m_stallDistance = units::length::meter_t(0.01);
+        const units::time::second_t             m_maxSettleTime = units::time::second_t(1.0);
+
+        frc::Pose2d                             m_goal;
+        units::time::second_t                   m_totalTime;
+        units::time::second_t                   m_maxTime;
+        double                                  m_travelCos;            // direction of travel of the last moving desired state
+        double                                  m_travelSin;
+        units::length::meter_t                  m_crossTrackError;
+        units::length::meter_t                  m_alongTrackError;
+        bool                                    m_inGoalBand;
+        int                                     m_goalChecks;
+        std::array<frc::Translation2d, m_historySize> m_history;
+        int                                     m_historyIndex;
+        int                                     m_historyCount;
+};
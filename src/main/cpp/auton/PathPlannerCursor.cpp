@@ -0,0 +1,246 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <units/angle.h>
+#include <units/curvature.h>
+
+// Team 302 includes
+#include <auton/PathPlannerCursor.h>
+#include <auton/PathPlannerPath.h>
+
+using namespace std;
+
+PathPlannerCursor::PathPlannerCursor() : m_path(nullptr),
+                                         m_maxAcceleration(0.0),
+                                         m_profiles(),
+                                         m_totalTime(units::time::second_t(0.0)),
+                                         m_section(0),
+                                         m_segment(0),
+                                         m_segmentStart(0.0),
+                                         m_tableSegment(-1),
+                                         m_arcTable(),
+                                         m_lastT(0.0),
+                                         m_nextMarker(0),
+                                         m_sample(),
+                                         m_holonomicRotation()
+{
+}
+
+void PathPlannerCursor::SetPath
+(
+    const PathPlannerPath*                              path,
+    units::velocity::meters_per_second_t                maxVelocity,
+    units::acceleration::meters_per_second_squared_t    maxAcceleration
+)
+{
+    m_path = path;
+    m_maxAcceleration = maxAcceleration.to<double>();
+    m_profiles.clear();
+    m_section = 0;
+    m_segment = 0;
+    m_segmentStart = 0.0;
+    m_tableSegment = -1;
+    m_lastT = 0.0;
+    m_nextMarker = 0;
+
+    // trapezoid (or triangle if it is too short to reach cruise velocity) for each section
+    auto startTime = 0.0;
+    if (m_path != nullptr && m_maxAcceleration > 0.0 && maxVelocity.to<double>() > 0.0)
+    {
+        for (auto& section : m_path->GetSections())
+        {
+            SectionProfile profile;
+            profile.startTime = startTime;
+            profile.peakVelocity = maxVelocity.to<double>();
+            profile.accelTime = profile.peakVelocity / m_maxAcceleration;
+            auto accelDistance = 0.5 * m_maxAcceleration * profile.accelTime * profile.accelTime;
+            if (2.0 * accelDistance >= section.length)
+            {
+                profile.accelTime = sqrt(section.length / m_maxAcceleration);
+                profile.peakVelocity = m_maxAcceleration * profile.accelTime;
+                profile.cruiseTime = 0.0;
+            }
+            else
+            {
+                profile.cruiseTime = (section.length - 2.0 * accelDistance) / profile.peakVelocity;
+            }
+            m_profiles.emplace_back(profile);
+            startTime += 2.0 * profile.accelTime + profile.cruiseTime;
+        }
+    }
+    m_totalTime = units::time::second_t(startTime);
+}
+
+bool PathPlannerCursor::IsValid() const
+{
+    return m_path != nullptr && !m_profiles.empty() && !m_path->GetSegments().empty();
+}
+
+const frc::Trajectory::State& PathPlannerCursor::Sample
+(
+    units::time::second_t   t
+)
+{
+    if (!IsValid())
+    {
+        return m_sample;
+    }
+
+    auto time = clamp(t.to<double>(), 0.0, m_totalTime.to<double>());
+
+    // find the section, rewinding if time went backwards
+    if (time < m_profiles[m_section].startTime)
+    {
+        m_section = 0;
+    }
+    while (m_section+1 < static_cast<int>(m_profiles.size()) && time >= m_profiles[m_section+1].startTime)
+    {
+        m_section++;
+    }
+    auto& profile = m_profiles[m_section];
+    auto& section = m_path->GetSections()[m_section];
+
+    // distance, velocity and acceleration along the section
+    auto tau = time - profile.startTime;
+    auto accelDistance = 0.5 * m_maxAcceleration * profile.accelTime * profile.accelTime;
+    double distance, velocity, acceleration;
+    if (tau < profile.accelTime)
+    {
+        distance = 0.5 * m_maxAcceleration * tau * tau;
+        velocity = m_maxAcceleration * tau;
+        acceleration = m_maxAcceleration;
+    }
+    else if (tau < profile.accelTime + profile.cruiseTime)
+    {
+        distance = accelDistance + profile.peakVelocity * (tau - profile.accelTime);
+        velocity = profile.peakVelocity;
+        acceleration = 0.0;
+    }
+    else
+    {
+        auto decelTime = min(tau - profile.accelTime - profile.cruiseTime, profile.accelTime);
+        distance = accelDistance + profile.peakVelocity * (profile.cruiseTime + decelTime) - 0.5 * m_maxAcceleration * decelTime * decelTime;
+        velocity = profile.peakVelocity - m_maxAcceleration * decelTime;
+        acceleration = decelTime < profile.accelTime ? -m_maxAcceleration : 0.0;
+    }
+
+    // find the segment, rewinding to the start of the section if needed
+    auto& segments = m_path->GetSegments();
+    if (m_segment < section.firstSegment || m_segment > section.lastSegment || distance < m_segmentStart)
+    {
+        m_segment = section.firstSegment;
+        m_segmentStart = 0.0;
+    }
+    while (m_segment < section.lastSegment && distance > m_segmentStart + segments[m_segment].length)
+    {
+        m_segmentStart += segments[m_segment].length;
+        m_segment++;
+    }
+    auto& segment = segments[m_segment];
+    if (m_tableSegment != m_segment)
+    {
+        BuildArcTable();
+    }
+
+    // convert the distance into the segment to the bezier parameter
+    auto local = clamp(distance - m_segmentStart, 0.0, m_arcTable.back());
+    auto entry = static_cast<int>(upper_bound(m_arcTable.begin(), m_arcTable.end(), local) - m_arcTable.begin()) - 1;
+    entry = clamp(entry, 0, m_tableSize-1);
+    auto span = m_arcTable[entry+1] - m_arcTable[entry];
+    auto fraction = span > 0.0 ? (local - m_arcTable[entry]) / span : 0.0;
+    auto bezierT = (entry + fraction) / m_tableSize;
+    m_lastT = bezierT;
+
+    auto point = PathPlannerPath::Point(segment, bezierT);
+    auto d1 = PathPlannerPath::Derivative(segment, bezierT);
+    auto d2 = PathPlannerPath::SecondDerivative(segment, bezierT);
+    auto dx = d1.X().to<double>();
+    auto dy = d1.Y().to<double>();
+    auto speed = hypot(dx, dy);
+    auto curvature = speed > 1e-9 ? (dx * d2.Y().to<double>() - dy * d2.X().to<double>()) / (speed * speed * speed) : 0.0;
+    frc::Rotation2d heading(dx, dy);
+
+    // reversed sections are driven backwards (only matters for differential drives)
+    if (section.reversed)
+    {
+        heading = heading + frc::Rotation2d(units::angle::degree_t(180.0));
+        velocity = -velocity;
+        acceleration = -acceleration;
+        curvature = -curvature;
+    }
+
+    m_sample.t = units::time::second_t(time);
+    m_sample.pose = frc::Pose2d(point, heading);
+    m_sample.velocity = units::velocity::meters_per_second_t(velocity);
+    m_sample.acceleration = units::acceleration::meters_per_second_squared_t(acceleration);
+    m_sample.curvature = units::curvature_t(curvature);
+
+    frc::Rotation2d startAngle(segment.startHolonomicAngle);
+    auto delta = (frc::Rotation2d(segment.endHolonomicAngle) - startAngle).Degrees();
+    m_holonomicRotation = startAngle + frc::Rotation2d(delta * bezierT);
+
+    // rewinding makes the markers fire again
+    if (m_nextMarker > 0)
+    {
+        auto& last = m_path->GetMarkers()[m_nextMarker-1];
+        if (last.segment > m_segment || (last.segment == m_segment && last.t > m_lastT))
+        {
+            m_nextMarker = 0;
+        }
+    }
+    return m_sample;
+}
+
+const vector<string>* PathPlannerCursor::GetNextMarker()
+{
+    if (!IsValid() || m_nextMarker >= m_path->GetMarkers().size())
+    {
+        return nullptr;
+    }
+
+    auto& marker = m_path->GetMarkers()[m_nextMarker];
+    auto isDone = m_sample.t >= m_totalTime;
+    if (isDone || marker.segment < m_segment || (marker.segment == m_segment && marker.t <= m_lastT))
+    {
+        m_nextMarker++;
+        return &marker.names;
+    }
+    return nullptr;
+}
+
+void PathPlannerCursor::BuildArcTable()
+{
+    auto& segment = m_path->GetSegments()[m_segment];
+    m_arcTable[0] = 0.0;
+    auto previous = segment.p0;
+    for (int inx=1; inx<=m_tableSize; ++inx)
+    {
+        auto point = PathPlannerPath::Point(segment, static_cast<double>(inx) / m_tableSize);
+        m_arcTable[inx] = m_arcTable[inx-1] + point.Distance(previous).to<double>();
+        previous = point;
+    }
+    m_tableSegment = m_segment;
+}
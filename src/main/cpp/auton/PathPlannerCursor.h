@@ -0,0 +1,108 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Rotation2d.h>
+#include <frc/trajectory/Trajectory.h>
+#include <units/acceleration.h>
+#include <units/time.h>
+#include <units/velocity.h>
+
+// Team 302 includes
+#include <auton/PathPlannerPath.h>
+
+/// @class PathPlannerCursor
+/// @brief Samples a PathPlannerPath lazily.  The motion profile is a trapezoid over the arc length of each section
+///        (the robot stops at reversals), so only a few numbers per section are computed when the path is set.  The
+///        bezier segment under the robot is evaluated when it is sampled, with an arc length table for that one
+///        segment that is rebuilt when the cursor moves onto the next segment.  Like TrajectoryCursor, sampling
+///        at increasing times only steps forward.
+class PathPlannerCursor
+{
+    public:
+        PathPlannerCursor();
+        ~PathPlannerCursor() = default;
+
+        /// @brief Point the cursor at a path and rewind it to the start
+        /// @param [in] const PathPlannerPath* path: path to sample (must outlive its use by the cursor); nullptr to clear
+        /// @param [in] units::meters_per_second_t maxVelocity: cruise velocity
+        /// @param [in] units::meters_per_second_squared_t maxAcceleration: acceleration and deceleration
+        void SetPath
+        (
+            const PathPlannerPath*                              path,
+            units::velocity::meters_per_second_t                maxVelocity,
+            units::acceleration::meters_per_second_squared_t    maxAcceleration
+        );
+
+        /// @brief true if there is a path with at least one segment
+        bool IsValid() const;
+
+        /// @brief time it takes to drive the whole path
+        units::time::second_t GetTotalTime() const { return m_totalTime; }
+
+        /// @brief Get the state at a time; the pose rotation is the direction of travel like a pathweaver trajectory
+        /// @param [in] units::second_t t: time since the start of the path
+        /// @returns const frc::Trajectory::State& sampled state (valid until the next call)
+        const frc::Trajectory::State& Sample
+        (
+            units::time::second_t   t
+        );
+
+        /// @brief holonomic angle at the last sample
+        frc::Rotation2d GetHolonomicRotation() const { return m_holonomicRotation; }
+
+        /// @brief Event markers the last sample went past that haven't been returned yet, one per call
+        /// @returns const std::vector<std::string>* marker names or nullptr if there are no more
+        const std::vector<std::string>* GetNextMarker();
+
+    private:
+        struct SectionProfile
+        {
+            double  startTime;      ///< seconds from the start of the path
+            double  accelTime;      ///< seconds spent accelerating (and decelerating)
+            double  cruiseTime;     ///< seconds at peak velocity
+            double  peakVelocity;   ///< meters per second
+        };
+
+        void BuildArcTable();
+
+        static constexpr int                m_tableSize = 16;
+
+        const PathPlannerPath*              m_path;
+        double                              m_maxAcceleration;
+        std::vector<SectionProfile>         m_profiles;
+        units::time::second_t               m_totalTime;
+
+        int                                 m_section;
+        int                                 m_segment;
+        double                              m_segmentStart;     // distance into the section where m_segment starts
+        int                                 m_tableSegment;     // segment m_arcTable was built for
+        std::array<double, m_tableSize+1>   m_arcTable;         // distance along m_tableSegment at each table parameter
+        double                              m_lastT;            // bezier parameter of the last sample
+        size_t                              m_nextMarker;
+
+        frc::Trajectory::State              m_sample;
+        frc::Rotation2d                     m_holonomicRotation;
+};
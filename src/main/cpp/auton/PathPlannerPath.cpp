@@ -0,0 +1,184 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/geometry/Translation2d.h>
+#include <units/length.h>
+#include <wpi/json.h>
+
+// Team 302 includes
+#include <auton/PathPlannerPath.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+using frc::Translation2d;
+
+PathPlannerPath::PathPlannerPath() : m_segments(),
+                                     m_sections(),
+                                     m_markers(),
+                                     m_maxVelocity(units::velocity::meters_per_second_t(0.0)),
+                                     m_maxAcceleration(units::acceleration::meters_per_second_squared_t(0.0))
+{
+}
+
+bool PathPlannerPath::Load
+(
+    const string&   fileName
+)
+{
+    m_segments.clear();
+    m_sections.clear();
+    m_markers.clear();
+
+    try
+    {
+        ifstream file(fileName);
+        auto json = wpi::json::parse(file);
+
+        auto toTranslation = [](const wpi::json& point, const Translation2d& fallback)
+        {
+            return point.is_object() ? Translation2d(units::length::meter_t(point.at("x").get<double>()), units::length::meter_t(point.at("y").get<double>())) : fallback;
+        };
+
+        auto& waypoints = json.at("waypoints");
+        auto reversed = false;
+        for (size_t inx=1; inx<waypoints.size(); ++inx)
+        {
+            auto& start = waypoints[inx-1];
+            auto& end = waypoints[inx];
+            auto p0 = toTranslation(start.at("anchorPoint"), Translation2d());
+            auto p3 = toTranslation(end.at("anchorPoint"), Translation2d());
+
+            Segment segment;
+            segment.p0 = p0;
+            segment.p1 = toTranslation(start.value("nextControl", wpi::json()), p0);
+            segment.p2 = toTranslation(end.value("prevControl", wpi::json()), p3);
+            segment.p3 = p3;
+            segment.startHolonomicAngle = units::angle::degree_t(start.value("holonomicAngle", 0.0));
+            segment.endHolonomicAngle = units::angle::degree_t(end.value("holonomicAngle", 0.0));
+
+            // chord length sum is close enough to split the motion profile over the segments
+            segment.length = 0.0;
+            auto previous = p0;
+            for (int sample=1; sample<=m_lengthSamples; ++sample)
+            {
+                auto point = Point(segment, static_cast<double>(sample) / m_lengthSamples);
+                segment.length += point.Distance(previous).to<double>();
+                previous = point;
+            }
+
+            auto segmentIndex = static_cast<int>(m_segments.size());
+            m_segments.emplace_back(segment);
+            if (m_sections.empty())
+            {
+                m_sections.emplace_back(Section{segmentIndex, segmentIndex, 0.0, reversed});
+            }
+            m_sections.back().lastSegment = segmentIndex;
+            m_sections.back().length += segment.length;
+
+            // the robot stops at a reversal and drives the rest of the path in the other direction
+            if (end.value("isReversal", false) && inx+1 < waypoints.size())
+            {
+                reversed = !reversed;
+                m_sections.emplace_back(Section{segmentIndex+1, segmentIndex+1, 0.0, reversed});
+            }
+        }
+
+        if (json.contains("markers"))
+        {
+            for (auto& marker : json.at("markers"))
+            {
+                auto position = marker.value("position", 0.0);
+                auto segment = min(static_cast<int>(position), static_cast<int>(m_segments.size())-1);
+                Marker item{segment, position - segment, {}};
+                if (marker.contains("names"))
+                {
+                    item.names = marker.at("names").get<vector<string>>();
+                }
+                else if (marker.contains("name"))
+                {
+                    item.names.emplace_back(marker.at("name").get<string>());
+                }
+                m_markers.emplace_back(item);
+            }
+            sort(m_markers.begin(), m_markers.end(), [](const Marker& a, const Marker& b) { return a.segment < b.segment || (a.segment == b.segment && a.t < b.t); });
+        }
+
+        m_maxVelocity = units::velocity::meters_per_second_t(json.value("maxVelocity", 0.0));
+        m_maxAcceleration = units::acceleration::meters_per_second_squared_t(json.value("maxAcceleration", 0.0));
+    }
+    catch (const exception& e)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("PathPlannerPath"), string("error loading ") + fileName, string(e.what()));
+        m_segments.clear();
+        m_sections.clear();
+        m_markers.clear();
+    }
+    return !m_segments.empty();
+}
+
+frc::Pose2d PathPlannerPath::GetStartPose() const
+{
+    return m_segments.empty() ? frc::Pose2d() : frc::Pose2d(m_segments.front().p0, frc::Rotation2d(m_segments.front().startHolonomicAngle));
+}
+
+frc::Pose2d PathPlannerPath::GetEndPose() const
+{
+    return m_segments.empty() ? frc::Pose2d() : frc::Pose2d(m_segments.back().p3, frc::Rotation2d(m_segments.back().endHolonomicAngle));
+}
+
+Translation2d PathPlannerPath::Point
+(
+    const Segment&  segment,
+    double          t
+)
+{
+    auto u = 1.0 - t;
+    return segment.p0*(u*u*u) + segment.p1*(3.0*u*u*t) + segment.p2*(3.0*u*t*t) + segment.p3*(t*t*t);
+}
+
+Translation2d PathPlannerPath::Derivative
+(
+    const Segment&  segment,
+    double          t
+)
+{
+    auto u = 1.0 - t;
+    return (segment.p1-segment.p0)*(3.0*u*u) + (segment.p2-segment.p1)*(6.0*u*t) + (segment.p3-segment.p2)*(3.0*t*t);
+}
+
+Translation2d PathPlannerPath::SecondDerivative
+(
+    const Segment&  segment,
+    double          t
+)
+{
+    auto u = 1.0 - t;
+    return (segment.p2 - segment.p1*2.0 + segment.p0)*(6.0*u) + (segment.p3 - segment.p2*2.0 + segment.p1)*(6.0*t);
+}
@@ -0,0 +1,126 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/geometry/Translation2d.h>
+#include <units/acceleration.h>
+#include <units/angle.h>
+#include <units/velocity.h>
+
+// Team 302 includes
+
+// Third Party Includes
+
+/// @class PathPlannerPath
+/// @brief Path read straight from a PathPlanner .path file: the cubic bezier segments between the waypoints, the
+///        holonomic angles and the event markers.  Only the control points are stored; PathPlannerCursor evaluates
+///        the path one segment at a time while it is driven instead of generating every state up front.
+class PathPlannerPath
+{
+    public:
+        /// @brief cubic bezier from one waypoint to the next
+        struct Segment
+        {
+            frc::Translation2d      p0;                 ///< start anchor
+            frc::Translation2d      p1;                 ///< start anchor's next control
+            frc::Translation2d      p2;                 ///< end anchor's previous control
+            frc::Translation2d      p3;                 ///< end anchor
+            units::angle::degree_t  startHolonomicAngle;
+            units::angle::degree_t  endHolonomicAngle;
+            double                  length;             ///< approximate arc length (meters)
+        };
+
+        /// @brief part of the path between reversals; the robot stops at the end of each one
+        struct Section
+        {
+            int                     firstSegment;
+            int                     lastSegment;
+            double                  length;             ///< meters
+            bool                    reversed;           ///< differential drives go backwards on this section
+        };
+
+        /// @brief event marker; position is the waypoint relative position from the .path file
+        struct Marker
+        {
+            int                         segment;
+            double                      t;              ///< bezier parameter within the segment
+            std::vector<std::string>    names;
+        };
+
+        PathPlannerPath();
+        ~PathPlannerPath() = default;
+
+        /// @brief Read a .path file
+        /// @param [in] const std::string& fileName: full path to the file
+        /// @returns bool true if it had at least two waypoints
+        bool Load
+        (
+            const std::string&  fileName
+        );
+
+        const std::vector<Segment>& GetSegments() const { return m_segments; }
+        const std::vector<Section>& GetSections() const { return m_sections; }
+        const std::vector<Marker>& GetMarkers() const { return m_markers; }
+
+        /// @brief velocity and acceleration saved in the file (zero if the file doesn't have them)
+        units::velocity::meters_per_second_t GetMaxVelocity() const { return m_maxVelocity; }
+        units::acceleration::meters_per_second_squared_t GetMaxAcceleration() const { return m_maxAcceleration; }
+
+        /// @brief pose at the start of the path (the rotation is the holonomic angle)
+        frc::Pose2d GetStartPose() const;
+
+        /// @brief pose at the end of the path (the rotation is the holonomic angle)
+        frc::Pose2d GetEndPose() const;
+
+        /// @brief point on a segment
+        static frc::Translation2d Point
+        (
+            const Segment&  segment,
+            double          t
+        );
+
+        /// @brief first derivative of a segment with respect to t
+        static frc::Translation2d Derivative
+        (
+            const Segment&  segment,
+            double          t
+        );
+
+        /// @brief second derivative of a segment with respect to t
+        static frc::Translation2d SecondDerivative
+        (
+            const Segment&  segment,
+            double          t
+        );
+
+    private:
+        std::vector<Segment>                                m_segments;
+        std::vector<Section>                                m_sections;
+        std::vector<Marker>                                 m_markers;
+        units::velocity::meters_per_second_t                m_maxVelocity;
+        units::acceleration::meters_per_second_squared_t    m_maxAcceleration;
+
+        static constexpr int                                m_lengthSamples = 16;
+};
@@ -41,4 +41,13 @@
              MAX_AUTON_PRIMITIVES
          };
 
+       // how a group of primitives that run at the same time finishes
+       enum PRIMITIVE_GROUP
+         {
+             SEQUENTIAL,      // not in a group; runs by itself
+             PARALLEL,        // done when every primitive in the group is done
+             RACE,            // done when any primitive in the group is done
+             DEADLINE         // done when the first primitive in the group is done
+         };
+
 
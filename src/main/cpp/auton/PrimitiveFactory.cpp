@@ -15,6 +15,9 @@
 //====================================================================================================================================================
 
 
+// C++ Includes
+#include <memory>
+
 //Team 302 includes
 #include <auton/PrimitiveEnums.h>
 #include <auton/PrimitiveFactory.h>
@@ -30,6 +33,9 @@
 #include <auton/drivePrimitives/ResetPosition.h>
 #include <auton/drivePrimitives/TurnAngle.h>
 
+using std::make_unique;
+using std::unique_ptr;
+
 PrimitiveFactory* PrimitiveFactory::m_instance = nullptr;
 
 PrimitiveFactory* PrimitiveFactory::GetInstance()
@@ -41,16 +47,7 @@ PrimitiveFactory* PrimitiveFactory::GetInstance()
 	return PrimitiveFactory::m_instance;							//Return said instance
 }
 
-PrimitiveFactory::PrimitiveFactory() :
-				m_DriveStop(nullptr),
-				m_driveTime(nullptr),
-				m_driveDistance(nullptr),
-				m_turnAngle(nullptr),
-				m_DriveHoldPosition(nullptr),
-				m_driveToWall(nullptr),
-				m_driveLidarDistance( nullptr ),
-				m_resetPosition( nullptr ),
-				m_drivePath(nullptr)
+PrimitiveFactory::PrimitiveFactory()
 {
 }
 
@@ -59,86 +56,50 @@ PrimitiveFactory::~PrimitiveFactory()
 	PrimitiveFactory::m_instance = nullptr; //todo: do we have to delete this pointer?
 }
 
-IPrimitive* PrimitiveFactory::GetIPrimitive(PrimitiveParams* primitivePasser)
+unique_ptr<IPrimitive> PrimitiveFactory::CreatePrimitive(PRIMITIVE_IDENTIFIER id)
 {
-	IPrimitive* primitive = nullptr;
-	switch (primitivePasser->GetID())				//Decides which primitive to get or make
+	unique_ptr<IPrimitive> primitive;
+	switch (id)				//Decides which primitive to make
 	{
 		case DO_NOTHING:
-			if (m_DriveStop == nullptr)
-			{
-				m_DriveStop = new DriveStop();
-			}
-			primitive =  m_DriveStop;
+			primitive = make_unique<DriveStop>();
 			break;
 
 		case DRIVE_TIME:
-			if (m_driveTime == nullptr)
-			{
-				m_driveTime = new DriveTime();
-			}
-			primitive = m_driveTime;
+			primitive = make_unique<DriveTime>();
 			break;
 
 		case DRIVE_DISTANCE:
-			if (m_driveDistance == nullptr)
-			{
-				m_driveDistance = new DriveDistance();
-			}
-			primitive = m_driveDistance;
+			primitive = make_unique<DriveDistance>();
 			break;
 
 		case TURN_ANGLE_ABS:
-			if (m_turnAngle == nullptr)
-			{
-				m_turnAngle = new TurnAngle();
-			}
-			primitive = m_turnAngle;
+			primitive = make_unique<TurnAngle>();
 			break;
 
 		case TURN_ANGLE_REL:
 			// TODO: need new primitive
-			if (m_turnAngle == nullptr)
-			{
-				m_turnAngle = new TurnAngle();
-			}
-			primitive = m_turnAngle;
+			primitive = make_unique<TurnAngle>();
 			break;
 
 		case HOLD_POSITION:
-			if (m_DriveHoldPosition == nullptr)
-			{
-				m_DriveHoldPosition = new DriveHoldPosition();
-			}
-			primitive = m_DriveHoldPosition;
+			primitive = make_unique<DriveHoldPosition>();
 			break;
 
 		case DRIVE_TO_WALL:
-			if (m_driveToWall == nullptr)
-			{
-				m_driveToWall = new DriveToWall();
-			}
-			primitive = m_driveToWall;
+			primitive = make_unique<DriveToWall>();
 			break;
+
 		case RESET_POSITION :
-			if (m_resetPosition == nullptr)
-			{
-				m_resetPosition = new ResetPosition();
-			}
-			primitive = m_resetPosition;
+			primitive = make_unique<ResetPosition>();
 			break;
 
 		case DRIVE_PATH :
-			if (m_drivePath == nullptr)
-			{
-				m_drivePath = new DrivePath();
-			}
-			primitive = m_drivePath;
+			primitive = make_unique<DrivePath>();
 			break;
 			
 		default:
 			break;	
 	}
 	return primitive;
-
 }
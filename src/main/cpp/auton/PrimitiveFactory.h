@@ -17,6 +17,7 @@
 #pragma once
 
 // C++ Includes
+#include <memory>
 
 // FRC includes
 
@@ -31,6 +32,9 @@
 class IPrimitive;
 class PrimitiveParams;
 
+/// @class PrimitiveFactory
+/// @brief Creates the primitive for a primitive identifier.  Each call returns a new instance; PrimitivePool keeps
+///        them for reuse, so primitives of the same type can run at the same time.
 class PrimitiveFactory 
 {
 public:
@@ -39,19 +43,12 @@ public:
 	PrimitiveFactory();
 	virtual ~PrimitiveFactory();
 	static PrimitiveFactory* GetInstance();
-	IPrimitive* GetIPrimitive(PrimitiveParams* primitivePasser);
+
+	/// @brief create a primitive
+	/// @param [in] PRIMITIVE_IDENTIFIER id: type of primitive
+	/// @returns std::unique_ptr<IPrimitive> new primitive or nullptr if the type isn't supported
+	std::unique_ptr<IPrimitive> CreatePrimitive(PRIMITIVE_IDENTIFIER id);
 
 private:
     static PrimitiveFactory* m_instance;
-    IPrimitive* m_DriveStop;
-    IPrimitive* m_driveTime;
-    IPrimitive* m_driveDistance;
-    IPrimitive* m_turnAngle;
-    IPrimitive* m_DriveHoldPosition;
-    IPrimitive* m_driveToWall;
-    IPrimitive* m_driveLidarDistance;
-    IPrimitive* m_autoShoot;
-    IPrimitive* m_resetPosition;
-    IPrimitive* m_drivePath;
 };
-
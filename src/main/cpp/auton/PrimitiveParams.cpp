@@ -44,7 +44,11 @@ PrimitiveParams::PrimitiveParams
 		m_heading(heading),
 		m_startDriveSpeed(startDriveSpeed),
 		m_endDriveSpeed(endDriveSpeed),
-		m_pathName (pathName)
+		m_pathName (pathName),
+		m_groupID(-1),
+		m_group(SEQUENTIAL),
+		m_waypointPath(),
+		m_generatedPathID(-1)
 		// @ADDMECH initilize state mgr attribute
 {
 }
@@ -24,6 +24,7 @@
 
 // Team 302 includes
 #include <auton/PrimitiveEnums.h>
+#include <auton/WaypointPathGenerator.h>
 // @ADDMECH include for your mechanism 
 
 #include <chassis/IChassis.h>
@@ -65,6 +66,11 @@ class PrimitiveParams
         float GetDriveSpeed() const {return m_startDriveSpeed;};
         float GetEndDriveSpeed() const {return m_endDriveSpeed;};
         std::string GetPathName() const {return m_pathName;};
+        int GetGroupID() const {return m_groupID;};
+        PRIMITIVE_GROUP GetGroup() const {return m_group;};
+        bool HasWaypoints() const {return !m_waypointPath.waypoints.empty();};
+        const WaypointPathRequest& GetWaypointPath() const {return m_waypointPath;};
+        int GetGeneratedPathID() const {return m_generatedPathID;};
         
         // @ADDMECH Add methods to get the state mgr for mechanism 
 
@@ -72,6 +78,9 @@ class PrimitiveParams
 
         //Setters
         void SetDistance(float distance) {m_distance = distance;};
+        void SetGroup(int groupID, PRIMITIVE_GROUP group) {m_groupID = groupID; m_group = group;};
+        void SetWaypointPath(const WaypointPathRequest& path) {m_waypointPath = path;};
+        void SetGeneratedPathID(int id) {m_generatedPathID = id;};
 
     private:
         //Primitive Parameters
@@ -85,6 +94,10 @@ class PrimitiveParams
         float                                               m_startDriveSpeed;
         float                                               m_endDriveSpeed;
         std::string                                         m_pathName;
+        int                                                 m_groupID;  // consecutive primitives with the same id run together
+        PRIMITIVE_GROUP                                     m_group;
+        WaypointPathRequest                                 m_waypointPath;
+        int                                                 m_generatedPathID;  // WaypointPathGenerator id when it was generated ahead of time
         // @ADDMECH add attribute for your mechanism state 
 
 };
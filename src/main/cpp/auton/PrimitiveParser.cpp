@@ -15,15 +15,24 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include <frc/Filesystem.h>
+#include <frc/geometry/Rotation2d.h>
+#include <units/acceleration.h>
+#include <units/angle.h>
+#include <units/length.h>
+#include <units/velocity.h>
 
 #include <auton/AutonSelector.h>
 #include <auton/PrimitiveEnums.h>
 #include <auton/PrimitiveParams.h>
 #include <auton/PrimitiveParser.h>
+#include <auton/WaypointPathGenerator.h>
 #include <auton/drivePrimitives/IPrimitive.h>
 #include <utils/Logger.h>
+#include <utils/XmlConfigDocument.h>
+#include <utils/XmlName.h>
 // @ADDMECH include for your mechanism state
 
 #include <pugixml/pugixml.hpp>
@@ -32,13 +41,13 @@
 using namespace std;
 using namespace pugi;
 
-PrimitiveParamsVector PrimitiveParser::ParseXML
+bool PrimitiveParser::ParseXML
 (
-    string     fileName
+    const string&               fileName,
+    vector<PrimitiveParams>&    params
 )
 {
-
-    PrimitiveParamsVector paramVector;
+    params.clear();
     auto hasError = false;
 
 	auto deployDir = frc::filesystem::GetDeployDirectory();
@@ -46,154 +55,61 @@ PrimitiveParamsVector PrimitiveParser::ParseXML
 
     string fulldirfile = autonDir;
     fulldirfile += fileName;
-    // initialize the xml string to enum maps
-    map<string, PRIMITIVE_IDENTIFIER> primStringToEnumMap;
-    primStringToEnumMap["DO_NOTHING"] = DO_NOTHING;
-    primStringToEnumMap["HOLD_POSITION"]  = HOLD_POSITION;
-    primStringToEnumMap["DRIVE_DISTANCE"] = DRIVE_DISTANCE;
-    primStringToEnumMap["DRIVE_TIME"] = DRIVE_TIME;
-    primStringToEnumMap["DRIVE_TO_WALL"] = DRIVE_TO_WALL;
-    primStringToEnumMap["TURN_ANGLE_ABS"] = TURN_ANGLE_ABS;
-    primStringToEnumMap["TURN_ANGLE_REL"] = TURN_ANGLE_REL;
-    primStringToEnumMap["DRIVE_PATH"] = DRIVE_PATH;
-    primStringToEnumMap["RESET_POSITION"] = RESET_POSITION;
-
-    map<string, IChassis::HEADING_OPTION> headingOptionMap;
-    headingOptionMap["MAINTAIN"] = IChassis::HEADING_OPTION::MAINTAIN;
-    headingOptionMap["TOWARD_GOAL"] = IChassis::HEADING_OPTION::TOWARD_GOAL;
-    headingOptionMap["TOWARD_GOAL_DRIVE"] = IChassis::HEADING_OPTION::TOWARD_GOAL_DRIVE;
-    headingOptionMap["TOWARD_GOAL_LAUNCHPAD"] = IChassis::HEADING_OPTION::TOWARD_GOAL_LAUNCHPAD;
-    headingOptionMap["LEFT_INTAKE_TOWARD_BALL"] = IChassis::HEADING_OPTION::LEFT_INTAKE_TOWARD_BALL;
-    headingOptionMap["RIGHT_INTAKE_TOWARD_BALL"] = IChassis::HEADING_OPTION::RIGHT_INTAKE_TOWARD_BALL;
-    headingOptionMap["SPECIFIED_ANGLE"] = IChassis::HEADING_OPTION::SPECIFIED_ANGLE;
-    
-    xml_document doc;
-    xml_parse_result result = doc.load_file( fulldirfile.c_str() );
+
+    XmlConfigDocument config;
+    xml_parse_result result = config.Load( fulldirfile );
+    auto& doc = config.GetDocument();
    
     if ( result )
     {
         xml_node auton = doc.root();
+        auto groupID = 0;
         for (xml_node node = auton.first_child(); node; node = node.next_sibling())
         {
             for (xml_node primitiveNode = node.first_child(); primitiveNode; primitiveNode = primitiveNode.next_sibling())
             {
-                if ( strcmp( primitiveNode.name(), "primitive") == 0 )
+                switch ( XmlName::Hash( primitiveNode.name() ) )
                 {
-                    auto primitiveType = UNKNOWN_PRIMITIVE;
-                    auto time = 15.0;
-                    auto distance = 0.0;
-                    auto headingOption = IChassis::HEADING_OPTION::MAINTAIN;
-                    auto heading = 0.0;
-                    auto startDriveSpeed = 0.0;
-                    auto endDriveSpeed = 0.0;
-                    auto xloc = 0.0;
-                    auto yloc = 0.0;
-                    std::string pathName;
-                    // @ADDMECH Initialize your mechanism state
-                    
-                    for (xml_attribute attr = primitiveNode.first_attribute(); attr; attr = attr.next_attribute())
+                    case XmlName::Hash( "primitive" ):
+                        hasError = !ParsePrimitive( primitiveNode, fileName, params ) || hasError;
+                        break;
+
+                    case XmlName::Hash( "group" ):
                     {
-                        if ( strcmp( attr.name(), "id" ) == 0 )
+                        auto group = PARALLEL;
+                        string type = primitiveNode.attribute("type").value();
+                        if ( type == "RACE" )
                         {
-                            auto paramStringToEnumItr = primStringToEnumMap.find( attr.value() );
-                            if ( paramStringToEnumItr != primStringToEnumMap.end() )
-                            {
-                                primitiveType = paramStringToEnumItr->second;
-                            }
-                            else
-                            {
-                                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("PrimitiveParser"), string("ParseXML invalid id"), attr.value());
-                                hasError = true;
-                            }
+                            group = RACE;
                         }
-                        else if ( strcmp( attr.name(), "time" ) == 0 )
+                        else if ( type == "DEADLINE" )
                         {
-                            time = attr.as_float();
+                            group = DEADLINE;
                         }
-                        else if ( strcmp( attr.name(), "distance" ) == 0 )
+                        else if ( !type.empty() && type != "PARALLEL" )
                         {
-                            distance = attr.as_float();
+                            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("PrimitiveParser"), string("ParseXML invalid group type"), type);
+                            hasError = true;
                         }
-                        else if ( strcmp( attr.name(), "headingOption" ) == 0 )
+
+                        auto firstInGroup = params.size();
+                        for (xml_node child = primitiveNode.first_child(); child; child = child.next_sibling())
                         {
-                            auto headingItr = headingOptionMap.find( attr.value() );
-                            if ( headingItr != headingOptionMap.end() )
+                            if ( strcmp( child.name(), "primitive") == 0 )
                             {
-                                headingOption = headingItr->second;
+                                hasError = !ParsePrimitive( child, fileName, params ) || hasError;
                             }
-                            else
-                            {
-                                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("PrimitiveParser"), string("ParseXML invalid heading option"), attr.value());
-                                hasError = true;
-                            }
-                        }
-                        else if ( strcmp( attr.name(), "heading" ) == 0 )
-                        {
-                            heading = attr.as_float();
-                        }
-                        else if ( strcmp( attr.name(), "drivespeed" ) == 0 )
-                        {
-                            startDriveSpeed = attr.as_float();
-                        }
-                        else if ( strcmp( attr.name(), "enddrivespeed" ) == 0 )
-                        {
-                            endDriveSpeed = attr.as_float();
-                        }
-                        else if ( strcmp( attr.name(), "xloc" ) == 0 )
-                        {
-                            xloc = attr.as_float();
                         }
-                        else if ( strcmp( attr.name(), "yloc" ) == 0 )
+                        for (auto inx=firstInGroup; inx<params.size(); ++inx)
                         {
-                            yloc = attr.as_float();
-                        }
-                        else if ( strcmp( attr.name(), "pathname") == 0)
-                        {
-                            pathName = attr.value();
-                        }                
-                        // @ADDMECH add case for your mechanism state to get the statemgr / state
-
-                        else
-                        {
-                            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("PrimitiveParser"), string("ParseXML invalid attribute"), attr.name());
-                            hasError = true;
+                            params[inx].SetGroup( groupID, group );
                         }
+                        groupID++;
+                        break;
                     }
-                    if ( !hasError )
-                    {   
-                        paramVector.emplace_back( new PrimitiveParams( primitiveType,
-                                                                       time,
-                                                                       distance,
-                                                                       xloc,
-                                                                       yloc,
-                                                                       headingOption,
-                                                                       heading,
-                                                                       startDriveSpeed,
-                                                                       endDriveSpeed,
-                                                                       pathName
-                                                                       // @ADDMECH add parameter for your mechanism state
-
-                                                                       ) );
-                        string ntName = string("Primitive ") + to_string(paramVector.size());
-                        int slot = paramVector.size() - 1;
-                        auto logger = Logger::GetLogger();
-                        auto param = paramVector[slot];
-                        logger->LogData(LOGGER_LEVEL::PRINT, ntName, string("Primitive ID"), to_string(param->GetID()));
-                        logger->LogData(LOGGER_LEVEL::PRINT, ntName, string("Time"), param->GetTime());
-                        logger->LogData(LOGGER_LEVEL::PRINT, ntName, string("Distance"), param->GetDistance());
-                        logger->LogData(LOGGER_LEVEL::PRINT, ntName, string("X Location"), param->GetXLocation());
-                        logger->LogData(LOGGER_LEVEL::PRINT, ntName, string("Y Location"), param->GetYLocation());
-                        logger->LogData(LOGGER_LEVEL::PRINT, ntName, string("Heading Option"), to_string(param->GetHeadingOption()));
-                        logger->LogData(LOGGER_LEVEL::PRINT, ntName, string("Heading"), param->GetHeading());
-                        logger->LogData(LOGGER_LEVEL::PRINT, ntName, string("Drive Speed"), param->GetDriveSpeed());
-                        logger->LogData(LOGGER_LEVEL::PRINT, ntName, string("End Drive Speed"), param->GetEndDriveSpeed());
-                        logger->LogData(LOGGER_LEVEL::PRINT, ntName, string("Path Name"), param->GetPathName());
-                        // @ADDMECH Log state data
-                    }
-                    else 
-                    {
-                         Logger::GetLogger() -> LogData(LOGGER_LEVEL::ERROR, string("PrimitiveParser"), string("ParseXML"), string("Has Error"));
-                    }
+
+                    default:
+                        break;
                 }
             }
         }
@@ -202,6 +118,178 @@ PrimitiveParamsVector PrimitiveParser::ParseXML
     {
         Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("PrimitiveParser"), string("ParseXML error parsing file"), fileName );
         Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("PrimitiveParser"), string("ParseXML error message"), result.description() );
+        hasError = true;
+    }
+    return !hasError;
+}
+
+bool PrimitiveParser::ParsePrimitive
+(
+    const xml_node&             primitiveNode,
+    const string&               fileName,
+    vector<PrimitiveParams>&    params
+)
+{
+    // the xml string to enum maps only need to be built once
+    static const map<string, PRIMITIVE_IDENTIFIER> primStringToEnumMap
+    {
+        {"DO_NOTHING", DO_NOTHING},
+        {"HOLD_POSITION", HOLD_POSITION},
+        {"DRIVE_DISTANCE", DRIVE_DISTANCE},
+        {"DRIVE_TIME", DRIVE_TIME},
+        {"DRIVE_TO_WALL", DRIVE_TO_WALL},
+        {"TURN_ANGLE_ABS", TURN_ANGLE_ABS},
+        {"TURN_ANGLE_REL", TURN_ANGLE_REL},
+        {"DRIVE_PATH", DRIVE_PATH},
+        {"RESET_POSITION", RESET_POSITION}
+    };
+
+    static const map<string, IChassis::HEADING_OPTION> headingOptionMap
+    {
+        {"MAINTAIN", IChassis::HEADING_OPTION::MAINTAIN},
+        {"TOWARD_GOAL", IChassis::HEADING_OPTION::TOWARD_GOAL},
+        {"TOWARD_GOAL_DRIVE", IChassis::HEADING_OPTION::TOWARD_GOAL_DRIVE},
+        {"TOWARD_GOAL_LAUNCHPAD", IChassis::HEADING_OPTION::TOWARD_GOAL_LAUNCHPAD},
+        {"LEFT_INTAKE_TOWARD_BALL", IChassis::HEADING_OPTION::LEFT_INTAKE_TOWARD_BALL},
+        {"RIGHT_INTAKE_TOWARD_BALL", IChassis::HEADING_OPTION::RIGHT_INTAKE_TOWARD_BALL},
+        {"SPECIFIED_ANGLE", IChassis::HEADING_OPTION::SPECIFIED_ANGLE}
+    };
+    
+    auto primitiveType = UNKNOWN_PRIMITIVE;
+    auto time = 15.0;
+    auto distance = 0.0;
+    auto headingOption = IChassis::HEADING_OPTION::MAINTAIN;
+    auto heading = 0.0;
+    auto startDriveSpeed = 0.0;
+    auto endDriveSpeed = 0.0;
+    auto xloc = 0.0;
+    auto yloc = 0.0;
+    std::string pathName;
+    WaypointPathRequest waypointPath{};
+    auto primitiveHasError = false;
+    // @ADDMECH Initialize your mechanism state
+    
+    for (xml_attribute attr = primitiveNode.first_attribute(); attr; attr = attr.next_attribute())
+    {
+        switch ( XmlName::Hash( attr.name() ) )
+        {
+            case XmlName::Hash( "id" ):
+            {
+                auto paramStringToEnumItr = primStringToEnumMap.find( attr.value() );
+                if ( paramStringToEnumItr != primStringToEnumMap.end() )
+                {
+                    primitiveType = paramStringToEnumItr->second;
+                }
+                else
+                {
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("PrimitiveParser"), string("ParseXML invalid id"), attr.value());
+                    primitiveHasError = true;
+                }
+                break;
+            }
+
+            case XmlName::Hash( "time" ):
+                time = attr.as_float();
+                break;
+
+            case XmlName::Hash( "distance" ):
+                distance = attr.as_float();
+                break;
+
+            case XmlName::Hash( "headingOption" ):
+            {
+                auto headingItr = headingOptionMap.find( attr.value() );
+                if ( headingItr != headingOptionMap.end() )
+                {
+                    headingOption = headingItr->second;
+                }
+                else
+                {
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("PrimitiveParser"), string("ParseXML invalid heading option"), attr.value());
+                    primitiveHasError = true;
+                }
+                break;
+            }
+
+            case XmlName::Hash( "heading" ):
+                heading = attr.as_float();
+                break;
+
+            case XmlName::Hash( "drivespeed" ):
+                startDriveSpeed = attr.as_float();
+                break;
+
+            case XmlName::Hash( "enddrivespeed" ):
+                endDriveSpeed = attr.as_float();
+                break;
+
+            case XmlName::Hash( "xloc" ):
+                xloc = attr.as_float();
+                break;
+
+            case XmlName::Hash( "yloc" ):
+                yloc = attr.as_float();
+                break;
+
+            case XmlName::Hash( "pathname" ):
+                pathName = attr.value();
+                break;
+
+            case XmlName::Hash( "maxvelocity" ):
+                waypointPath.maxVelocity = units::velocity::meters_per_second_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "maxacceleration" ):
+                waypointPath.maxAcceleration = units::acceleration::meters_per_second_squared_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "reversed" ):
+                waypointPath.reversed = attr.as_bool();
+                break;
+
+            case XmlName::Hash( "startfromrobot" ):
+                waypointPath.startFromRobot = attr.as_bool();
+                break;
+
+            // @ADDMECH add case for your mechanism state to get the statemgr / state
+            default:
+            {
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("PrimitiveParser"), string("ParseXML invalid attribute"), attr.name());
+                primitiveHasError = true;
+                break;
+            }
+        }
+    }
+    // waypoints (meters and degrees in field coordinates) for a path that is generated on the robot
+    for (xml_node waypointNode = primitiveNode.first_child(); waypointNode; waypointNode = waypointNode.next_sibling())
+    {
+        if ( strcmp( waypointNode.name(), "waypoint") == 0 )
+        {
+            waypointPath.waypoints.emplace_back( units::length::meter_t(waypointNode.attribute("x").as_double()),
+                                                 units::length::meter_t(waypointNode.attribute("y").as_double()),
+                                                 frc::Rotation2d(units::angle::degree_t(waypointNode.attribute("heading").as_double())) );
+        }
+    }
+
+    if ( !primitiveHasError )
+    {   
+        params.emplace_back( primitiveType,
+                             time,
+                             distance,
+                             xloc,
+                             yloc,
+                             headingOption,
+                             heading,
+                             startDriveSpeed,
+                             endDriveSpeed,
+                             pathName
+                             // @ADDMECH add parameter for your mechanism state
+                           );
+        params.back().SetWaypointPath( waypointPath );
+    }
+    else 
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("PrimitiveParser"), string("ParseXML has error"), fileName + string(" primitive ") + to_string(params.size()+1));
     }
-    return paramVector;
+    return !primitiveHasError;
 }
@@ -17,6 +17,8 @@
 #pragma once
 
 // C++ Includes
+#include <string>
+#include <vector>
 
 // FRC includes
 
@@ -24,13 +26,27 @@
 #include <auton/PrimitiveParams.h>
 
 // Third Party Includes
+#include <pugixml/pugixml.hpp>
 
 class PrimitiveParser
 {
     public:
-        static PrimitiveParamsVector ParseXML
+        /// @brief Parse an auton file from the deploy auton directory
+        /// @param [in] const std::string& fileName: auton file name
+        /// @param [out] std::vector<PrimitiveParams>& params: primitives in the order they run
+        /// @returns bool true if the file parsed without errors
+        static bool ParseXML
         (
-            std::string     fileName
+            const std::string&              fileName,
+            std::vector<PrimitiveParams>&   params
+        );
+
+    private:
+        static bool ParsePrimitive
+        (
+            const pugi::xml_node&           primitiveNode,
+            const std::string&              fileName,
+            std::vector<PrimitiveParams>&   params
         );
 };
 
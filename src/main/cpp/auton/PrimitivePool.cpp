@@ -0,0 +1,72 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <memory>
+
+// FRC includes
+
+// Team 302 includes
+#include <auton/PrimitiveFactory.h>
+#include <auton/PrimitivePool.h>
+#include <auton/drivePrimitives/IPrimitive.h>
+
+// Third Party Includes
+
+PrimitivePool::PrimitivePool() : m_pools(),
+                                 m_numCreated(0)
+{
+    for (auto& pool : m_pools)
+    {
+        pool.inUse = 0;
+    }
+}
+
+IPrimitive* PrimitivePool::Acquire
+(
+    PRIMITIVE_IDENTIFIER    id
+)
+{
+    if (id <= UNKNOWN_PRIMITIVE || id >= MAX_AUTON_PRIMITIVES)
+    {
+        return nullptr;
+    }
+
+    auto& pool = m_pools[id];
+    if (pool.inUse >= pool.instances.size())
+    {
+        auto primitive = PrimitiveFactory::GetInstance()->CreatePrimitive(id);
+        if (primitive.get() == nullptr)
+        {
+            return nullptr;
+        }
+        pool.instances.emplace_back(std::move(primitive));
+        m_numCreated++;
+    }
+
+    auto primitive = pool.instances[pool.inUse].get();
+    pool.inUse++;
+    return primitive;
+}
+
+void PrimitivePool::ReleaseAll()
+{
+    for (auto& pool : m_pools)
+    {
+        pool.inUse = 0;
+    }
+}
@@ -0,0 +1,67 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <memory>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <auton/PrimitiveEnums.h>
+
+// Third Party Includes
+
+class IPrimitive;
+
+/// @class PrimitivePool
+/// @brief Holds the primitive instances used by an auton plan.  Instances are created by the PrimitiveFactory
+///        the first time they are needed and are reused after ReleaseAll, so a plan only allocates until it
+///        has seen the most primitives of each type that run at the same time.
+class PrimitivePool
+{
+    public:
+        PrimitivePool();
+        ~PrimitivePool() = default;
+
+        /// @brief get an unused instance of a primitive type
+        /// @param [in] PRIMITIVE_IDENTIFIER id: type of primitive
+        /// @returns IPrimitive* primitive or nullptr if the type isn't supported
+        IPrimitive* Acquire
+        (
+            PRIMITIVE_IDENTIFIER    id
+        );
+
+        /// @brief mark every instance unused.  The instances are kept for the next Acquire calls.
+        void ReleaseAll();
+
+        /// @brief number of primitive instances that have been created
+        int GetNumCreated() const { return m_numCreated; }
+
+    private:
+        struct TypePool
+        {
+            std::vector<std::unique_ptr<IPrimitive>>    instances;
+            unsigned int                                inUse;
+        };
+
+        std::array<TypePool, MAX_AUTON_PRIMITIVES>      m_pools;
+        int                                             m_numCreated;
+};
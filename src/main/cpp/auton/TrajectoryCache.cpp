@@ -0,0 +1,327 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef __linux
+#include <dirent.h>
+#endif
+
+// FRC includes
+#include <frc/Filesystem.h>
+#include <frc/Timer.h>
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/trajectory/TrajectoryUtil.h>
+#include <units/acceleration.h>
+#include <units/angle.h>
+#include <units/curvature.h>
+#include <units/length.h>
+#include <units/velocity.h>
+
+// Team 302 includes
+#include <auton/TrajectoryCache.h>
+#include <utils/Logger.h>
+#include <utils/XmlName.h>
+#include <utils/XmlConfigDocument.h>
+
+// Third Party Includes
+#include <pugixml/pugixml.hpp>
+
+using namespace std;
+using namespace pugi;
+
+TrajectoryCache* TrajectoryCache::m_instance = nullptr;
+TrajectoryCache* TrajectoryCache::GetTrajectoryCache()
+{
+    if ( TrajectoryCache::m_instance == nullptr )
+    {
+        TrajectoryCache::m_instance = new TrajectoryCache();
+    }
+    return TrajectoryCache::m_instance;
+}
+
+TrajectoryCache::TrajectoryCache() : m_trajectories(),
+                                     m_plannerPaths(),
+                                     m_pendingPaths(),
+                                     m_memoryBytes(0),
+                                     m_binaryLoads(0),
+                                     m_jsonLoads(0),
+                                     m_loadTime(units::time::second_t(0.0))
+{
+}
+
+void TrajectoryCache::FindAutonPaths()
+{
+#ifdef __linux__
+    auto autonDir = frc::filesystem::GetDeployDirectory() + "/auton/";
+    DIR* directory = opendir(autonDir.c_str());
+    if (directory != nullptr)
+    {
+        for (auto file = readdir(directory); file != nullptr; file = readdir(directory))
+        {
+            auto filename = string(file->d_name);
+            if (filename.size() > 4 && filename.compare(filename.size()-4, 4, ".xml") == 0)
+            {
+                XmlConfigDocument config;
+                auto result = config.Load(autonDir + filename);
+                if (result)
+                {
+                    FindPathNames(config.GetDocument().root());
+                }
+                else
+                {
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("TrajectoryCache"), string("FindAutonPaths error parsing file"), filename);
+                }
+            }
+        }
+        closedir(directory);
+    }
+    else
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("TrajectoryCache"), string("FindAutonPaths"), string("can't open ") + autonDir);
+    }
+#endif
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("TrajectoryCache"), string("Paths to load"), static_cast<int>(m_pendingPaths.size()));
+}
+
+void TrajectoryCache::FindPathNames
+(
+    const xml_node&     node
+)
+{
+    for (xml_node child = node.first_child(); child; child = child.next_sibling())
+    {
+        string pathName = child.attribute("pathname").value();
+        if (!pathName.empty() &&
+            m_trajectories.find(pathName) == m_trajectories.end() &&
+            m_plannerPaths.find(pathName) == m_plannerPaths.end() &&
+            find(m_pendingPaths.begin(), m_pendingPaths.end(), pathName) == m_pendingPaths.end())
+        {
+            m_pendingPaths.emplace_back(pathName);
+        }
+        FindPathNames(child);
+    }
+}
+
+bool TrajectoryCache::LoadNextPath()
+{
+    if (!m_pendingPaths.empty())
+    {
+        auto pathName = m_pendingPaths.back();
+        m_pendingPaths.pop_back();
+        if (IsPlannerPath(pathName))
+        {
+            LoadPlannerPath(pathName);
+        }
+        else
+        {
+            LoadPath(pathName);
+        }
+        if (m_pendingPaths.empty())
+        {
+            LogCacheStats();
+        }
+    }
+    return !m_pendingPaths.empty();
+}
+
+void TrajectoryCache::LoadAllPaths()
+{
+    while (LoadNextPath())
+    {
+    }
+}
+
+const frc::Trajectory* TrajectoryCache::GetTrajectory
+(
+    const string&   pathName
+)
+{
+    auto itr = m_trajectories.find(pathName);
+    if (itr != m_trajectories.end())
+    {
+        return &itr->second;
+    }
+
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("TrajectoryCache"), string("path wasn't preloaded"), pathName);
+    auto pending = find(m_pendingPaths.begin(), m_pendingPaths.end(), pathName);
+    if (pending != m_pendingPaths.end())
+    {
+        m_pendingPaths.erase(pending);
+    }
+    return LoadPath(pathName);
+}
+
+const PathPlannerPath* TrajectoryCache::GetPlannerPath
+(
+    const string&   pathName
+)
+{
+    auto itr = m_plannerPaths.find(pathName);
+    if (itr != m_plannerPaths.end())
+    {
+        return &itr->second;
+    }
+
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("TrajectoryCache"), string("path wasn't preloaded"), pathName);
+    auto pending = find(m_pendingPaths.begin(), m_pendingPaths.end(), pathName);
+    if (pending != m_pendingPaths.end())
+    {
+        m_pendingPaths.erase(pending);
+    }
+    return LoadPlannerPath(pathName);
+}
+
+bool TrajectoryCache::IsPlannerPath
+(
+    const string&   pathName
+)
+{
+    return pathName.size() > 5 && pathName.compare(pathName.size()-5, 5, ".path") == 0;
+}
+
+const PathPlannerPath* TrajectoryCache::LoadPlannerPath
+(
+    const string&   pathName
+)
+{
+    auto start = frc::Timer::GetFPGATimestamp();
+    PathPlannerPath path;
+    if (!path.Load(frc::filesystem::GetDeployDirectory() + "/pathplanner/" + pathName))
+    {
+        return nullptr;
+    }
+    m_memoryBytes += pathName.capacity() + path.GetSegments().capacity() * sizeof(PathPlannerPath::Segment);
+    auto inserted = m_plannerPaths.emplace(pathName, std::move(path));
+    m_loadTime += frc::Timer::GetFPGATimestamp() - start;
+    return &inserted.first->second;
+}
+
+const frc::Trajectory* TrajectoryCache::LoadPath
+(
+    const string&   pathName
+)
+{
+    auto start = frc::Timer::GetFPGATimestamp();
+    auto fileName = frc::filesystem::GetDeployDirectory() + "/paths/" + pathName;
+    try
+    {
+        frc::Trajectory trajectory;
+        if (LoadBinaryPath(fileName, trajectory))
+        {
+            m_binaryLoads++;
+        }
+        else
+        {
+            trajectory = frc::TrajectoryUtil::FromPathweaverJson(fileName);
+            m_jsonLoads++;
+        }
+        m_memoryBytes += pathName.capacity() + trajectory.States().capacity() * sizeof(frc::Trajectory::State);
+        auto inserted = m_trajectories.emplace(pathName, std::move(trajectory));
+        m_loadTime += frc::Timer::GetFPGATimestamp() - start;
+        return &inserted.first->second;
+    }
+    catch (const exception& e)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("TrajectoryCache"), string("error loading ") + pathName, string(e.what()));
+    }
+    return nullptr;
+}
+
+bool TrajectoryCache::LoadBinaryPath
+(
+    const string&       jsonFileName,
+    frc::Trajectory&    trajectory
+) const
+{
+    auto binaryFileName = jsonFileName;
+    auto extension = binaryFileName.rfind(".json");
+    if (extension != string::npos)
+    {
+        binaryFileName.erase(extension);
+    }
+    binaryFileName += ".traj";
+
+    ifstream file(binaryFileName, ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    BinaryTrajectoryHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || memcmp(header.magic, "T302", sizeof(header.magic)) != 0 || header.version != m_binaryVersion || header.stride != m_binaryStride)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("TrajectoryCache"), string("invalid binary trajectory"), binaryFileName);
+        return false;
+    }
+
+    // the JSON is the source of truth, so ignore a .traj that wasn't generated from the JSON that is deployed;
+    // reading the bytes is much cheaper than parsing them
+    ifstream jsonFile(jsonFileName, ios::binary);
+    auto jsonHash = XmlName::FNV_OFFSET;
+    char buffer[4096];
+    while (jsonFile.read(buffer, sizeof(buffer)) || jsonFile.gcount() > 0)
+    {
+        jsonHash = XmlName::Hash(buffer, static_cast<size_t>(jsonFile.gcount()), jsonHash);
+    }
+    if (jsonFile.is_open() && jsonHash != header.jsonHash)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("TrajectoryCache"), string("stale binary trajectory"), binaryFileName);
+        return false;
+    }
+
+    vector<double> values(static_cast<size_t>(header.numStates) * m_binaryStride);
+    file.read(reinterpret_cast<char*>(values.data()), static_cast<streamsize>(values.size() * sizeof(double)));
+    if (!file)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("TrajectoryCache"), string("truncated binary trajectory"), binaryFileName);
+        return false;
+    }
+
+    vector<frc::Trajectory::State> states;
+    states.reserve(header.numStates);
+    for (auto value = values.begin(); value != values.end(); value += m_binaryStride)
+    {
+        frc::Trajectory::State state;
+        state.t = units::time::second_t(value[0]);
+        state.pose = frc::Pose2d(units::length::meter_t(value[1]), units::length::meter_t(value[2]), frc::Rotation2d(units::angle::radian_t(value[3])));
+        state.velocity = units::velocity::meters_per_second_t(value[4]);
+        state.acceleration = units::acceleration::meters_per_second_squared_t(value[5]);
+        state.curvature = units::curvature_t(value[6]);
+        states.emplace_back(state);
+    }
+    trajectory = frc::Trajectory(states);
+    return true;
+}
+
+void TrajectoryCache::LogCacheStats() const
+{
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("TrajectoryCache"), string("Paths loaded"), static_cast<int>(m_trajectories.size()));
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("TrajectoryCache"), string("PathPlanner paths loaded"), static_cast<int>(m_plannerPaths.size()));
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("TrajectoryCache"), string("Binary loads"), m_binaryLoads);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("TrajectoryCache"), string("JSON loads"), m_jsonLoads);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("TrajectoryCache"), string("Memory (KB)"), m_memoryBytes / 1024.0);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("TrajectoryCache"), string("Load time (ms)"), units::time::millisecond_t(m_loadTime).to<double>());
+}
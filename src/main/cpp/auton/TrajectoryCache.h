@@ -0,0 +1,134 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/trajectory/Trajectory.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <auton/PathPlannerPath.h>
+
+// Third Party Includes
+#include <pugixml/pugixml.hpp>
+
+/// @class TrajectoryCache
+/// @brief Holds every pathweaver trajectory named by the auton XML files so primitives can look them up
+///        instead of parsing JSON when they start.  RobotInit finds the path names and DisabledPeriodic
+///        loads them one per loop, so the JSON parsing never happens during autonomous.
+///        When the build generated a binary .traj file next to the JSON (see convertTrajectories in build.gradle)
+///        that is loaded instead; the JSON is the fallback if the .traj is missing or doesn't match it.
+///        Path names ending in .path are PathPlanner files from the deploy pathplanner directory; only their
+///        control points are loaded (see PathPlannerPath).
+class TrajectoryCache
+{
+    public:
+        /// @brief Find or create the trajectory cache
+        static TrajectoryCache* GetTrajectoryCache();
+
+        /// @brief Scan every auton XML file in the deploy auton directory for pathname attributes and queue those paths to load
+        void FindAutonPaths();
+
+        /// @brief Load the next queued path.  Call from DisabledPeriodic to spread the loading over several loops.
+        /// @returns bool true if there are still paths to load
+        bool LoadNextPath();
+
+        /// @brief Load all of the queued paths
+        void LoadAllPaths();
+
+        /// @brief Look up a trajectory.  If it wasn't preloaded it is loaded now (and an error is logged since
+        ///        that means an auton file or path was missed by FindAutonPaths).
+        /// @param [in] const std::string& pathName: pathweaver file name in the deploy paths directory
+        /// @returns const frc::Trajectory* trajectory or nullptr if it couldn't be loaded; valid for the life of the program
+        const frc::Trajectory* GetTrajectory
+        (
+            const std::string&  pathName
+        );
+
+        /// @brief Look up a PathPlanner path.  If it wasn't preloaded it is loaded now (and an error is logged).
+        /// @param [in] const std::string& pathName: .path file name in the deploy pathplanner directory
+        /// @returns const PathPlannerPath* path or nullptr if it couldn't be loaded; valid for the life of the program
+        const PathPlannerPath* GetPlannerPath
+        (
+            const std::string&  pathName
+        );
+
+        /// @brief true if the path name is a PathPlanner .path file instead of a pathweaver trajectory
+        static bool IsPlannerPath
+        (
+            const std::string&  pathName
+        );
+
+    private:
+        TrajectoryCache();
+        ~TrajectoryCache() = default;
+
+        void FindPathNames
+        (
+            const pugi::xml_node&   node
+        );
+
+        const frc::Trajectory* LoadPath
+        (
+            const std::string&  pathName
+        );
+
+        const PathPlannerPath* LoadPlannerPath
+        (
+            const std::string&  pathName
+        );
+
+        bool LoadBinaryPath
+        (
+            const std::string&  jsonFileName,
+            frc::Trajectory&    trajectory
+        ) const;
+
+        /// @brief .traj file header written by convertTrajectories in build.gradle
+        struct BinaryTrajectoryHeader
+        {
+            char        magic[4];       ///< "T302"
+            uint32_t    version;        ///< m_binaryVersion
+            uint32_t    numStates;
+            uint32_t    stride;         ///< doubles per state (m_binaryStride)
+            uint64_t    jsonHash;       ///< XmlName::Hash of the JSON it was generated from, to catch stale files
+        };
+        static_assert(sizeof(BinaryTrajectoryHeader) == 24, "header must match the build.gradle writer");
+
+        static constexpr uint32_t                   m_binaryVersion = 2;
+        static constexpr uint32_t                   m_binaryStride = 7;
+
+        void LogCacheStats() const;
+
+        std::map<std::string, frc::Trajectory>      m_trajectories;
+        std::map<std::string, PathPlannerPath>      m_plannerPaths;
+        std::vector<std::string>                    m_pendingPaths;
+        size_t                                      m_memoryBytes;
+        int                                         m_binaryLoads;
+        int                                         m_jsonLoads;
+        units::time::second_t                       m_loadTime;
+
+        static TrajectoryCache*                     m_instance;
+};
@@ -0,0 +1,101 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <algorithm>
+#include <cstddef>
+
+// FRC includes
+#include <frc/trajectory/Trajectory.h>
+
+// Team 302 includes
+#include <auton/TrajectoryCursor.h>
+
+using frc::Trajectory;
+
+TrajectoryCursor::TrajectoryCursor() : m_trajectory(nullptr),
+                                       m_index(0),
+                                       m_sample()
+{
+}
+
+void TrajectoryCursor::SetTrajectory
+(
+    const Trajectory*   trajectory
+)
+{
+    m_trajectory = trajectory;
+    m_index = 0;
+}
+
+bool TrajectoryCursor::IsValid() const
+{
+    return m_trajectory != nullptr && !m_trajectory->States().empty();
+}
+
+const Trajectory::State& TrajectoryCursor::Sample
+(
+    units::time::second_t   t
+)
+{
+    if (!IsValid())
+    {
+        m_sample = Trajectory::State();
+        return m_sample;
+    }
+
+    const auto& states = m_trajectory->States();
+    if (t <= states.front().t)
+    {
+        m_index = 0;
+        m_sample = states.front();
+        return m_sample;
+    }
+    if (t >= states.back().t)
+    {
+        m_index = states.size() - 1;
+        m_sample = states.back();
+        return m_sample;
+    }
+
+    if (t < states[m_index].t)
+    {
+        // time went backwards (e.g. the timer was reset), so find the state the slow way
+        auto after = std::upper_bound(states.begin(), states.end(), t, [](units::time::second_t time, const Trajectory::State& state) { return time < state.t; });
+        m_index = static_cast<size_t>(after - states.begin()) - 1;
+    }
+    else
+    {
+        while (m_index + 1 < states.size() && states[m_index + 1].t <= t)
+        {
+            m_index++;
+        }
+    }
+
+    const auto& previous = states[m_index];
+    const auto& next = states[m_index + 1];
+    auto span = next.t - previous.t;
+    if (span <= units::time::second_t(1E-9))
+    {
+        m_sample = next;
+    }
+    else
+    {
+        m_sample = previous.Interpolate(next, ((t - previous.t) / span).to<double>());
+    }
+    return m_sample;
+}
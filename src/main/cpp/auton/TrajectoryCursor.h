@@ -0,0 +1,65 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+
+// FRC includes
+#include <frc/trajectory/Trajectory.h>
+#include <units/time.h>
+
+/// @class TrajectoryCursor
+/// @brief Samples a trajectory the same way frc::Trajectory::Sample does, but remembers where the last sample
+///        was.  Path following samples at increasing times, so each call only steps forward over the states
+///        passed since the previous call (amortized O(1)) instead of binary searching the whole trajectory, which
+///        keeps sampling cheap at odometry rate.  The cursor only points at the trajectory's states (e.g. the
+///        TrajectoryCache copy), it never copies them.
+class TrajectoryCursor
+{
+    public:
+        TrajectoryCursor();
+        ~TrajectoryCursor() = default;
+
+        /// @brief Point the cursor at a trajectory and rewind it to the start
+        /// @param [in] const frc::Trajectory*  trajectory: trajectory to sample (must outlive its use by the cursor); nullptr to clear
+        void SetTrajectory
+        (
+            const frc::Trajectory*  trajectory
+        );
+
+        /// @brief rewind to the start of the trajectory
+        void Reset() { m_index = 0; }
+
+        /// @brief true if there is a trajectory with at least one state
+        bool IsValid() const;
+
+        /// @brief Get the interpolated state at a time.  Times earlier than the previous sample still work,
+        ///        they just fall back to a binary search.
+        /// @param [in] units::second_t t: time since the start of the trajectory
+        /// @returns const frc::Trajectory::State& sampled state (valid until the next call)
+        const frc::Trajectory::State& Sample
+        (
+            units::time::second_t   t
+        );
+
+    private:
+        const frc::Trajectory*      m_trajectory;
+        size_t                      m_index;        // last state at or before the previous sample time
+        frc::Trajectory::State      m_sample;
+};
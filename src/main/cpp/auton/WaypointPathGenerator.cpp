@@ -0,0 +1,196 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <chrono>
+#include <exception>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Rotation2d.h>
+#include <frc/Timer.h>
+#include <frc/trajectory/TrajectoryConfig.h>
+#include <frc/trajectory/TrajectoryGenerator.h>
+
+// Team 302 includes
+#include <auton/WaypointPathGenerator.h>
+#include <chassis/ChassisFactory.h>
+#include <chassis/IChassis.h>
+#include <chassis/swerve/SwerveChassis.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+WaypointPathGenerator* WaypointPathGenerator::m_instance = nullptr;
+WaypointPathGenerator* WaypointPathGenerator::GetWaypointPathGenerator()
+{
+    if ( WaypointPathGenerator::m_instance == nullptr )
+    {
+        WaypointPathGenerator::m_instance = new WaypointPathGenerator();
+    }
+    return WaypointPathGenerator::m_instance;
+}
+
+WaypointPathGenerator::WaypointPathGenerator() : m_paths(),
+                                                 m_nextID(0)
+{
+}
+
+int WaypointPathGenerator::Generate
+(
+    const WaypointPathRequest&  request
+)
+{
+    RemoveReleased();
+
+    auto maxVelocity = request.maxVelocity;
+    auto maxAcceleration = request.maxAcceleration;
+    ApplyChassisLimits(maxVelocity, maxAcceleration);
+
+    frc::TrajectoryConfig config(maxVelocity, maxAcceleration);
+    config.SetReversed(request.reversed);
+
+    auto id = m_nextID;
+    m_nextID++;
+    auto& path = m_paths[id];
+    path.isReady = false;
+    path.isFailed = false;
+    path.isReleased = false;
+    path.future = async(launch::async, [waypoints = request.waypoints, config]()
+                                       {
+                                           auto start = frc::Timer::GetFPGATimestamp();
+                                           auto trajectory = frc::TrajectoryGenerator::GenerateTrajectory(waypoints, config);
+                                           return make_pair(trajectory, frc::Timer::GetFPGATimestamp() - start);
+                                       });
+    return id;
+}
+
+int WaypointPathGenerator::Generate
+(
+    const WaypointPathRequest&  request,
+    const frc::Pose2d&          startPose
+)
+{
+    auto fromRobot = request;
+    if (fromRobot.waypoints.empty())
+    {
+        fromRobot.waypoints.emplace_back(startPose);
+        return Generate(fromRobot);
+    }
+
+    // the spline leaves the robot heading toward the first waypoint (backwards for a reversed path)
+    auto delta = fromRobot.waypoints.front().Translation() - startPose.Translation();
+    if (delta.Norm() < m_minStartDistance)
+    {
+        // already at the first waypoint, so start there from the robot's position
+        fromRobot.waypoints.front() = frc::Pose2d(startPose.Translation(), fromRobot.waypoints.front().Rotation());
+        return Generate(fromRobot);
+    }
+    frc::Rotation2d bearing(delta.X().to<double>(), delta.Y().to<double>());
+    bearing = request.reversed ? bearing + frc::Rotation2d(units::angle::degree_t(180.0)) : bearing;
+    fromRobot.waypoints.insert(fromRobot.waypoints.begin(), frc::Pose2d(startPose.Translation(), bearing));
+    return Generate(fromRobot);
+}
+
+void WaypointPathGenerator::ApplyChassisLimits
+(
+    units::velocity::meters_per_second_t&               maxVelocity,
+    units::acceleration::meters_per_second_squared_t&   maxAcceleration
+)
+{
+    // chassis limits from robot.xml; only the swerve chassis has a maximum acceleration, so the others take a second to reach max speed
+    auto chassis = ChassisFactory::GetChassisFactory()->GetIChassis();
+    if (chassis.get() != nullptr)
+    {
+        auto chassisMaxSpeed = chassis.get()->GetMaxSpeed();
+        units::acceleration::meters_per_second_squared_t chassisMaxAcceleration = chassisMaxSpeed / units::time::second_t(1.0);
+        if (chassis.get()->GetType() == IChassis::CHASSIS_TYPE::SWERVE)
+        {
+            chassisMaxAcceleration = dynamic_cast<SwerveChassis*>(chassis.get())->GetMaxAcceleration();
+        }
+        maxVelocity = (maxVelocity.to<double>() <= 0.0 || maxVelocity > chassisMaxSpeed) ? chassisMaxSpeed : maxVelocity;
+        maxAcceleration = (maxAcceleration.to<double>() <= 0.0 || maxAcceleration > chassisMaxAcceleration) ? chassisMaxAcceleration : maxAcceleration;
+    }
+}
+
+const frc::Trajectory* WaypointPathGenerator::GetTrajectory
+(
+    int         id
+)
+{
+    auto itr = m_paths.find(id);
+    if (itr == m_paths.end() || itr->second.isReleased || itr->second.isFailed)
+    {
+        return nullptr;
+    }
+
+    auto& path = itr->second;
+    if (!path.isReady && path.future.valid() && path.future.wait_for(chrono::seconds(0)) == future_status::ready)
+    {
+        try
+        {
+            auto result = path.future.get();
+            path.trajectory = std::move(result.first);
+            path.isReady = true;
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("WaypointPathGenerator"), string("Generation time (ms)"), units::time::millisecond_t(result.second).to<double>());
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("WaypointPathGenerator"), string("States"), static_cast<int>(path.trajectory.States().size()));
+        }
+        catch (const exception& e)
+        {
+            path.isFailed = true;
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("WaypointPathGenerator"), string("generation failed"), string(e.what()));
+        }
+    }
+    return path.isReady ? &path.trajectory : nullptr;
+}
+
+bool WaypointPathGenerator::IsPending
+(
+    int         id
+) const
+{
+    auto itr = m_paths.find(id);
+    return itr != m_paths.end() && !itr->second.isReady && !itr->second.isFailed && itr->second.future.valid();
+}
+
+void WaypointPathGenerator::Release
+(
+    int         id
+)
+{
+    auto itr = m_paths.find(id);
+    if (itr != m_paths.end())
+    {
+        itr->second.isReleased = true;
+    }
+    RemoveReleased();
+}
+
+void WaypointPathGenerator::RemoveReleased()
+{
+    for (auto itr = m_paths.begin(); itr != m_paths.end();)
+    {
+        auto& path = itr->second;
+        auto isRunning = path.future.valid() && path.future.wait_for(chrono::seconds(0)) != future_status::ready;
+        itr = (path.isReleased && !isRunning) ? m_paths.erase(itr) : next(itr);
+    }
+}
@@ -0,0 +1,130 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <future>
+#include <map>
+#include <utility>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/trajectory/Trajectory.h>
+#include <units/acceleration.h>
+#include <units/length.h>
+#include <units/time.h>
+#include <units/velocity.h>
+
+// Team 302 includes
+
+// Third Party Includes
+
+/// @struct WaypointPathRequest
+/// @brief  Path defined by waypoints in the auton XML instead of a pathweaver file (field coordinates in meters)
+struct WaypointPathRequest
+{
+    std::vector<frc::Pose2d>                            waypoints;
+    units::velocity::meters_per_second_t                maxVelocity;        ///< zero uses the chassis maximum speed
+    units::acceleration::meters_per_second_squared_t    maxAcceleration;    ///< zero uses the chassis maximum acceleration
+    bool                                                reversed;
+    bool                                                startFromRobot;     ///< start at the robot pose when the path starts instead of generating ahead of time
+};
+
+/// @class WaypointPathGenerator
+/// @brief Generates trajectories from waypoint paths on a background thread.  Generate returns right away with an id;
+///        GetTrajectory returns nullptr until the trajectory is ready, so the robot loop never waits on the generation.
+class WaypointPathGenerator
+{
+    public:
+        /// @brief Find or create the generator
+        static WaypointPathGenerator* GetWaypointPathGenerator();
+
+        /// @brief Start generating a path.  The constraints are read from the chassis here, on the calling thread.
+        /// @param [in] const WaypointPathRequest& request: waypoints and constraints
+        /// @returns int id to look the trajectory up with
+        int Generate
+        (
+            const WaypointPathRequest&  request
+        );
+
+        /// @brief Start generating a path from the given pose to the waypoints.  The path leaves the start toward the
+        ///        first waypoint; the start pose's rotation is the robot heading, which on a swerve isn't the direction
+        ///        of travel, so it isn't used for the spline (DrivePath holds it as the holonomic heading instead).
+        /// @param [in] const WaypointPathRequest& request: waypoints and constraints
+        /// @param [in] const frc::Pose2d& startPose: pose the path starts at
+        /// @returns int id to look the trajectory up with
+        int Generate
+        (
+            const WaypointPathRequest&  request,
+            const frc::Pose2d&          startPose
+        );
+
+        /// @brief Limit path constraints to what the chassis in robot.xml can do; zero means use the chassis limit
+        /// @param [in/out] units::meters_per_second_t& maxVelocity: requested velocity in, limited velocity out
+        /// @param [in/out] units::meters_per_second_squared_t& maxAcceleration: requested acceleration in, limited acceleration out
+        static void ApplyChassisLimits
+        (
+            units::velocity::meters_per_second_t&               maxVelocity,
+            units::acceleration::meters_per_second_squared_t&   maxAcceleration
+        );
+
+        /// @brief Get a generated trajectory without waiting for it
+        /// @param [in] int id: id returned by Generate
+        /// @returns const frc::Trajectory* trajectory or nullptr if it isn't ready (or failed); valid until Release is called
+        const frc::Trajectory* GetTrajectory
+        (
+            int         id
+        );
+
+        /// @brief true while the trajectory is still being generated
+        bool IsPending
+        (
+            int         id
+        ) const;
+
+        /// @brief Free a trajectory that is no longer needed.  If it is still generating it is freed once it finishes.
+        void Release
+        (
+            int         id
+        );
+
+    private:
+        WaypointPathGenerator();
+        ~WaypointPathGenerator() = default;
+
+        /// @brief erase released entries whose generation finished (erasing a running std::async future would block)
+        void RemoveReleased();
+
+        struct GeneratedPath
+        {
+            std::future<std::pair<frc::Trajectory, units::time::second_t>>  future;
+            frc::Trajectory                                                 trajectory;
+            bool                                                            isReady;
+            bool                                                            isFailed;
+            bool                                                            isReleased;
+        };
+
+        std::map<int, GeneratedPath>    m_paths;
+        int                             m_nextID;
+
+        // closer than this the robot is at the first waypoint and the direction to it is noise
+        const units::length::meter_t    m_minStartDistance = units::length::meter_t(0.05);
+
+        static WaypointPathGenerator*   m_instance;
+};
@@ -14,6 +14,7 @@
 //====================================================================================================================================================
 
 //C++
+#include <numbers>
 #include <string>
 
 //FRC Includes
@@ -22,13 +23,18 @@
 #include <frc/kinematics/ChassisSpeeds.h>
 #include <frc/Filesystem.h>
 #include <frc/trajectory/TrajectoryUtil.h>
+#include <units/angular_acceleration.h>
 #include <units/angular_velocity.h>
 #include <wpi/fs.h>
 
 // 302 Includes
+#include <auton/TrajectoryCache.h>
+#include <auton/WaypointPathGenerator.h>
+#include <mechanisms/StateMgrHelper.h>
 #include <auton/drivePrimitives/DrivePath.h>
 #include <chassis/ChassisFactory.h>
 #include <chassis/IChassis.h>
+#include <chassis/swerve/SwerveChassis.h>
 #include <utils/Logger.h>
 
 
@@ -40,29 +46,26 @@ using namespace wpi::math;
 DrivePath::DrivePath() : m_chassis(ChassisFactory::GetChassisFactory()->GetIChassis()),
                          m_timer(make_unique<Timer>()),
                          m_currentChassisPosition(m_chassis.get()->GetPose()),
-                         m_trajectory(),
+                         m_trajectory(nullptr),
+                         m_cursor(),
+                         m_plannerPath(nullptr),
+                         m_plannerCursor(),
                          m_runHoloController(true),
                          m_ramseteController(),
-                         m_holoController(frc2::PIDController{1.5, 0, 0},
-                                          frc2::PIDController{1.5, 0, 0},
-                                          frc::ProfiledPIDController<units::radian>{0.1, 0, 0,
-                                                                                    frc::TrapezoidProfile<units::radian>::Constraints{0_rad_per_s, 0_rad_per_s / 1_s}}),
-                         //max velocity of 1 rotation per second and a max acceleration of 180 degrees per second squared.
-                         m_PrevPos(m_chassis.get()->GetPose()),
-                         m_PosChgTimer(make_unique<Timer>()),
+                         m_holoController(),
                          m_timesRun(0),
-                         m_targetPose(),
-                         m_deltaX(0.0),
-                         m_deltaY(0.0),
-                         m_trajectoryStates(),
                          m_desiredState(),
                          m_headingOption(IChassis::HEADING_OPTION::MAINTAIN),
                          m_heading(0.0),
                          m_maxTime(-1.0),
-                         m_ntName("DrivePath")
+                         m_completion(),
+                         m_completionReason(PathCompletion::NOT_DONE),
+                         m_ntName("DrivePath"),
+                         m_generatedPathID(-1),
+                         m_startHeading(),
+                         m_ownsGeneratedPath(false)
 
 {
-    m_trajectoryStates.clear();
 }
 void DrivePath::Init(PrimitiveParams *params)
 {
@@ -82,59 +85,91 @@ void DrivePath::Init(PrimitiveParams *params)
     Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "WhyDone", "Not done");
     Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "Times Ran", 0);
 
-    m_trajectoryStates.clear(); //Clears the primitive of previous path/trajectory
-
-    m_wasMoving = false;
+    m_trajectory = nullptr; //Clears the primitive of previous path/trajectory
+    m_cursor.SetTrajectory(nullptr);
+    m_plannerPath = nullptr;
+    m_plannerCursor.SetPath(nullptr, units::velocity::meters_per_second_t(0.0), units::acceleration::meters_per_second_squared_t(0.0));
 
     Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "Initialized", "True"); //Signals that drive path is initialized in the console
 
-    GetTrajectory(params->GetPathName());  //Parses path from json file based on path name given in xml
-    
-    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "Trajectory Time", m_trajectory.TotalTime().to<double>());// Debugging
+    // release the path this primitive generated the last time it ran
+    if (m_ownsGeneratedPath)
+    {
+        WaypointPathGenerator::GetWaypointPathGenerator()->Release(m_generatedPathID);
+    }
+    m_generatedPathID = -1;
+    m_ownsGeneratedPath = false;
 
-    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, std::string("DrivePathInit"), std::to_string(m_trajectoryStates.size()));
+    if (params->HasWaypoints())
+    {
+        // generated ahead of time while disabled, or now from where the robot is; either way Run picks it up once it is ready
+        m_generatedPathID = params->GetGeneratedPathID();
+        if (m_generatedPathID < 0)
+        {
+            m_generatedPathID = WaypointPathGenerator::GetWaypointPathGenerator()->Generate(params->GetWaypointPath(), m_chassis.get()->GetPose());
+            m_ownsGeneratedPath = true;
+        }
+        GetGeneratedTrajectory();
+    }
+    else if (TrajectoryCache::IsPlannerPath(params->GetPathName()))
+    {
+        GetPlannerPath(params);
+    }
+    else
+    {
+        GetTrajectory(params->GetPathName());  //Looks up the preloaded path based on path name given in xml
+    }
     
-    if (!m_trajectoryStates.empty()) // only go if path name found
+    if (HasTrajectory()) // only go if path name found
     {
-        m_desiredState = m_trajectoryStates.front(); //m_desiredState is the first state, or starting position
-
-        m_timer.get()->Reset(); //Restarts and starts timer
-        m_timer.get()->Start();
-
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "DrivePathValues: CurrentPosX", m_currentChassisPosition.X().to<double>());
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "DrivePathValues: CurrentPosY", m_currentChassisPosition.Y().to<double>());
+        StartTrajectory();
+    }
+    m_timesRun = 0;
+    m_completionReason = PathCompletion::NOT_DONE;
+}
 
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "DrivePathValues: iDeltaX", "0");
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "DrivePathValues: iDeltaX", "0");
+void DrivePath::StartTrajectory()
+{
+    auto totalTime = m_plannerPath != nullptr ? m_plannerCursor.GetTotalTime() : m_trajectory->TotalTime();
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "Trajectory Time", totalTime.to<double>());// Debugging
 
-        //A timer used for position change detection
-        m_PosChgTimer.get()->Reset(); 
-        m_PosChgTimer.get()->Start(); // start scan timer to detect motion
+    //m_desiredState is the first state, or starting position
+    m_desiredState = m_plannerPath != nullptr ? m_plannerCursor.Sample(units::time::second_t(0.0)) : m_trajectory->States().front();
 
-        //Is used to determine what controller/ "drive mode" pathweaver will run in
-        //Holo / Holonomic = Swerve X, y, z movement   Ramsete = Differential / Tank x, y movement
-        m_holoController.SetEnabled(m_runHoloController);
-        m_ramseteController.SetEnabled(!m_runHoloController);
+    m_startHeading = m_chassis.get()->GetPose().Rotation();
 
-        //Sampling means to grab a state based on the time, if we want to know what state we should be running at 5 seconds,
-        //we will sample the 5 second state.
-        auto targetState = m_trajectory.Sample(m_trajectory.TotalTime());  //"Samples" or grabs the position we should be at based on time
+    m_timer.get()->Reset(); //Restarts and starts timer
+    m_timer.get()->Start();
 
-        m_targetPose = targetState.pose;  //Target pose represents the pose that we want to be at, based on the target state from above
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "DrivePathValues: CurrentPosX", m_currentChassisPosition.X().to<double>());
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "DrivePathValues: CurrentPosY", m_currentChassisPosition.Y().to<double>());
 
-        auto currPose = m_chassis.get()->GetPose(); //Grabs the current pose of the robot to compare to the target pose
-        auto trans = m_targetPose - currPose; //Translation / Delta of the target pose and current pose
+    //Is used to determine what controller/ "drive mode" pathweaver will run in
+    //Holo / Holonomic = Swerve X, y, z movement   Ramsete = Differential / Tank x, y movement
+    m_holoController = CreateHoloController();
+    m_holoController->SetEnabled(m_runHoloController);
+    m_ramseteController.SetEnabled(!m_runHoloController);
 
-        m_deltaX = trans.X().to<double>();  //Separates the delta "trans" from above into two variables for x and y
-        m_deltaY = trans.Y().to<double>();
-    }
-    m_timesRun = 0;
+    //The path is done based on the trajectory time and how close we are to the pose we want to be at when the path is done (the last state)
+    auto targetPose = m_plannerPath != nullptr ? m_plannerPath->GetEndPose() : m_trajectory->States().back().pose;
+    m_completion.Start(targetPose, totalTime, units::time::second_t(m_maxTime));
 }
+
 void DrivePath::Run()
 {
     Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "Running", "True");
 
-    if (!m_trajectoryStates.empty()) //If we have a path parsed / have states to run
+    // a generated path starts the cycle it becomes ready; until then the chassis holds still below
+    if (!HasTrajectory() && m_generatedPathID > -1)
+    {
+        GetGeneratedTrajectory();
+        if (HasTrajectory())
+        {
+            StartTrajectory();
+        }
+    }
+
+    if (HasTrajectory()) //If we have a path parsed / have states to run
     {
         // debugging
         m_timesRun++;
@@ -148,43 +183,37 @@ void DrivePath::Run()
         ChassisSpeeds refChassisSpeeds;
         if (m_runHoloController)
         {
-            Rotation2d rotation = m_desiredState.pose.Rotation();
+            // the theta controller turns the robot to the heading, so the chassis must not change omega (MAINTAIN would replace it
+            // with its own heading hold); only the goal tracking options, which aim with the camera, are left to the chassis
+            auto chassisHeadingOption = IChassis::HEADING_OPTION::DEFAULT;
             switch (m_headingOption)
             {
-                case IChassis::HEADING_OPTION::MAINTAIN:
-                   rotation = m_currentChassisPosition.Rotation();
-                   break;
-
-                case IChassis::HEADING_OPTION::POLAR_HEADING:
-                    [[fallthrough]];
                 case IChassis::HEADING_OPTION::TOWARD_GOAL:
                     [[fallthrough]];
                 case IChassis::HEADING_OPTION::TOWARD_GOAL_DRIVE:
                     [[fallthrough]];
                 case IChassis::HEADING_OPTION::TOWARD_GOAL_LAUNCHPAD:
-                    //rotation = Rotation2d(units::angle::degree_t(m_targetFinder.GetTargetAngleD(m_currentChassisPosition)));
+                    chassisHeadingOption = m_headingOption;
                     break;
 
-                case IChassis::HEADING_OPTION::SPECIFIED_ANGLE:
-                    rotation = Rotation2d(units::angle::degree_t(m_heading));
-                    m_chassis.get()->SetTargetHeading(units::angle::degree_t(m_heading));
-                    break;
-
-                case IChassis::HEADING_OPTION::LEFT_INTAKE_TOWARD_BALL:
-                    [[fallthrough]];
-                case IChassis::HEADING_OPTION::RIGHT_INTAKE_TOWARD_BALL:
-                    // TODO: need to get info from camera
-                    rotation = m_desiredState.pose.Rotation();
-                    break;
-                
                 default:
-                    rotation = m_desiredState.pose.Rotation();
                     break;
             }
-            refChassisSpeeds = m_holoController.Calculate(m_currentChassisPosition, 
-                                                          m_desiredState, 
-                                                          m_desiredState.pose.Rotation());
-            m_chassis.get()->Drive(refChassisSpeeds, IChassis::CHASSIS_DRIVE_MODE::ROBOT_ORIENTED, m_headingOption);
+
+            auto desiredHeading = GetDesiredHeading();
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "DrivePathValues: DesiredHeading", desiredHeading.Degrees().to<double>());
+            refChassisSpeeds = m_holoController->Calculate(m_currentChassisPosition, 
+                                                           m_desiredState, 
+                                                           desiredHeading);
+            if (chassisHeadingOption != IChassis::HEADING_OPTION::DEFAULT)
+            {
+                refChassisSpeeds.omega = units::angular_velocity::radians_per_second_t(0.0);
+            }
+
+            // the controller already feeds the path velocity forward; the chassis feeds the path acceleration forward through the
+            // drive motor model (acceleration is along the direction of travel, reversed paths have negative velocities)
+            auto acceleration = m_desiredState.velocity.to<double>() < 0.0 ? -1.0*m_desiredState.acceleration : m_desiredState.acceleration;
+            m_chassis.get()->Drive(refChassisSpeeds, IChassis::CHASSIS_DRIVE_MODE::ROBOT_ORIENTED, chassisHeadingOption, acceleration);
         }
         else
         {
@@ -204,135 +233,146 @@ void DrivePath::Run()
 
 }
 
-bool DrivePath::IsDone() //Default primitive function to determine if the primitive is done running
+unique_ptr<HolonomicDriveController> DrivePath::CreateHoloController() const
 {
+    // only the swerve chassis has a maximum angular acceleration; the others take a second to reach the maximum angular velocity
+    auto maxAngularSpeed = m_chassis.get()->GetMaxAngularSpeed();
+    units::angular_acceleration::radians_per_second_squared_t maxAngularAcceleration = maxAngularSpeed / units::time::second_t(1.0);
+    if (m_chassis.get()->GetType() == IChassis::CHASSIS_TYPE::SWERVE)
+    {
+        auto swerveMaxAngularAcceleration = dynamic_cast<SwerveChassis*>(m_chassis.get())->GetMaxAngularAcceleration();
+        maxAngularAcceleration = swerveMaxAngularAcceleration.to<double>() > 0.0 ? swerveMaxAngularAcceleration : maxAngularAcceleration;
+    }
 
-    bool isDone = false;
-    string whyDone = ""; //debugging variable that we used to determine why the path was stopping
-    
-    if (!m_trajectoryStates.empty()) //If we have states... 
+    // the heading gain is the one SwerveChassis uses to hold a specified angle (3 degrees per second per degree of error)
+    ProfiledPIDController<units::radian> thetaController{3.0, 0.0, 0.0, TrapezoidProfile<units::radian>::Constraints{maxAngularSpeed, maxAngularAcceleration}};
+    thetaController.EnableContinuousInput(units::angle::radian_t(-std::numbers::pi), units::angle::radian_t(std::numbers::pi));
+    thetaController.Reset(m_chassis.get()->GetPose().Rotation().Radians());
+
+    return make_unique<HolonomicDriveController>(frc2::PIDController{1.5, 0, 0},
+                                                 frc2::PIDController{1.5, 0, 0},
+                                                 thetaController);
+}
+
+Rotation2d DrivePath::GetDesiredHeading() const
+{
+    // pathweaver paths face the way they drive; PathPlanner paths have their own holonomic angle; waypoint paths keep the
+    // heading the robot started with (their spline tangent is the direction of travel)
+    auto pathHeading = m_desiredState.pose.Rotation();
+    if (m_plannerPath != nullptr)
     {
-        auto curPos = m_chassis.get()->GetPose();
-        // allow a time out to be put into the xml
-        auto currentTime = m_timer.get()->Get().to<double>();
-        isDone = currentTime > m_maxTime && m_maxTime > 0.0;
-        if (!isDone)
-        {
-            // Check if the current pose and the trajectory's final pose are the same
-            //isDone = IsSamePose(curPos, m_targetPose, 100.0);
-            if (IsSamePose(curPos, m_targetPose, 100.0))
-            {
-                isDone = true;
-                whyDone = "Current Pose = Trajectory final pose";
-            }
-        }
-        
+        pathHeading = m_plannerCursor.GetHolonomicRotation();
+    }
+    else if (m_generatedPathID > -1)
+    {
+        pathHeading = m_startHeading;
+    }
 
-        
-        if ( !isDone )
+    switch (m_headingOption)
+    {
+        case IChassis::HEADING_OPTION::MAINTAIN:
+            [[fallthrough]];
+        case IChassis::HEADING_OPTION::POLAR_HEADING:
+            // a PathPlanner path says where the robot faces along it, so that is the heading to keep (MAINTAIN is the auton XML default)
+            return m_plannerPath != nullptr ? pathHeading : m_startHeading;
+
+        case IChassis::HEADING_OPTION::SPECIFIED_ANGLE:
+            return Rotation2d(units::angle::degree_t(m_heading));
+
+        case IChassis::HEADING_OPTION::TOWARD_GOAL:
+            [[fallthrough]];
+        case IChassis::HEADING_OPTION::TOWARD_GOAL_DRIVE:
+            [[fallthrough]];
+        case IChassis::HEADING_OPTION::TOWARD_GOAL_LAUNCHPAD:
+            // the chassis aims at the goal; the theta output isn't used
+            return m_currentChassisPosition.Rotation();
+
+        case IChassis::HEADING_OPTION::LEFT_INTAKE_TOWARD_BALL:
+            [[fallthrough]];
+        case IChassis::HEADING_OPTION::RIGHT_INTAKE_TOWARD_BALL:
+            // TODO: need to get info from camera
+            [[fallthrough]];
+        default:
+            return pathHeading;
+    }
+}
+
+bool DrivePath::IsDone() //Default primitive function to determine if the primitive is done running
+{
+    if (HasTrajectory()) //If we have states... 
+    {
+        if (m_completionReason == PathCompletion::NOT_DONE)
         {
-            // Now check if the current pose is getting closer or farther from the target pose 
-            auto trans = m_targetPose - curPos;
-            auto thisDeltaX = trans.X().to<double>();
-            auto thisDeltaY = trans.Y().to<double>();
-            if (abs(thisDeltaX) < m_deltaX && abs(thisDeltaY) < m_deltaY)
-            {   // Getting closer so just update the deltas
-                m_deltaX = thisDeltaX;
-                m_deltaY = thisDeltaY;
-            }
-            else
-            {   // Getting farther away:  determine if it is because of the path curvature (not straight line between start and the end)
-                // or because we went past the target (in this case, we are done)
-                // Assume that once we get within a third of a meter (just under 12 inches), if we get
-                // farther away we are passing the target, so we should stop.  Otherwise, keep trying.
-                isDone = ((abs(m_deltaX) < 0.3&& abs(m_deltaY) < 0.3));  //These values were updated to .3 from .1
-                if ((abs(m_deltaX) < 0.3 && abs(m_deltaY) < 0.3))
-                {
-                    whyDone = "Within 12 inches of target or getting farther away from target";
-                }
-            }
-        }       
- 
-        if (m_PosChgTimer.get()->Get() > 1_s)//This if statement makes sure that we aren't checking for position change right at the start
-        {                                    //caused problems that would signal we are done when the path hasn't started
-            auto moving = !IsSamePose(curPos, m_PrevPos, 7.5);
-            if (!moving && m_wasMoving)  //If we aren't moving and last state we were moving, then...
+            // Run already updated the pose and the desired state this cycle
+            m_completionReason = m_completion.Update(units::time::second_t(m_timer.get()->Get()), m_currentChassisPosition, m_desiredState);
+            if (m_completionReason != PathCompletion::NOT_DONE)
             {
-                    isDone = true;
-                    whyDone = "Stopped moving";                    
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, string("Done"), string("True"));
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, string("WhyDone"), string(PathCompletion::GetReasonName(m_completionReason)));
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, string("Cross Track Error (m)"), m_completion.GetCrossTrackError().to<double>());
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, string("Along Track Error (m)"), m_completion.GetAlongTrackError().to<double>());
             }
-            m_PrevPos = curPos;
-            m_wasMoving = moving;
-        }
-
-        // finally, do it based on time (we have no more states);  if we want to keep 
-        // going, we need to understand where in the trajectory we are, so we can generate
-        // a new state.
-        if (!isDone)
-        {
-            //return (units::second_t(m_timer.get()->Get()) >= m_trajectory.TotalTime()); 
         }
+        return m_completionReason != PathCompletion::NOT_DONE;
     }
-    else
+    else if (m_generatedPathID > -1 && WaypointPathGenerator::GetWaypointPathGenerator()->IsPending(m_generatedPathID))
     {
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "Done", "True");
-        return true;
+        return false;
     }
-    if (isDone)
-    {   //debugging
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "Done", "True");
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "WhyDone", whyDone);
-    }
-    return isDone;
-    
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "Done", "True");
+    return true;
 }
 
-bool DrivePath::IsSamePose(frc::Pose2d lCurPos, frc::Pose2d lPrevPos, double tolerance) //position checking functions
+void DrivePath::GetTrajectory //Looks up the pathweaver trajectory (a series of states that we can drive the robot to) in the cache
+(
+    string  path
+)
 {
-    // Detect if the two poses are the same within a tolerance
-    double dCurPosX = lCurPos.X().to<double>() * 1000; //cm
-    double dCurPosY = lCurPos.Y().to<double>() * 1000;
-    double dPrevPosX = lPrevPos.X().to<double>() * 1000;
-    double dPrevPosY = lPrevPos.Y().to<double>() * 1000;
+    if (!path.empty()) // only go if path name found
+    {
+        // The paths in deploy/paths are parsed while disabled, so this is just a lookup
+        m_trajectory = TrajectoryCache::GetTrajectoryCache()->GetTrajectory(path);
+        m_cursor.SetTrajectory(m_trajectory);
 
-    double dDeltaX = abs(dPrevPosX - dCurPosX);
-    double dDeltaY = abs(dPrevPosY - dCurPosY);
+        if (m_trajectory != nullptr)
+        {
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, string("DrivePath - Loaded = "), path);
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "DrivePathValues: TrajectoryTotalTime", m_trajectory->TotalTime().to<double>());
+        }
+    }
 
-    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "DrivePathValues: iDeltaX", to_string(dDeltaX));
-    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "DrivePathValues: iDeltaY", to_string(dDeltaY));
+}
 
-    //  If Position of X or Y has moved since last scan..  Using Delta X/Y
-    return (dDeltaX <= tolerance && dDeltaY <= tolerance);
+void DrivePath::GetGeneratedTrajectory()
+{
+    m_trajectory = WaypointPathGenerator::GetWaypointPathGenerator()->GetTrajectory(m_generatedPathID);
+    m_cursor.SetTrajectory(m_trajectory);
 }
 
-void DrivePath::GetTrajectory //Parses pathweaver json to create a series of points that we can drive the robot to
+void DrivePath::GetPlannerPath
 (
-    string  path
+    PrimitiveParams*    params
 )
 {
-    if (!path.empty()) // only go if path name found
+    // PathPlanner paths in deploy/pathplanner are read while disabled too; the spline is evaluated as the path is driven
+    m_plannerPath = TrajectoryCache::GetTrajectoryCache()->GetPlannerPath(params->GetPathName());
+    if (m_plannerPath != nullptr)
     {
-        // Read path into trajectory for deploy directory.  JSON File ex. Bounce1.wpilid.json
-        //wpi::SmallString<64> deployDir;  //creates a string variable
-        //frc::filesystem::GetDeployDirectory(deployDir);  //grabs the deploy directory: "/lvuser/deploy" on roborio
-        //wpi::sys::path::append(deployDir, "paths");  //goes into "/lvuser/deploy/paths" on roborio
-        //wpi::sys::path::append(deployDir, path); // load path from deploy directory
-    	auto deployDir = frc::filesystem::GetDeployDirectory();
-        deployDir += "/paths/" + path;
-
-        m_trajectory = frc::TrajectoryUtil::FromPathweaverJson(deployDir);
-
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, string("Deploy path is "), deployDir.c_str()); //Debugging
-        
-        //This doesn't work, gives parsing error
-        m_trajectory = frc::TrajectoryUtil::FromPathweaverJson(deployDir);  //Creates a trajectory or path that can be used in the code, parsed from pathweaver json
-        //m_trajectory = frc::TrajectoryUtil::FromPathweaverJson("/home/lvuser/deploy/paths/5Ball1.wpilib.json"); //This is a temporary fix
-        m_trajectoryStates = m_trajectory.States();  //Creates a vector of all the states or "waypoints" the robot needs to get to
-        
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, string("DrivePath - Loaded = "), path);
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "DrivePathValues: TrajectoryTotalTime", m_trajectory.TotalTime().to<double>());
+        // limits from the primitive win over the ones saved in the .path file; both are limited to what the chassis can do
+        auto maxVelocity = params->GetWaypointPath().maxVelocity.to<double>() > 0.0 ? params->GetWaypointPath().maxVelocity : m_plannerPath->GetMaxVelocity();
+        auto maxAcceleration = params->GetWaypointPath().maxAcceleration.to<double>() > 0.0 ? params->GetWaypointPath().maxAcceleration : m_plannerPath->GetMaxAcceleration();
+        WaypointPathGenerator::ApplyChassisLimits(maxVelocity, maxAcceleration);
+        m_plannerCursor.SetPath(m_plannerPath, maxVelocity, maxAcceleration);
+        m_plannerPath = m_plannerCursor.IsValid() ? m_plannerPath : nullptr;
+
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, string("DrivePath - Loaded = "), params->GetPathName());
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, "DrivePathValues: TrajectoryTotalTime", m_plannerCursor.GetTotalTime().to<double>());
     }
+}
 
+bool DrivePath::HasTrajectory() const
+{
+    return (m_trajectory != nullptr && !m_trajectory->States().empty()) || m_plannerPath != nullptr;
 }
 
 void DrivePath::CalcCurrentAndDesiredStates()
@@ -340,7 +380,24 @@ void DrivePath::CalcCurrentAndDesiredStates()
     m_currentChassisPosition = m_chassis.get()->GetPose(); //Grabs current pose / position
     auto sampleTime = units::time::second_t(m_timer.get()->Get()); //+ 0.02  //Grabs the time that we should sample a state from
 
-    m_desiredState = m_trajectory.Sample(sampleTime); //Gets the target state based on the current time
+    if (m_plannerPath != nullptr)
+    {
+        m_desiredState = m_plannerCursor.Sample(sampleTime); //Evaluates the PathPlanner segment we are on at the current time
+
+        // event markers the path went past set their mechanism states
+        for (auto names = m_plannerCursor.GetNextMarker(); names != nullptr; names = m_plannerCursor.GetNextMarker())
+        {
+            for (auto& name : *names)
+            {
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_ntName, string("Event Marker"), name);
+                StateMgrHelper::SetMechanismStateFromName(name);
+            }
+        }
+    }
+    else
+    {
+        m_desiredState = m_cursor.Sample(sampleTime); //Gets the target state based on the current time (steps forward from the last sample)
+    }
 
     // May need to do our own sampling based on position and time     
 
@@ -18,7 +18,11 @@
 #include <memory>
 
 //Team302 Includes
+#include <auton/PathCompletion.h>
+#include <auton/PathPlannerCursor.h>
+#include <auton/PathPlannerPath.h>
 #include <auton/PrimitiveParams.h>
+#include <auton/TrajectoryCursor.h>
 #include <auton/drivePrimitives/IPrimitive.h>
 #include <chassis/ChassisFactory.h>
 #include <chassis/IChassis.h>
@@ -28,6 +32,7 @@
 #include <frc/controller/RamseteController.h>
 #include <frc/Filesystem.h>
 #include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
 #include <frc/Timer.h>
 #include <frc/trajectory/TrajectoryConfig.h>
 #include <frc/trajectory/TrajectoryUtil.h>
@@ -51,34 +56,45 @@ public:
     bool IsDone() override;
 
 private:
-    bool IsSamePose(frc::Pose2d, frc::Pose2d, double tolerance); // routine to check for motion
     void GetTrajectory(std::string  path);
+    void GetGeneratedTrajectory();
+    void GetPlannerPath(PrimitiveParams* params);
+    void StartTrajectory();
+    bool HasTrajectory() const;
     void CalcCurrentAndDesiredStates();
 
+    /// @brief heading controller for a new path:  the theta profile is limited by the chassis maximum angular velocity and
+    ///        acceleration and starts from the current heading
+    std::unique_ptr<frc::HolonomicDriveController> CreateHoloController() const;
+
+    /// @brief heading the theta controller turns the robot to this cycle for the primitive's heading option
+    frc::Rotation2d GetDesiredHeading() const;
+
 
 
     std::shared_ptr<IChassis>               m_chassis;
     std::unique_ptr<frc::Timer>             m_timer;
 
     frc::Pose2d                             m_currentChassisPosition;
-    frc::Trajectory                         m_trajectory;
+    const frc::Trajectory*                  m_trajectory;       // owned by the TrajectoryCache
+    TrajectoryCursor                        m_cursor;           // samples m_trajectory in place as the timer advances
+    const PathPlannerPath*                  m_plannerPath;      // owned by the TrajectoryCache; used instead of m_trajectory for .path files
+    PathPlannerCursor                       m_plannerCursor;
     bool                                    m_runHoloController;
-    bool                                    m_wasMoving;
     frc::RamseteController                  m_ramseteController;
-    frc::HolonomicDriveController           m_holoController;
-    frc::Pose2d                             m_PrevPos;          // previous position of robot for compare to current position.
-    std::unique_ptr<frc::Timer>             m_PosChgTimer;      // scan time for position change
+    std::unique_ptr<frc::HolonomicDriveController>  m_holoController;   // created for each path so its heading profile starts fresh
     int                                     m_timesRun;
-    frc::Pose2d                             m_targetPose;
     std::string                             m_pathname;
-    double                                  m_deltaX;
-    double                                  m_deltaY;
-    std::vector<frc::Trajectory::State>     m_trajectoryStates;
     frc::Trajectory::State                  m_desiredState;
     IChassis::HEADING_OPTION                m_headingOption;
     double                                  m_heading;
     double                                  m_maxTime;
+    PathCompletion                          m_completion;       // decides when the path is finished
+    PathCompletion::COMPLETION_REASON       m_completionReason;
     std::string                             m_ntName;
+    int                                     m_generatedPathID;  // WaypointPathGenerator id for a waypoint path
+    frc::Rotation2d                         m_startHeading;     // robot heading when the path started; waypoint paths hold it
+    bool                                    m_ownsGeneratedPath;
 
  
 };
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include <frc/Filesystem.h>
 
 //Team 302 includes
+#include <auton/TrajectoryCache.h>
 #include <auton/drivePrimitives/ResetPosition.h>
 #include <auton/PrimitiveParams.h>
 #include <auton/drivePrimitives/IPrimitive.h>
@@ -38,19 +39,29 @@ void ResetPosition::Init(PrimitiveParams* params)
 {
     string pathToLoad = params->GetPathName();
 
-    if (pathToLoad != "")
+    // PathPlanner paths start at the first waypoint facing its holonomic angle
+    if (TrajectoryCache::IsPlannerPath(pathToLoad))
     {
- 	    auto deployDir = frc::filesystem::GetDeployDirectory();
-        deployDir += "/paths/" + pathToLoad;
-        m_trajectory = frc::TrajectoryUtil::FromPathweaverJson(deployDir);
+        auto path = TrajectoryCache::GetTrajectoryCache()->GetPlannerPath(pathToLoad);
+        if (path != nullptr)
+        {
+            m_chassis->ResetPose(path->GetStartPose());
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Reset Position"), string("Auton Info: ResetPosX"), m_chassis.get()->GetPose().X().to<double>());
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Reset Position"), string("Auton Info: ResetPosY"), m_chassis.get()->GetPose().Y().to<double>());
+        }
+        return;
+    }
 
-        m_chassis->ResetPose(m_trajectory.InitialPose());
+    auto trajectory = pathToLoad.empty() ? nullptr : TrajectoryCache::GetTrajectoryCache()->GetTrajectory(pathToLoad);
+    if (trajectory != nullptr)
+    {
+        m_chassis->ResetPose(trajectory->InitialPose());
 
         Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Reset Position"), string("Auton Info: ResetPosX"), m_chassis.get()->GetPose().X().to<double>());
         Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Reset Position"), string("Auton Info: ResetPosY"), m_chassis.get()->GetPose().Y().to<double>());
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Reset Position"), string("Auton Info: InitialPoseX"), m_trajectory.InitialPose().X().to<double>());
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Reset Position"), string("Auton Info: InitialPoseY"), m_trajectory.InitialPose().Y().to<double>());
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Reset Position"), string("Auton Info: InitialPoseOmega"), m_trajectory.InitialPose().Rotation().Degrees().to<double>());
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Reset Position"), string("Auton Info: InitialPoseX"), trajectory->InitialPose().X().to<double>());
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Reset Position"), string("Auton Info: InitialPoseY"), trajectory->InitialPose().Y().to<double>());
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Reset Position"), string("Auton Info: InitialPoseOmega"), trajectory->InitialPose().Rotation().Degrees().to<double>());
         
     }
 }
@@ -46,5 +46,4 @@ class ResetPosition : public IPrimitive
     
     private:
         std::shared_ptr<IChassis> m_chassis;
-        frc::Trajectory                m_trajectory;
 };
\ No newline at end of file
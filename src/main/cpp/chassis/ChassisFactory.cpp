@@ -193,7 +193,8 @@ std::shared_ptr<SwerveModule> ChassisFactory::CreateSwerveModule
     double                                                      turnPeakVal,
     double                                                      turnMaxAcc,
     double                                                      turnCruiseVel,
-    double                                                      countsOnTurnEncoderPerDegreesOnAngleSensor
+    double                                                      countsOnTurnEncoderPerDegreesOnAngleSensor,
+    SwerveModule::TURN_FEEDBACK                                 turnFeedback
 )
 {
     std::shared_ptr<SwerveModule> swerve = nullptr;
@@ -217,7 +218,8 @@ std::shared_ptr<SwerveModule> ChassisFactory::CreateSwerveModule
                                                         turnPeakVal,
                                                         turnMaxAcc,
                                                         turnCruiseVel,
-                                                        countsOnTurnEncoderPerDegreesOnAngleSensor );
+                                                        countsOnTurnEncoderPerDegreesOnAngleSensor,
+                                                        turnFeedback );
             }
             swerve = m_leftFront;
             break;
@@ -237,7 +239,8 @@ std::shared_ptr<SwerveModule> ChassisFactory::CreateSwerveModule
                                                         turnPeakVal,
                                                         turnMaxAcc,
                                                         turnCruiseVel,
-                                                        countsOnTurnEncoderPerDegreesOnAngleSensor );
+                                                        countsOnTurnEncoderPerDegreesOnAngleSensor,
+                                                        turnFeedback );
             }
             swerve = m_leftBack;
 
@@ -258,7 +261,8 @@ std::shared_ptr<SwerveModule> ChassisFactory::CreateSwerveModule
                                                          turnPeakVal,
                                                          turnMaxAcc,
                                                          turnCruiseVel,
-                                                         countsOnTurnEncoderPerDegreesOnAngleSensor );
+                                                         countsOnTurnEncoderPerDegreesOnAngleSensor,
+                                                         turnFeedback );
            }
             swerve = m_rightFront;
             break;
@@ -278,7 +282,8 @@ std::shared_ptr<SwerveModule> ChassisFactory::CreateSwerveModule
                                                         turnPeakVal,
                                                         turnMaxAcc,
                                                         turnCruiseVel,
-                                                        countsOnTurnEncoderPerDegreesOnAngleSensor );
+                                                        countsOnTurnEncoderPerDegreesOnAngleSensor,
+                                                        turnFeedback );
             }            
             swerve = m_rightBack;
             break;
@@ -110,7 +110,8 @@ class ChassisFactory
 				double                                                      turnPeakVal,
 				double                                                      turnMaxAcc,
 				double                                                      turnCruiseVel,
-				double														countsOnTurnEncoderPerDegreesOnAngleSensor
+				double														countsOnTurnEncoderPerDegreesOnAngleSensor,
+				SwerveModule::TURN_FEEDBACK									turnFeedback
 			);
 			std::shared_ptr<SwerveModule>	GetLeftFrontSwerveModule() { return m_leftFront; }
 			std::shared_ptr<SwerveModule> GetLeftBackSwerveModule() { return m_leftBack; }
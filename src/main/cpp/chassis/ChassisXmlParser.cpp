@@ -42,6 +42,7 @@
 #include <hw/interfaces/IDragonMotorController.h>
 #include <hw/usages/IDragonMotorControllerMap.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 #include <chassis/ChassisXmlParser.h>
 #include <hw/xml/MotorXmlParser.h>
 #include <chassis/swerve/SwerveModuleXmlParser.h>
@@ -88,136 +89,149 @@ IChassis* ChassisXmlParser::ParseXML
     // process attributes
     for (xml_attribute attr = chassisNode.first_attribute(); attr && !hasError; attr = attr.next_attribute())
     {
-        string attrName (attr.name());
-        if ( attrName.compare("type") == 0 )
+        switch ( XmlName::Hash( attr.name() ) )
         {
-            auto val = string( attr.value() );
-            if ( val.compare( "MECANUM") == 0 )
+            case XmlName::Hash( "type" ):
             {
-                type = ChassisFactory::CHASSIS_TYPE::MECANUM_CHASSIS;
+                auto val = string( attr.value() );
+                if ( val.compare( "MECANUM") == 0 )
+                {
+                    type = ChassisFactory::CHASSIS_TYPE::MECANUM_CHASSIS;
+                }
+                else if ( val.compare( "TANK" ) == 0 )
+                {
+                    type = ChassisFactory::CHASSIS_TYPE::TANK_CHASSIS;
+                }
+                else if (val.compare("SWERVE") == 0)
+                {
+                    type = ChassisFactory::CHASSIS_TYPE::SWERVE_CHASSIS;
+                }
+                else
+                {
+                    string msg = "Unknown Chassis Type";
+                    msg += attr.value();
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ChasssiXmlParser"), string( "ParseXML" ), msg );
+                }
+                break;
             }
-            else if ( val.compare( "TANK" ) == 0 )
-            {
-                type = ChassisFactory::CHASSIS_TYPE::TANK_CHASSIS;
-            }
-            else if (val.compare("SWERVE") == 0)
-            {
-                type = ChassisFactory::CHASSIS_TYPE::SWERVE_CHASSIS;
-            }
-            else
-            {
-                string msg = "Unknown Chassis Type";
-                msg += attr.value();
-                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ChasssiXmlParser"), string( "ParseXML" ), msg );
-            }
-        }
-        else if (  attrName.compare("wheelBase") == 0 )
-        {
-        	wheelBase = units::length::inch_t(attr.as_double());
-        }
-        else if (  attrName.compare("track") == 0 )
-        {
-        	track = units::length::inch_t(attr.as_double());
-        }
-        else if (  attrName.compare("maxVelocity") == 0 )
-        {
-            units::velocity::feet_per_second_t fps(attr.as_double()/12.0);
-        	maxVelocity = units::velocity::meters_per_second_t(fps);
-        }
-        else if (  attrName.compare("maxAngularVelocity") == 0 )
-        {
-            units::degrees_per_second_t degreesPerSec(attr.as_double());
-        	maxAngularSpeed = units::radians_per_second_t(degreesPerSec);
-        }
-        else if (  attrName.compare("maxAcceleration") == 0 )
-        {
-            maxAcceleration = units::feet_per_second_t(attr.as_double()/12.0) / 1_s;
-        }
-        else if (  attrName.compare("maxAngularAcceleration") == 0 )
-        {
-            maxAngularAcceleration = units::degrees_per_second_t(attr.as_double()) / 1_s;
-        }
-        else if (  attrName.compare("wheelDiameter") == 0 )
-        {
-        	wheelDiameter = units::length::inch_t(attr.as_double());
-        }
-        else if ( attrName.compare("odometryComplianceCoefficient") == 0 )
-        {
-            odometryComplianceCoefficient = attr.as_double();
-        }
-        else if (attrName.compare("networkTable") == 0)
-        {
-            networkTableName = attr.as_string();
-        }
-        else if (attrName.compare("controlFile") == 0)
-        {
-            controlFileName = attr.as_string();
-        }
-        /** TODO: remove this is unused **/
-        else if (attrName.compare("wheelSpeedCalcOption") ==0)
-        {
-            /**
-            auto val = string( attr.value() );
-            if (val.compare( "WPI") == 0)
-            {
-                speedCalcOption = ChassisSpeedCalcEnum::WPI_METHOD;
-            }
-            else if (val.compare("ETHER") == 0)
-            {
-                speedCalcOption = ChassisSpeedCalcEnum::ETHER;
-            }
-            else if (val.compare("ETHER") == 0)
-            {
-                speedCalcOption = ChassisSpeedCalcEnum::ETHER;
-            }
-            else
-            {
-                string msg = "unknown Chassis Speed Calc Option ";
-                msg += val;
-                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ChassisXmlParser::ParseXML"), msg );
-                hasError = true;
-            }
-            **/
-        }
-        /** **/
-        else if (attrName.compare("poseEstimationOption") ==0)
-        {
-            auto val = string( attr.value() );
-            if (val.compare( "WPI") == 0)
-            {
-                poseEstOption = PoseEstimatorEnum::WPI;
-            }
-            else if (val.compare("EULERCHASSIS") == 0)
+
+            case XmlName::Hash( "wheelBase" ):
+                wheelBase = units::length::inch_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "track" ):
+                track = units::length::inch_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "maxVelocity" ):
             {
-                poseEstOption = PoseEstimatorEnum::EULER_AT_CHASSIS;
+                units::velocity::feet_per_second_t fps(attr.as_double()/12.0);
+                maxVelocity = units::velocity::meters_per_second_t(fps);
+                break;
             }
-            else if (val.compare("EULERWHEEL") == 0)
+
+            case XmlName::Hash( "maxAngularVelocity" ):
             {
-                poseEstOption = PoseEstimatorEnum::EULER_USING_MODULES;
+                units::degrees_per_second_t degreesPerSec(attr.as_double());
+                maxAngularSpeed = units::radians_per_second_t(degreesPerSec);
+                break;
             }
-            else if (val.compare("POSECHASSIS") == 0)
+
+            case XmlName::Hash( "maxAcceleration" ):
+                maxAcceleration = units::feet_per_second_t(attr.as_double()/12.0) / 1_s;
+                break;
+
+            case XmlName::Hash( "maxAngularAcceleration" ):
+                maxAngularAcceleration = units::degrees_per_second_t(attr.as_double()) / 1_s;
+                break;
+
+            case XmlName::Hash( "wheelDiameter" ):
+                wheelDiameter = units::length::inch_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "odometryComplianceCoefficient" ):
+                odometryComplianceCoefficient = attr.as_double();
+                break;
+
+            case XmlName::Hash( "networkTable" ):
+                networkTableName = attr.as_string();
+                break;
+
+            case XmlName::Hash( "controlFile" ):
+                controlFileName = attr.as_string();
+                break;
+
+            /** TODO: remove this is unused **/
+            case XmlName::Hash( "wheelSpeedCalcOption" ):
             {
-                poseEstOption = PoseEstimatorEnum::POSE_EST_AT_CHASSIS;
+                /**
+                auto val = string( attr.value() );
+                if (val.compare( "WPI") == 0)
+                {
+                    speedCalcOption = ChassisSpeedCalcEnum::WPI_METHOD;
+                }
+                else if (val.compare("ETHER") == 0)
+                {
+                    speedCalcOption = ChassisSpeedCalcEnum::ETHER;
+                }
+                else if (val.compare("ETHER") == 0)
+                {
+                    speedCalcOption = ChassisSpeedCalcEnum::ETHER;
+                }
+                else
+                {
+                    string msg = "unknown Chassis Speed Calc Option ";
+                    msg += val;
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ChassisXmlParser::ParseXML"), msg );
+                    hasError = true;
+                }
+                **/
+                break;
             }
-            else if (val.compare("POSEWHEEL") == 0)
+
+            /** **/
+            case XmlName::Hash( "poseEstimationOption" ):
             {
-                poseEstOption = PoseEstimatorEnum::POSE_EST_USING_MODULES;
+                auto val = string( attr.value() );
+                if (val.compare( "WPI") == 0)
+                {
+                    poseEstOption = PoseEstimatorEnum::WPI;
+                }
+                else if (val.compare("EULERCHASSIS") == 0)
+                {
+                    poseEstOption = PoseEstimatorEnum::EULER_AT_CHASSIS;
+                }
+                else if (val.compare("EULERWHEEL") == 0)
+                {
+                    poseEstOption = PoseEstimatorEnum::EULER_USING_MODULES;
+                }
+                else if (val.compare("POSECHASSIS") == 0)
+                {
+                    poseEstOption = PoseEstimatorEnum::POSE_EST_AT_CHASSIS;
+                }
+                else if (val.compare("POSEWHEEL") == 0)
+                {
+                    poseEstOption = PoseEstimatorEnum::POSE_EST_USING_MODULES;
+                }
+                else
+                {
+                    string msg = "unknown Chassis Pose Estimation Option ";
+                    msg += val;
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ChassisXmlParser"),string("ParseXML"), msg );
+                    hasError = true;
+                }
+                break;
             }
-            else
+
+            default:  // log errors
             {
-                string msg = "unknown Chassis Pose Estimation Option ";
-                msg += val;
-                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ChassisXmlParser"),string("ParseXML"), msg );
+                string msg = "unknown attribute ";
+                msg += attr.name();
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ChassisXmlParser"), string("ParseXML"), msg );
                 hasError = true;
+                break;
             }
         }
-        else   // log errors
-        {
-            string msg = "unknown attribute ";
-            msg += attr.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ChassisXmlParser"), string("ParseXML"), msg );
-            hasError = true;
-        }
     }
 
 
@@ -234,46 +248,53 @@ IChassis* ChassisXmlParser::ParseXML
 
     for (xml_node child = chassisNode.first_child(); child; child = child.next_sibling())
     {
-        string childName (child.name());
-      	if (childName.compare("motor") == 0)
-    	{
-            auto motor = motorXML.get()->ParseXML(networkTableName, child);
-            if ( motor.get() != nullptr )
+        switch ( XmlName::Hash( child.name() ) )
+        {
+            case XmlName::Hash( "motor" ):
+            {
+                auto motor = motorXML.get()->ParseXML(networkTableName, child);
+                if ( motor.get() != nullptr )
+                {
+                    motors[ motor.get()->GetType() ] =  motor ;
+                }
+                break;
+            }
+
+            case XmlName::Hash( "swervemodule" ):
             {
-                motors[ motor.get()->GetType() ] =  motor ;
+                shared_ptr<SwerveModule> module = moduleXML.get()->ParseXML(networkTableName, child);
+                switch ( module.get()->GetType() )
+                {
+                    case SwerveModule::ModuleID::LEFT_FRONT:
+                        lfront = module;
+                        break;
+
+                    case SwerveModule::ModuleID::LEFT_BACK:
+                        lback = module;
+                        break;
+
+                    case SwerveModule::ModuleID::RIGHT_FRONT:
+                        rfront = module;
+                        break;
+
+                    case SwerveModule::ModuleID::RIGHT_BACK:
+                        rback = module;
+                        break;
+
+                    default:
+                        break;
+                }
+                break;
             }
-    	}        
-    	else if (childName.compare("swervemodule") == 0)
-    	{
-            shared_ptr<SwerveModule> module = moduleXML.get()->ParseXML(networkTableName, child);
-            switch ( module.get()->GetType() )
+
+            default:  // log errors
             {
-                case SwerveModule::ModuleID::LEFT_FRONT:
-                    lfront = module;
-                    break;
-
-                case SwerveModule::ModuleID::LEFT_BACK:
-                    lback = module;
-                    break;
-
-                case SwerveModule::ModuleID::RIGHT_FRONT:
-                    rfront = module;
-                    break;
-                
-                case SwerveModule::ModuleID::RIGHT_BACK:
-                    rback = module;
-                    break;
-
-                default:
-                    break;
+                string msg = "unknown child ";
+                msg += child.name();
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("SwerveChassisXmlParser"), string("ParseXML"), msg );
+                break;
             }
-    	}
-    	else  // log errors
-    	{
-            string msg = "unknown child ";
-            msg += child.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("SwerveChassisXmlParser"), string("ParseXML"), msg );
-    	}
+        }
     }
 
 
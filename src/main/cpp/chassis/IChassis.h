@@ -21,6 +21,8 @@
 
 // FRC includes
 #include <frc/geometry/Pose2d.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <units/acceleration.h>
 #include <units/angle.h>
 #include <units/length.h>
 #include <units/velocity.h>
@@ -33,10 +35,6 @@
 // Third Party Includes
 
 
-namespace frc
-{
-    struct ChassisSpeeds;
-}
 
 
 ///	 @interface IChassis
@@ -91,6 +89,20 @@ class IChassis
         ) = 0;
         
 
+        /// @brief      Run chassis with the acceleration along the direction of travel for the drive feedforward
+        ///             (chassis without a drive motor model ignore the acceleration)
+        /// @returns    void
+        virtual void Drive
+        (
+            frc::ChassisSpeeds                                  chassisSpeeds,
+            CHASSIS_DRIVE_MODE                                  mode,
+            HEADING_OPTION                                      headingOption,
+            units::acceleration::meters_per_second_squared_t    acceleration
+        ) 
+        {
+            Drive(chassisSpeeds, mode, headingOption);
+        }
+
         virtual void SetTargetHeading(units::angle::degree_t targetYaw) = 0;
         
         virtual void Initialize() = 0;
@@ -165,9 +165,11 @@ void MecanumChassis::ZeroEncoder(shared_ptr<IDragonMotorController> controller)
 {
     if (controller.get() != nullptr)
     {
-        auto motor = controller.get()->GetSpeedController();
-        auto talon = dynamic_cast<WPI_TalonSRX*>(motor.get());
-        talon->SetSelectedSensorPosition(0,0);
+        auto talon = controller.get()->GetTalonSRX();
+        if (talon != nullptr)
+        {
+            talon->SetSelectedSensorPosition(0,0);
+        }
     }
 }
 
@@ -21,6 +21,7 @@
 
 // FRC includes
 #include <frc/DriverStation.h>
+#include <frc/Timer.h>
 #include <frc/geometry/Pose2d.h>
 #include <frc/geometry/Rotation2d.h>
 #include <frc/geometry/Transform2d.h>
@@ -31,16 +32,17 @@
 #include <units/angular_acceleration.h>
 #include <units/angular_velocity.h>
 #include <units/length.h>
+#include <units/math.h>
 #include <units/velocity.h>
 
 // Team 302 includes
 #include <chassis/PoseEstimatorEnum.h>
 #include <chassis/swerve/SwerveChassis.h>
-#include <hw/DragonLimelight.h>
-#include <hw/factories/LimelightFactory.h>
 #include <utils/AngleUtils.h>
 #include <utils/ConversionUtils.h>
 #include <utils/Logger.h>
+#include <vision/DragonVision.h>
+#include <vision/DragonVisionTarget.h>
 
 // Third Party Includes
 #include <ctre/phoenix/sensors/CANCoder.h>
@@ -113,9 +115,16 @@ SwerveChassis::SwerveChassis
     m_storedYaw(m_pigeon->GetYaw()),
     m_yawCorrection(units::angular_velocity::degrees_per_second_t(0.0)),
     m_targetHeading(units::angle::degree_t(0)),
-    m_limelight(LimelightFactory::GetLimelightFactory()->GetLimelight()),
+    m_vision(DragonVision::GetDragonVision()),
     m_networkTableName(networkTableName),
-    m_controlFileName(controlFileName)
+    m_controlFileName(controlFileName),
+    m_setpointGenerator(maxAcceleration, {frontLeft.get()->GetMaxSteerRate(), 
+                                          frontRight.get()->GetMaxSteerRate(), 
+                                          backLeft.get()->GetMaxSteerRate(), 
+                                          backRight.get()->GetMaxSteerRate()}),
+    m_driveAcceleration(units::acceleration::meters_per_second_squared_t(0.0)),
+    m_lastSetpointTime(units::time::second_t(0.0)),
+    m_slipDetector(m_kinematics, {m_frontLeftLocation, m_frontRightLocation, m_backLeftLocation, m_backRightLocation})
 {
     frontLeft.get()->Init( wheelDiameter, maxSpeed, maxAngularSpeed, maxAcceleration, maxAngularAcceleration, m_frontLeftLocation );
     frontRight.get()->Init( wheelDiameter, maxSpeed, maxAngularSpeed, maxAcceleration, maxAngularAcceleration, m_frontRightLocation );
@@ -159,6 +168,24 @@ void SwerveChassis::Drive(frc::ChassisSpeeds chassisSpeeds)
 {
     Drive(chassisSpeeds, CHASSIS_DRIVE_MODE::FIELD_ORIENTED, HEADING_OPTION::MAINTAIN);
 }
+
+/// @brief Drive the chassis with a feedforward for the acceleration along the direction of travel
+/// @param [in] frc::ChassisSpeeds                  speeds:         kinematics for how to move the chassis
+/// @param [in] CHASSIS_DRIVE_MODE                  mode:           robot or field oriented
+/// @param [in] HEADING_OPTION                      headingOption:  how to control the heading
+/// @param [in] units::meters_per_second_squared_t  acceleration:   acceleration along the direction of travel (e.g. from a trajectory)
+void SwerveChassis::Drive
+(
+    ChassisSpeeds                                       speeds,
+    CHASSIS_DRIVE_MODE                                  mode,
+    HEADING_OPTION                                      headingOption,
+    units::acceleration::meters_per_second_squared_t    acceleration
+)
+{
+    m_driveAcceleration = acceleration;
+    Drive(speeds, mode, headingOption);
+    m_driveAcceleration = units::acceleration::meters_per_second_squared_t(0.0);
+}
 void SwerveChassis::Drive
 ( 
     ChassisSpeeds               speeds, 
@@ -228,6 +255,7 @@ void SwerveChassis::Drive
         m_frontRight.get()->StopMotors();
         m_backLeft.get()->StopMotors();
         m_backRight.get()->StopMotors();
+        m_setpointGenerator.Invalidate();
         m_drive = units::velocity::meters_per_second_t(0.0);
         m_steer = units::velocity::meters_per_second_t(0.0);
         m_rotate = units::angular_velocity::radians_per_second_t(0.0);
@@ -270,10 +298,8 @@ void SwerveChassis::Drive
                 Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: Back Right Angle", br.angle.Degrees().to<double>());
            }
         
-            m_frontLeft.get()->SetDesiredState(fl);
-            m_frontRight.get()->SetDesiredState(fr);
-            m_backLeft.get()->SetDesiredState(bl);
-            m_backRight.get()->SetDesiredState(br); 
+            SwerveSetpointGenerator::ModuleStates setpoints{fl, fr, bl, br};
+            SetModuleSetpoints(setpoints);
         }
         else
         {
@@ -307,10 +333,8 @@ void SwerveChassis::Drive
             }
             //May need to add m_hold = false here if it gets stuck in hold position
             
-            m_frontLeft.get()->SetDesiredState(m_flState);
-            m_frontRight.get()->SetDesiredState(m_frState);
-            m_backLeft.get()->SetDesiredState(m_blState);
-            m_backRight.get()->SetDesiredState(m_brState);
+            SwerveSetpointGenerator::ModuleStates setpoints{m_flState, m_frState, m_blState, m_brState};
+            SetModuleSetpoints(setpoints);
             auto ax = m_accel.GetX();
             auto ay = m_accel.GetY();
             auto az = m_accel.GetZ();
@@ -322,6 +346,56 @@ void SwerveChassis::Drive
     }    
 }
 
+/// @brief limit the module states with the setpoint generator and send them to the modules
+/// @param [in] SwerveSetpointGenerator::ModuleStates&  states: desired module states (FL, FR, BL, BR)
+void SwerveChassis::SetModuleSetpoints
+(
+    SwerveSetpointGenerator::ModuleStates&  states
+)
+{
+    auto now = frc::Timer::GetFPGATimestamp();
+    auto dt = now - m_lastSetpointTime;
+    m_lastSetpointTime = now;
+
+    // holding position locks the wheels in an X with no speed, so send it as is
+    if (m_hold)
+    {
+        m_setpointGenerator.Invalidate();
+    }
+    else
+    {
+        // if the modules were stopped or drive hasn't been called recently, limit against where the modules really are
+        if (!m_setpointGenerator.IsInitialized() || dt > m_maxSetpointPeriod)
+        {
+            m_setpointGenerator.Reset({m_frontLeft.get()->GetState(),
+                                       m_frontRight.get()->GetState(),
+                                       m_backLeft.get()->GetState(),
+                                       m_backRight.get()->GetState()});
+            dt = units::time::second_t(0.02);
+        }
+        m_setpointGenerator.Generate(states, dt);
+    }
+
+    // each wheel gets the share of the path acceleration that matches its share of the chassis speed
+    // (all of it when just translating); wheel speeds that point backwards get it backwards
+    auto linearSpeed = units::velocity::meters_per_second_t(std::hypot(m_drive.to<double>(), m_steer.to<double>()));
+    if (m_hold || units::math::abs(m_driveAcceleration).to<double>() < 0.001 || linearSpeed < m_minFeedforwardSpeed)
+    {
+        m_frontLeft.get()->SetDesiredState(states[0]);
+        m_frontRight.get()->SetDesiredState(states[1]);
+        m_backLeft.get()->SetDesiredState(states[2]);
+        m_backRight.get()->SetDesiredState(states[3]);
+    }
+    else
+    {
+        auto scale = m_driveAcceleration / linearSpeed;
+        m_frontLeft.get()->SetDesiredState(states[0], states[0].speed * scale);
+        m_frontRight.get()->SetDesiredState(states[1], states[1].speed * scale);
+        m_backLeft.get()->SetDesiredState(states[2], states[2].speed * scale);
+        m_backRight.get()->SetDesiredState(states[3], states[3].speed * scale);
+    }
+}
+
 void SwerveChassis::DriveHoldPosition()
 {
     m_hold = true;
@@ -481,17 +555,18 @@ void SwerveChassis::DriveToPointTowardGoal
     auto targetPose = goalPose;
     frc::Pose2d driveToPose;
 
-    auto distanceError = m_shootingDistance - m_limelight->EstimateTargetDistance();
+    auto target = m_vision->GetLatestTarget();
+    if (target != nullptr)
+    { 
+        auto distanceError = m_shootingDistance - target->distance;
 
-    //Finding Target pose on feild based on current position
-    double theta = abs(atan((targetPose.X()-myPose.X()).to<double>()/((targetPose.Y()-myPose.Y()).to<double>())));
-    double xComp = sin(theta)*(m_limelight->EstimateTargetDistance().to<double>() + 24.0)*0.0254;//adding 24 inches offset for the center of goal, converting to meters
-    double yComp = cos(theta)*(m_limelight->EstimateTargetDistance().to<double>() + 24.0)*0.0254;//adding 24 inches offset for the center of goal, converting to meters
+        //Finding Target pose on feild based on current position
+        double theta = abs(atan((targetPose.X()-myPose.X()).to<double>()/((targetPose.Y()-myPose.Y()).to<double>())));
+        double xComp = sin(theta)*(target->distance.to<double>() + 24.0)*0.0254;//adding 24 inches offset for the center of goal, converting to meters
+        double yComp = cos(theta)*(target->distance.to<double>() + 24.0)*0.0254;//adding 24 inches offset for the center of goal, converting to meters
 
-    double speedCorrection = (distanceError.to<double>() < 30.0) ? kPDistance*2.0 : kPDistance;
+        double speedCorrection = (distanceError.to<double>() < 30.0) ? kPDistance*2.0 : kPDistance;
 
-    if (m_limelight != nullptr && m_limelight->HasTarget())
-    { 
         if (abs(distanceError.to<double>()) > 10.0)
         {
             AdjustRotToPointTowardGoal(robotPose, rot);
@@ -546,14 +621,15 @@ void SwerveChassis::AdjustRotToPointTowardGoal
     units::radians_per_second_t &rot     
 )
 {
-    if(abs(m_limelight->GetTargetHorizontalOffset().to<double>()) < 1.0 && m_limelight->HasTarget())
+    auto target = m_vision->GetLatestTarget();
+    if(target != nullptr && abs(target->horizontalAngle.to<double>()) < 1.0)
     {
         m_hold = true;
     }
-    else if (m_limelight != nullptr && m_limelight->HasTarget())
+    else if (target != nullptr)
     { 
-        double rotCorrection = abs(m_limelight->GetTargetHorizontalOffset().to<double>()) > 10.0 ? kPGoalHeadingControl : kPGoalHeadingControl*2.0;
-        rot += (m_limelight->GetTargetHorizontalOffset())/1_s*rotCorrection;
+        double rotCorrection = abs(target->horizontalAngle.to<double>()) > 10.0 ? kPGoalHeadingControl : kPGoalHeadingControl*2.0;
+        rot += (target->horizontalAngle)/1_s*rotCorrection;
         m_hold = false;   
     }
     else
@@ -587,16 +663,39 @@ void SwerveChassis::UpdateOdometry()
     units::degree_t yaw{m_pigeon->GetYaw()};
     Rotation2d rot2d {yaw}; 
 
+    auto slip = m_slipDetector.Update({m_frontLeft.get()->GetState(),
+                                       m_frontRight.get()->GetState(),
+                                       m_backLeft.get()->GetState(),
+                                       m_backRight.get()->GetState()},
+                                      yaw,
+                                      units::acceleration::standard_gravity_t(m_accel.GetX()),
+                                      units::acceleration::standard_gravity_t(m_accel.GetY()),
+                                      frc::Timer::GetFPGATimestamp());
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("Slip State"), static_cast<int>(slip));
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("Slip Wheel Residual"), m_slipDetector.GetWheelResidual().to<double>());
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("Slip Accel Residual"), m_slipDetector.GetAccelResidual().to<double>());
+
     if (m_poseOpt == PoseEstimatorEnum::WPI)
     {
-        //auto currentPose = m_poseEstimator.GetEstimatedPosition();
-
-        //m_poseEstimator.Update(rot2d, m_frontLeft.get()->GetState(),
-        //                              m_frontRight.get()->GetState(), 
-        //                              m_backLeft.get()->GetState(),
-        //                              m_backRight.get()->GetState());
-
-        //auto updatedPose = m_poseEstimator.GetEstimatedPosition();
+        m_poseEstimator.Update(rot2d, {m_frontLeft.get()->GetPosition(),
+                                       m_frontRight.get()->GetPosition(), 
+                                       m_backLeft.get()->GetPosition(),
+                                       m_backRight.get()->GetPosition()});
+
+        // The estimator's odometry std devs are fixed at construction, so while the wheels disagree with the IMU
+        // the vision std devs are scaled down instead, which shifts the weight the same way.
+        auto visionStdDev = m_visionStdDev * m_slipDetector.GetOdometryTrust();
+        wpi::array<double, 3> visionStdDevs{visionStdDev, visionStdDev, visionStdDev};
+
+        // the vision measurements are time ordered across all of the cameras, so the estimator can replay them in sequence
+        for (auto& measurement : m_vision->GetMeasurements())
+        {
+            if (measurement.hasBotPose)
+            {
+                m_poseEstimator.AddVisionMeasurement(measurement.botPose, measurement.timestamp, visionStdDevs);
+            }
+        }
+        m_pose = m_poseEstimator.GetEstimatedPosition();
     }
     else if (m_poseOpt==PoseEstimatorEnum::EULER_AT_CHASSIS)
     {
@@ -674,8 +773,12 @@ void SwerveChassis::ResetPose
     const Rotation2d&   angle
 )
 {
-    //m_poseEstimator.ResetPosition(pose, angle);
     SetEncodersToZero();
+    m_slipDetector.Reset();
+    m_poseEstimator.ResetPosition(angle, {m_frontLeft.get()->GetPosition(),
+                                          m_frontRight.get()->GetPosition(), 
+                                          m_backLeft.get()->GetPosition(),
+                                          m_backRight.get()->GetPosition()}, pose);
     m_pose = pose;
 
     auto pigeon = PigeonFactory::GetFactory()->GetPigeon(DragonPigeon::PIGEON_USAGE::CENTER_OF_ROBOT);
@@ -40,10 +40,13 @@
 #include <chassis/IChassis.h>
 #include <chassis/PoseEstimatorEnum.h>
 #include <chassis/swerve/SwerveModule.h>
-#include <hw/DragonLimelight.h>
+#include <chassis/swerve/SwerveSetpointGenerator.h>
+#include <chassis/swerve/SwerveSlipDetector.h>
 #include <hw/DragonPigeon.h>
 #include <hw/factories/PigeonFactory.h>
 
+class DragonVision;
+
 class SwerveChassis : public IChassis
 {
     public:
@@ -117,6 +120,19 @@ class SwerveChassis : public IChassis
             frc::ChassisSpeeds            chassisSpeeds
         ) override;
 
+        /// @brief Drive the chassis with a feedforward for the acceleration along the direction of travel
+        /// @param [in] frc::ChassisSpeeds                  speeds:         kinematics for how to move the chassis
+        /// @param [in] CHASSIS_DRIVE_MODE                  mode:           robot or field oriented
+        /// @param [in] HEADING_OPTION                      headingOption:  how to control the heading
+        /// @param [in] units::meters_per_second_squared_t  acceleration:   acceleration along the direction of travel (e.g. from a trajectory)
+        void Drive
+        (
+            frc::ChassisSpeeds                                  speeds,
+            CHASSIS_DRIVE_MODE                                  mode,
+            HEADING_OPTION                                      headingOption,
+            units::acceleration::meters_per_second_squared_t    acceleration
+        ) override;
+
         /// @brief update the chassis odometry based on current states of the swerve modules and the pigeon
         void UpdateOdometry();
 
@@ -195,6 +211,13 @@ class SwerveChassis : public IChassis
             frc::ChassisSpeeds 
         );
 
+        /// @brief limit the module states with the setpoint generator and send them to the modules
+        /// @param [in] SwerveSetpointGenerator::ModuleStates&  states: desired module states (FL, FR, BL, BR)
+        void SetModuleSetpoints
+        (
+            SwerveSetpointGenerator::ModuleStates&  states
+        );
+
         void AdjustRotToMaintainHeading
         (
             units::meters_per_second_t&  xspeed,
@@ -289,12 +312,21 @@ class SwerveChassis : public IChassis
 
         DragonTargetFinder m_targetFinder;
         units::angle::degree_t m_targetHeading;
-        DragonLimelight*        m_limelight;
+        DragonVision*           m_vision;
 
         std::string             m_networkTableName;
         std::string             m_controlFileName;
 
         const units::length::inch_t m_shootingDistance = units::length::inch_t(105.0); // was 105.0
 
+        const units::time::second_t m_maxSetpointPeriod = units::time::second_t(0.1);   // reseed the setpoints if drive wasn't called for this long
+        SwerveSetpointGenerator     m_setpointGenerator;
+        units::acceleration::meters_per_second_squared_t m_driveAcceleration;  // acceleration along the direction of travel for this Drive call
+        const units::velocity::meters_per_second_t m_minFeedforwardSpeed = units::velocity::meters_per_second_t(0.05);    // below this the wheel share of the acceleration isn't well defined
+        units::time::second_t       m_lastSetpointTime;
+
+        SwerveSlipDetector          m_slipDetector;
+        const double                m_visionStdDev = 0.1;   // matches the vision std devs m_poseEstimator is constructed with
+
 
 };
\ No newline at end of file
@@ -23,6 +23,8 @@
 #include <frc/geometry/Rotation2d.h>
 #include <frc/trajectory/TrapezoidProfile.h>
 #include <frc/controller/PIDController.h>
+#include <frc/RobotController.h>
+#include <frc/Timer.h>
 #include <networktables/NetworkTableInstance.h>
 #include <networktables/NetworkTable.h>
 #include <networktables/NetworkTableEntry.h>
@@ -36,13 +38,17 @@
 #include <chassis/swerve/SwerveChassis.h>
 #include <chassis/swerve/SwerveModule.h>
 #include <hw/DragonCanCoder.h>
+#include <hw/DragonMotorModel.h>
+#include <hw/DragonPowerManager.h>
 #include <mechanisms/controllers/ControlData.h>
 #include <mechanisms/controllers/ControlModes.h>
 #include <utils/AngleUtils.h>
+#include <utils/ConversionUtils.h>
 #include <utils/Logger.h>
 
 // Third Party Includes
 #include <ctre/phoenix/motorcontrol/can/WPI_TalonFX.h>
+#include <ctre/phoenix/motorcontrol/RemoteSensorSource.h>
 #include <ctre/phoenix/sensors/CANCoder.h>
 
 
@@ -58,6 +64,7 @@ using namespace ctre::phoenix::sensors;
 /// @param [in] shared_ptr<IDragonMotorController>                      turnMotor:      Motor that turns the swerve module 
 /// @param [in] DragonCanCoder*                                 		canCoder:       Sensor for detecting the angle of the wheel
 /// @param [in] units::length::inch_t                                   wheelDiameter   Diameter of the wheel
+/// @param [in] TURN_FEEDBACK                                           turnFeedback:   Sensor the turn motor closes its position loop on
 SwerveModule::SwerveModule
 (
     ModuleID                                                    type, 
@@ -72,11 +79,16 @@ SwerveModule::SwerveModule
     double                                                      turnPeakVal,
     double                                                      turnMaxAcc,
     double                                                      turnCruiseVel,
-    double                                                      countsOnTurnEncoderPerDegreesOnAngleSensor
+    double                                                      countsOnTurnEncoderPerDegreesOnAngleSensor,
+    TURN_FEEDBACK                                               turnFeedback
 ) : m_type(type), 
     m_driveMotor(driveMotor), 
     m_turnMotor(turnMotor), 
     m_turnSensor(canCoder), 
+    m_driveTalon(driveMotor.get()->GetTalonFX()),
+    m_driveSensors(driveMotor.get()->GetTalonFXSensors()),
+    m_turnTalon(turnMotor.get()->GetTalonFX()),
+    m_turnSensors(turnMotor.get()->GetTalonFXSensors()),
     m_driveVelocityControlData(new ControlData()),
     m_drivePercentControlData(new ControlData()),
     m_turnPositionControlData(new ControlData(  ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE,
@@ -98,28 +110,37 @@ SwerveModule::SwerveModule
     m_currentSpeed(0.0_rpm),
     m_currentRotations(0.0),
     m_maxVelocity(1_mps),
+    m_maxSteerRate(units::angular_velocity::degrees_per_second_t(1080.0)),
+    m_driveKs(units::voltage::volt_t(0.0)),
+    m_driveKv(0.0),
+    m_driveKa(0.0),
+    m_driveModelMass(units::mass::kilogram_t(0.0)),
+    m_powerHandle(-1),
+    m_driveAcceleration(units::acceleration::meters_per_second_squared_t(0.0)),
     m_runClosedLoopDrive(false),
-    m_countsOnTurnEncoderPerDegreesOnAngleSensor(countsOnTurnEncoderPerDegreesOnAngleSensor)
+    m_countsOnTurnEncoderPerDegreesOnAngleSensor(countsOnTurnEncoderPerDegreesOnAngleSensor),
+    m_turnFeedback(turnFeedback),
+    m_turnSettling(false),
+    m_turnSettleStart(units::time::second_t(0.0)),
+    m_lastTurnSettleTime(units::time::second_t(0.0)),
+    m_maxTurnSettleTime(units::time::second_t(0.0))
 {
     driveMotor.get()->SetFramePeriodPriority(IDragonMotorController::MOTOR_PRIORITY::HIGH);
     turnMotor.get()->SetFramePeriodPriority(IDragonMotorController::MOTOR_PRIORITY::HIGH);
     turnMotor.get()->SetControlConstants(0, m_turnPositionControlData);
+    m_powerHandle = DragonPowerManager::GetPowerManager()->Register(driveMotor, DragonPowerManager::POWER_PRIORITY::DRIVE);
 
     Rotation2d ang { units::angle::degree_t(0.0)};
     m_activeState.angle = ang;
     m_activeState.speed = 0_mps;
     
     // Set up the Drive Motor
-    auto motor = m_driveMotor.get()->GetSpeedController();
-    auto fx = dynamic_cast<WPI_TalonFX*>(motor.get());
+    //m_driveTalon->ConfigOpenloopRamp(0.4, 0);
+    //m_driveTalon->ConfigClosedloopRamp(0.4, 0);
 
-    //fx->ConfigOpenloopRamp(0.4, 0);
-    //fx->ConfigClosedloopRamp(0.4, 0);
-
-    fx->ConfigSelectedFeedbackSensor( ctre::phoenix::motorcontrol::FeedbackDevice::IntegratedSensor, 0, 10 );
-    fx->ConfigIntegratedSensorInitializationStrategy(BootToZero);
-    auto driveMotorSensors = fx->GetSensorCollection();
-    driveMotorSensors.SetIntegratedSensorPosition(0, 0);
+    m_driveTalon->ConfigSelectedFeedbackSensor( ctre::phoenix::motorcontrol::FeedbackDevice::IntegratedSensor, 0, 10 );
+    m_driveTalon->ConfigIntegratedSensorInitializationStrategy(BootToZero);
+    m_driveSensors->SetIntegratedSensorPosition(0, 0);
 
 
     // Set up the Absolute Turn Sensor
@@ -128,12 +149,18 @@ SwerveModule::SwerveModule
     
     
     // Set up the Turn Motor
-    motor = m_turnMotor.get()->GetSpeedController();
-    fx = dynamic_cast<WPI_TalonFX*>(motor.get());
-    fx->ConfigSelectedFeedbackSensor( ctre::phoenix::motorcontrol::FeedbackDevice::IntegratedSensor, 0, 10 );
-    fx->ConfigIntegratedSensorInitializationStrategy(BootToZero);
-    auto turnMotorSensors = fx->GetSensorCollection();
-    turnMotorSensors.SetIntegratedSensorPosition(0, 0);
+    if ( m_turnFeedback == TURN_FEEDBACK::REMOTE_CANCODER )
+    {
+        // The talon reads the cancoder's position (which keeps counting past +/-180 degrees) over CAN and runs the
+        // position loop on it every 1 ms, so the RIO only needs to send a target near the current count.
+        m_turnMotor.get()->SetRemoteSensor( m_turnSensor->GetDeviceNumber(), ctre::phoenix::motorcontrol::RemoteSensorSource::RemoteSensorSource_CANCoder );
+    }
+    else
+    {
+        m_turnTalon->ConfigSelectedFeedbackSensor( ctre::phoenix::motorcontrol::FeedbackDevice::IntegratedSensor, 0, 10 );
+        m_turnTalon->ConfigIntegratedSensorInitializationStrategy(BootToZero);
+        m_turnSensors->SetIntegratedSensorPosition(0, 0);
+    }
 
     //m_turnMotor.get()->SetControlConstants(0, m_turnPositionControlData);
 
@@ -183,6 +210,14 @@ void SwerveModule::Init
 {
     m_wheelDiameter = wheelDiameter;
     m_maxVelocity = maxVelocity;
+    if (!HasDriveFeedforward() && m_driveModelMass.to<double>() > 0.0)
+    {
+        DragonMotorModel model(m_driveMotor.get()->GetMotorType(), 1, m_driveMotor.get()->GetGearRatio());
+        auto ff = model.Drivetrain(m_driveModelMass, units::length::meter_t(wheelDiameter/2.0));
+        SetDriveFeedforward(units::voltage::volt_t(ff.kS), ff.kV, ff.kA);
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_nt, string("model kV"), ff.kV);
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_nt, string("model kA"), ff.kA);
+    }
     delete m_driveVelocityControlData;
 
     m_driveVelocityControlData = new ControlData(   ControlModes::CONTROL_TYPE::VELOCITY_RPS,
@@ -191,7 +226,7 @@ void SwerveModule::Init
                                                     0.01,  // 0.01
                                                     0.0,
                                                     0.0,
-                                                    0.5,  // 0.5
+                                                    HasDriveFeedforward() ? 0.0 : 0.5,  // 0.5; the motor model provides the feedforward when there is one
                                                     0.0,
                                                     maxAcceleration.to<double>(),
                                                     maxVelocity.to<double>(),
@@ -206,20 +241,14 @@ void SwerveModule::Init
 /// @brief void
 void SwerveModule::SetEncodersToZero()
 {
-    auto motor = m_driveMotor.get()->GetSpeedController();
-    auto fx = dynamic_cast<WPI_TalonFX*>(motor.get());
-    auto driveMotorSensors = fx->GetSensorCollection();
-    driveMotorSensors.SetIntegratedSensorPosition(0, 0);
+    m_driveSensors->SetIntegratedSensorPosition(0, 0);
 } 
 
 /// @brief Get the encoder values
 /// @returns double - the integrated sensor position
 double SwerveModule::GetEncoderValues()
 {
-    auto motor = m_driveMotor.get()->GetSpeedController();
-    auto fx = dynamic_cast<WPI_TalonFX*>(motor.get());
-    auto driveMotorSensors = fx->GetSensorCollection();
-    return driveMotorSensors.GetIntegratedSensorPosition();
+    return m_driveSensors->GetIntegratedSensorPosition();
 }
 
 /// @brief Turn all of the wheel to zero degrees yaw according to the pigeon
@@ -248,9 +277,13 @@ SwerveModuleState SwerveModule::GetState() const
 }
 
 
-frc::SwerveModulePosition SwerveModule::GetPosition() const {
-  return {units::meter_t{0.0},
-          units::radian_t{0.0}};
+/// @brief Get the current position of the module (distance the wheel has travelled and angle of the wheel)
+/// @returns SwerveModulePosition
+frc::SwerveModulePosition SwerveModule::GetPosition() const 
+{
+    auto distance = units::length::meter_t(GetWheelDiameter() * numbers::pi * m_driveMotor.get()->GetRotations());
+    Rotation2d angle {units::angle::degree_t(m_turnSensor->GetAbsolutePosition())};
+    return {distance, angle};
 }
 
 
@@ -278,6 +311,68 @@ void SwerveModule::SetDesiredState
     SetDriveSpeed(optimizedState.speed);
 }
 
+/// @brief Set the state of the module along with the wheel acceleration for the drive feedforward
+/// @param [in] const SwerveModuleState& targetState:   state to set the module to
+/// @param [in] units::meters_per_second_squared_t acceleration:   wheel acceleration in the direction of targetState.speed
+/// @returns void
+void SwerveModule::SetDesiredState
+(
+    const SwerveModuleState&                            targetState,
+    units::acceleration::meters_per_second_squared_t    acceleration
+)
+{
+    Rotation2d currAngle = Rotation2d(units::angle::degree_t(m_turnSensor->GetAbsolutePosition()));
+    auto optimizedState = Optimize(targetState, currAngle);
+
+    // the acceleration follows the wheel direction, so flip it too if the wheel was reversed
+    auto reversed = (optimizedState.speed.to<double>() < 0.0) != (targetState.speed.to<double>() < 0.0);
+    m_driveAcceleration = reversed ? -1.0 * acceleration : acceleration;
+
+    SetTurnAngle(optimizedState.angle.Degrees());
+    SetDriveSpeed(optimizedState.speed);
+    m_driveAcceleration = units::acceleration::meters_per_second_squared_t(0.0);
+}
+
+/// @brief Set the drive motor model used for the drive feedforward (voltage = kS*sign(v) + kV*v + kA*a)
+/// @param [in] units::volt_t   kS: voltage to overcome static friction
+/// @param [in] double          kV: volts per meter per second of wheel speed
+/// @param [in] double          kA: volts per meter per second squared of wheel acceleration
+/// @returns void
+void SwerveModule::SetDriveFeedforward
+(
+    units::voltage::volt_t  kS,
+    double                  kV,
+    double                  kA
+)
+{
+    m_driveKs = kS;
+    m_driveKv = kV;
+    m_driveKa = kA;
+}
+
+/// @brief Derive the drive feedforward from the drive motor's MotorData entry instead of measured gains.
+///        Used by Init when no drive_kv was given.
+/// @param [in] units::kilogram_t   massShare:  robot mass carried by this module
+/// @returns void
+void SwerveModule::SetDriveModelMass
+(
+    units::mass::kilogram_t massShare
+)
+{
+    m_driveModelMass = massShare;
+}
+
+/// @brief Set the fastest the module can turn; this depends on the turn motor and its gearing.
+/// @param [in] units::degrees_per_second_t maxRate:    maximum steering rate
+/// @returns void
+void SwerveModule::SetMaxSteerRate
+(
+    units::angular_velocity::degrees_per_second_t   maxRate
+)
+{
+    m_maxSteerRate = maxRate;
+}
+
 /// @brief Given a desired swerve module state and the current angle of the swerve module, determine
 ///        if the changing the desired swerve module angle by 180 degrees is a smaller turn or not.
 ///        If it is, return a state that has that angle and the reversed speed.  Otherwise, return the 
@@ -338,9 +433,7 @@ void SwerveModule::RunCurrentState()
 {
     SetDriveSpeed(m_activeState.speed);
 
-    auto motor = m_turnMotor.get()->GetSpeedController();
-    auto fx = dynamic_cast<WPI_TalonFX*>(motor.get());
-    fx->StopMotor();  
+    m_turnTalon->StopMotor();  
 }
 
 /// @brief run the drive motor at a specified speed
@@ -350,16 +443,41 @@ void SwerveModule::SetDriveSpeed( units::velocity::meters_per_second_t speed )
 {
     m_activeState.speed = ( abs(speed.to<double>()/m_maxVelocity.to<double>()) < 0.05 ) ? 0_mps : speed;
 
+    // slow the wheel down if the power manager predicts a brownout (all the drive outputs below follow the speed)
+    m_activeState.speed *= DragonPowerManager::GetPowerManager()->Request(m_powerHandle, m_activeState.speed / m_maxVelocity);
+
     Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_nt, string("State Speed - mps"), m_activeState.speed.to<double>() );
     Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_nt, string("Wheel Diameter - meters"), units::length::meter_t(m_wheelDiameter).to<double>() );
     Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_nt, string("drive motor id"), m_driveMotor.get()->GetID() );
 
+    // motor model feedforward as a fraction of the battery voltage
+    double feedforward = 0.0;
+    if (HasDriveFeedforward() && abs(m_activeState.speed.to<double>()) > 0.0)
+    {
+        auto speed = m_activeState.speed.to<double>();
+        auto volts = (speed > 0.0 ? m_driveKs : -1.0*m_driveKs).to<double>() + m_driveKv*speed + m_driveKa*m_driveAcceleration.to<double>();
+        feedforward = volts / RobotController::GetBatteryVoltage().to<double>();
+    }
+
     if (m_runClosedLoopDrive)
     {
         // convert mps to unitless rps by taking the speed and dividing by the circumference of the wheel
         auto driveTarget = m_activeState.speed.to<double>() / (units::length::meter_t(m_wheelDiameter).to<double>() *numbers::pi);  
         driveTarget /= m_driveMotor.get()->GetGearRatio();       
-        m_driveMotor.get()->Set(driveTarget);
+        if (HasDriveFeedforward())
+        {
+            // the talon closes the velocity loop on top of the model's voltage
+            auto nativeTarget = ConversionUtils::RPSToCounts100ms(driveTarget, m_driveMotor.get()->GetCountsPerRev()) * m_driveMotor.get()->GetGearRatio();
+            m_driveTalon->Set(motorcontrol::ControlMode::Velocity, nativeTarget, motorcontrol::DemandType::DemandType_ArbitraryFeedForward, feedforward);
+        }
+        else
+        {
+            m_driveMotor.get()->Set(driveTarget);
+        }
+    }
+    else if (HasDriveFeedforward())
+    {
+        m_driveMotor.get()->Set(feedforward);
     }
     else
     {
@@ -384,14 +502,22 @@ void SwerveModule::SetTurnAngle( units::angle::degree_t targetAngle )
     Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_nt, string("current angle"), currAngle.to<double>() );
     Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_nt, string("delta angle"), deltaAngle.to<double>() );
 
+    UpdateTurnSettleTime( deltaAngle );
+
     if ( abs(deltaAngle.to<double>()) > 1.0 )
     {
-        auto motor = m_turnMotor.get()->GetSpeedController();
-        auto fx = dynamic_cast<WPI_TalonFX*>(motor.get());
-        auto sensors = fx->GetSensorCollection();
-        auto deltaTicks = m_countsOnTurnEncoderPerDegreesOnAngleSensor * deltaAngle.to<double>();
-
-        double currentTicks = sensors.GetIntegratedSensorPosition();
+        double deltaTicks = 0.0;
+        double currentTicks = 0.0;
+        if ( m_turnFeedback == TURN_FEEDBACK::REMOTE_CANCODER )
+        {
+            deltaTicks = m_remoteCountsPerDegree * deltaAngle.to<double>();
+            currentTicks = m_turnTalon->GetSelectedSensorPosition(0);
+        }
+        else
+        {
+            deltaTicks = m_countsOnTurnEncoderPerDegreesOnAngleSensor * deltaAngle.to<double>();
+            currentTicks = m_turnSensors->GetIntegratedSensorPosition();
+        }
         double desiredTicks = currentTicks + deltaTicks;
 
         Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_nt, string("currentTicks"), currentTicks );
@@ -402,12 +528,36 @@ void SwerveModule::SetTurnAngle( units::angle::degree_t targetAngle )
     }
 }
 
+/// @brief Track how long the module takes to reach a new angle.  Timing starts when the angle error exceeds
+///        m_settleStartError and stops once it is within m_settleTolerance.  The times are only logged when a
+///        settle completes.  To compare the two TURN_FEEDBACK options, drive the same moves with each turn_feedback
+///        setting in robot.xml (each with its own tuned turn gains) and compare the logged times.
+/// @param [in] units::angle::degree_t  angleError: target angle - current angle
+/// @returns void
+void SwerveModule::UpdateTurnSettleTime( units::angle::degree_t angleError )
+{
+    auto error = units::math::abs(angleError);
+    if ( !m_turnSettling && error > m_settleStartError )
+    {
+        m_turnSettling = true;
+        m_turnSettleStart = frc::Timer::GetFPGATimestamp();
+    }
+    else if ( m_turnSettling && error < m_settleTolerance )
+    {
+        m_turnSettling = false;
+        m_lastTurnSettleTime = frc::Timer::GetFPGATimestamp() - m_turnSettleStart;
+        m_maxTurnSettleTime = m_lastTurnSettleTime > m_maxTurnSettleTime ? m_lastTurnSettleTime : m_maxTurnSettleTime;
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_nt, string("turn settle time (ms)"), units::time::millisecond_t(m_lastTurnSettleTime).to<double>() );
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_nt, string("max turn settle time (ms)"), units::time::millisecond_t(m_maxTurnSettleTime).to<double>() );
+    }
+}
+
 /// @brief stop the drive and turn motors
 /// @return void
 void SwerveModule::StopMotors()
 {
-    m_turnMotor.get()->GetSpeedController()->StopMotor();
-    m_driveMotor.get()->GetSpeedController()->StopMotor();
+    m_turnTalon->StopMotor();
+    m_driveTalon->StopMotor();
 }
 
 frc::Pose2d SwerveModule::GetCurrentPose(PoseEstimatorEnum opt)
@@ -33,6 +33,7 @@
 #include <units/angular_acceleration.h>
 #include <units/angular_velocity.h>
 #include <units/time.h>
+#include <units/mass.h>
 #include <units/velocity.h>
 #include <units/voltage.h>
 
@@ -57,11 +58,19 @@ class SwerveModule
             RIGHT_BACK
         };
 
+        /// @brief Where the turn motor's position loop gets its feedback
+        enum TURN_FEEDBACK
+        {
+            INTEGRATED_SENSOR,  ///< falcon encoder; the cancoder angle error is turned into a falcon tick target each loop
+            REMOTE_CANCODER     ///< cancoder is the talon's remote sensor, so the talon closes the loop on the wheel angle
+        };
+
         /// @brief Constructs a Swerve Module.  This is assuming 2 TalonFX (Falcons) with a CanCoder for the turn angle
         /// @param [in] ModuleID                                                type:           Which Swerve Module is it
         /// @param [in] shared_ptr<IDragonMotorController>                      driveMotor:     Motor that makes the robot move  
         /// @param [in] shared_ptr<IDragonMotorController>                      turnMotor:      Motor that turns the swerve module 
         /// @param [in] DragonCanCoder*       		                            canCoder:       Sensor for detecting the angle of the wheel
+        /// @param [in] TURN_FEEDBACK                                           turnFeedback:   Sensor the turn motor closes its position loop on
         SwerveModule( ModuleID                                                  type, 
                       std::shared_ptr<IDragonMotorController>                   driveMotor, 
                       std::shared_ptr<IDragonMotorController>                   turningMotor,
@@ -74,7 +83,8 @@ class SwerveModule
                       double                                                    turnNominalNeg,
                       double                                                    turnMaxAcc,
                       double                                                    turnCruiseVel,
-                      double                                                    countsOnTurnEncoderPerDegreesOnAngleSensor
+                      double                                                    countsOnTurnEncoderPerDegreesOnAngleSensor,
+                      TURN_FEEDBACK                                             turnFeedback
                     );
 
         void Init
@@ -109,6 +119,48 @@ class SwerveModule
         /// @returns void
         void SetDesiredState(const frc::SwerveModuleState& state);
 
+        /// @brief Set the state of the module along with the wheel acceleration for the drive feedforward
+        /// @param [in] const SwerveModuleState&                    state:          state to set the module to
+        /// @param [in] units::meters_per_second_squared_t          acceleration:   wheel acceleration in the direction of state.speed
+        void SetDesiredState
+        (
+            const frc::SwerveModuleState&                       state,
+            units::acceleration::meters_per_second_squared_t    acceleration
+        );
+
+        /// @brief Set the drive motor model used for the drive feedforward (voltage = kS*sign(v) + kV*v + kA*a)
+        /// @param [in] units::volt_t   kS: voltage to overcome static friction
+        /// @param [in] double          kV: volts per meter per second of wheel speed
+        /// @param [in] double          kA: volts per meter per second squared of wheel acceleration
+        void SetDriveFeedforward
+        (
+            units::voltage::volt_t  kS,
+            double                  kV,
+            double                  kA
+        );
+
+        /// @brief Derive the drive feedforward from the drive motor's MotorData entry instead of measured gains.
+        ///        Used by Init when no drive_kv was given.
+        /// @param [in] units::kilogram_t   massShare:  robot mass carried by this module
+        void SetDriveModelMass
+        (
+            units::mass::kilogram_t massShare
+        );
+
+        /// @brief Set the fastest the module can turn; this depends on the turn motor and its gearing.
+        ///        The setpoint generator never asks the module to turn faster than this.
+        /// @param [in] units::degrees_per_second_t maxRate:    maximum steering rate
+        void SetMaxSteerRate
+        (
+            units::angular_velocity::degrees_per_second_t   maxRate
+        );
+
+        /// @brief maximum steering rate from the swervemodule turn_max_rate attribute
+        units::angular_velocity::degrees_per_second_t GetMaxSteerRate() const { return m_maxSteerRate; }
+
+        /// @brief true if a drive motor model was provided
+        bool HasDriveFeedforward() const { return m_driveKv > 0.0; }
+
         void RunCurrentState();
 
         /// @brief Return which module this is
@@ -139,6 +191,7 @@ class SwerveModule
 
         void SetDriveSpeed( units::velocity::meters_per_second_t speed );
         void SetTurnAngle( units::angle::degree_t angle );
+        void UpdateTurnSettleTime( units::angle::degree_t angleError );
 
 
         ModuleID                                            m_type;
@@ -147,6 +200,12 @@ class SwerveModule
         std::shared_ptr<IDragonMotorController>             m_turnMotor;
         DragonCanCoder*                                     m_turnSensor;
 
+        // non-owning handles resolved once in the constructor (owned by m_driveMotor / m_turnMotor)
+        ctre::phoenix::motorcontrol::can::WPI_TalonFX*      m_driveTalon;
+        ctre::phoenix::motorcontrol::TalonFXSensorCollection* m_driveSensors;
+        ctre::phoenix::motorcontrol::can::WPI_TalonFX*      m_turnTalon;
+        ctre::phoenix::motorcontrol::TalonFXSensorCollection* m_turnSensors;
+
         ControlData*                                        m_driveVelocityControlData;
         ControlData*                                        m_drivePercentControlData;
         ControlData*                                        m_turnPositionControlData;
@@ -162,6 +221,27 @@ class SwerveModule
         double                                              m_currentRotations;
 
         units::velocity::meters_per_second_t                m_maxVelocity;
+        units::angular_velocity::degrees_per_second_t       m_maxSteerRate;
+
+        // drive motor model; when kV is set the drive output comes from the model instead of speed / max velocity
+        units::voltage::volt_t                              m_driveKs;
+        double                                              m_driveKv;
+        double                                              m_driveKa;
+        units::mass::kilogram_t                             m_driveModelMass;
+        int                                                 m_powerHandle;      // DragonPowerManager handle for the drive motor
+        units::acceleration::meters_per_second_squared_t    m_driveAcceleration;
         bool                                                m_runClosedLoopDrive;
         double                                              m_countsOnTurnEncoderPerDegreesOnAngleSensor;
+        TURN_FEEDBACK                                       m_turnFeedback;
+
+        // turn settle time:  from the angle error exceeding m_settleStartError until it is back within m_settleTolerance
+        bool                                                m_turnSettling;
+        units::time::second_t                               m_turnSettleStart;
+        units::time::second_t                               m_lastTurnSettleTime;
+        units::time::second_t                               m_maxTurnSettleTime;
+
+        // cancoder counts as seen by the talon when it is the remote sensor
+        static constexpr double                             m_remoteCountsPerDegree = 4096.0 / 360.0;
+        const units::angle::degree_t                        m_settleStartError = units::angle::degree_t(5.0);
+        const units::angle::degree_t                        m_settleTolerance = units::angle::degree_t(1.0);
 };
\ No newline at end of file
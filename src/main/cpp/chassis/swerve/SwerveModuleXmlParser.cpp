@@ -35,6 +35,7 @@
 #include <hw/interfaces/IDragonMotorController.h>
 #include <hw/usages/IDragonMotorControllerMap.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 #include <hw/xml/CancoderXmlParser.h>
 #include <hw/xml/MotorXmlParser.h>
 #include <chassis/swerve/SwerveModuleXmlParser.h>
@@ -73,86 +74,138 @@ std::shared_ptr<SwerveModule> SwerveModuleXmlParser::ParseXML
     double turnMaxAcc = 0.0;
     double turnCruiseVel = 0.0;
     double countsOnTurnEncoderPerDegreesOnAngleSensor = 1.0;
+    auto turnFeedback = SwerveModule::TURN_FEEDBACK::INTEGRATED_SENSOR;
+    double driveKs = 0.0;
+    double driveKv = 0.0;
+    double driveKa = 0.0;
+    double driveModelMass = 0.0;
+    double turnMaxRate = 1080.0;
     auto networkTableName = baseNetworkTableName;
 
     // process attributes
     for (xml_attribute attr = SwerveModuleNode.first_attribute(); attr && !hasError; attr = attr.next_attribute())
     {
-        string attrName (attr.name());
-        if ( attrName.compare("type") == 0 )
+        switch ( XmlName::Hash( attr.name() ) )
         {
-            auto thisPosition = string( attr.value() );
-            if ( thisPosition.compare("LEFT_FRONT") == 0 )
+            case XmlName::Hash( "type" ):
             {
-                position = SwerveModule::ModuleID::LEFT_FRONT;
-                networkTableName  += " - Left_Front Module";
+                auto thisPosition = string( attr.value() );
+                if ( thisPosition.compare("LEFT_FRONT") == 0 )
+                {
+                    position = SwerveModule::ModuleID::LEFT_FRONT;
+                    networkTableName  += " - Left_Front Module";
+                }
+                else if ( thisPosition.compare("RIGHT_FRONT") == 0  )
+                {
+                    position = SwerveModule::ModuleID::RIGHT_FRONT;
+                    networkTableName  += " - Right_Front Module";
+                }
+                else if ( thisPosition.compare("LEFT_BACK") == 0  )
+                {
+                    position = SwerveModule::ModuleID::LEFT_BACK;
+                    networkTableName  += " - Left_Back Module";
+                }
+                else if ( thisPosition.compare("RIGHT_BACK") == 0  )
+                {
+                    position = SwerveModule::ModuleID::RIGHT_BACK;
+                    networkTableName  += " - Right_Back Module";
+                }
+                else
+                {
+                    string msg = "unknown position ";
+                    msg += attr.name();
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("SwerveChassisXmlParser"),string("ParseXML"), msg );
+                    hasError = true;
+                }
+                break;
             }
-            else if ( thisPosition.compare("RIGHT_FRONT") == 0  )
-            {
-                position = SwerveModule::ModuleID::RIGHT_FRONT;
-                networkTableName  += " - Right_Front Module";
-            }
-            else if ( thisPosition.compare("LEFT_BACK") == 0  )
-            {
-                position = SwerveModule::ModuleID::LEFT_BACK;
-                networkTableName  += " - Left_Back Module";
-            }
-            else if ( thisPosition.compare("RIGHT_BACK") == 0  )
+
+            case XmlName::Hash( "turn_p" ):
+                turnP = attr.as_double();
+                break;
+
+            case XmlName::Hash( "turn_i" ):
+                turnI = attr.as_double();
+                break;
+
+            case XmlName::Hash( "turn_d" ):
+                turnD = attr.as_double();
+                break;
+
+            case XmlName::Hash( "turn_f" ):
+                turnF = attr.as_double();
+                break;
+
+            case XmlName::Hash( "turn_nominal_val" ):
+                turnNominalVal = attr.as_double();
+                break;
+
+            case XmlName::Hash( "turn_peak_val" ):
+                turnPeakVal = attr.as_double();
+                break;
+
+            case XmlName::Hash( "turn_max_acc" ):
+                turnMaxAcc = attr.as_double();
+                break;
+
+            case XmlName::Hash( "turn_cruise_vel" ):
+                turnCruiseVel = attr.as_double();
+                break;
+
+            case XmlName::Hash( "countsOnTurnEncoderPerDegreesOnAngleSensor" ):
+                countsOnTurnEncoderPerDegreesOnAngleSensor = attr.as_double();
+                break;
+
+            case XmlName::Hash( "turn_feedback" ):
             {
-                position = SwerveModule::ModuleID::RIGHT_BACK;
-                networkTableName  += " - Right_Back Module";
+                auto feedback = string( attr.value() );
+                if ( feedback.compare("INTEGRATED") == 0 )
+                {
+                    turnFeedback = SwerveModule::TURN_FEEDBACK::INTEGRATED_SENSOR;
+                }
+                else if ( feedback.compare("CANCODER") == 0 )
+                {
+                    turnFeedback = SwerveModule::TURN_FEEDBACK::REMOTE_CANCODER;
+                }
+                else
+                {
+                    string msg = "unknown turn_feedback ";
+                    msg += feedback;
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("SwerveModuleXmlParser"), string("ParseXML"), msg );
+                    hasError = true;
+                }
+                break;
             }
-            else 
+
+            case XmlName::Hash( "drive_ks" ):
+                driveKs = attr.as_double();
+                break;
+
+            case XmlName::Hash( "drive_kv" ):
+                driveKv = attr.as_double();
+                break;
+
+            case XmlName::Hash( "drive_ka" ):
+                driveKa = attr.as_double();
+                break;
+
+            case XmlName::Hash( "drive_model_mass" ):
+                driveModelMass = attr.as_double();
+                break;
+
+            case XmlName::Hash( "turn_max_rate" ):
+                turnMaxRate = attr.as_double();
+                break;
+
+            default:  // log errors
             {
-                string msg = "unknown position ";
+                string msg = "unknown attribute ";
                 msg += attr.name();
-                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("SwerveChassisXmlParser"),string("ParseXML"), msg );
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("SwerveChassisXmlParser"), string("ParseXML"), msg );
                 hasError = true;
+                break;
             }
         }
-        else if (  attrName.compare("turn_p") == 0 )
-        {
-        	turnP = attr.as_double();
-        }
-        else if (  attrName.compare("turn_i") == 0 )
-        {
-        	turnI = attr.as_double();
-        }
-        else if (  attrName.compare("turn_d") == 0 )
-        {
-        	turnD = attr.as_double();
-        }
-        else if (  attrName.compare("turn_f") == 0 )
-        {
-        	turnF = attr.as_double();
-        }
-        else if (  attrName.compare("turn_nominal_val") == 0 )
-        {
-        	turnNominalVal = attr.as_double();
-        }
-        else if (  attrName.compare("turn_peak_val") == 0 )
-        {
-        	turnPeakVal = attr.as_double();
-        }
-        else if (  attrName.compare("turn_max_acc") == 0 )
-        {
-        	turnMaxAcc = attr.as_double();
-        }
-        else if (  attrName.compare("turn_cruise_vel") == 0 )
-        {
-        	turnCruiseVel = attr.as_double();
-        }
-        else if (attrName.compare("countsOnTurnEncoderPerDegreesOnAngleSensor") == 0)
-        {
-            countsOnTurnEncoderPerDegreesOnAngleSensor = attr.as_double();
-        }
-        else   // log errors
-        {
-            string msg = "unknown attribute ";
-            msg += attr.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("SwerveChassisXmlParser"), string("ParseXML"), msg );
-            hasError = true;
-        }
     }
 
 
@@ -165,26 +218,31 @@ std::shared_ptr<SwerveModule> SwerveModuleXmlParser::ParseXML
 
     for (xml_node child = SwerveModuleNode.first_child(); child; child = child.next_sibling())
     {
-        string childName (child.name());
-    	if ( childName.compare("motor") == 0 )
-    	{
-            auto motor = motorXML.get()->ParseXML(networkTableName, child);
-            if ( motor.get() != nullptr )
+        switch ( XmlName::Hash( child.name() ) )
+        {
+            case XmlName::Hash( "motor" ):
             {
-                motors[ motor.get()->GetType() ] =  motor ;
+                auto motor = motorXML.get()->ParseXML(networkTableName, child);
+                if ( motor.get() != nullptr )
+                {
+                    motors[ motor.get()->GetType() ] =  motor ;
+                }
+                break;
             }
-    	}
-    	else if ( childName.compare("cancoder") == 0 )
-    	{
-            turnsensor = cancoderXML.get()->ParseXML(networkTableName, child);
-    	}
-    	else  // log errors
-    	{
-            string msg = "unknown child ";
-            msg += child.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("SwerveModuleXmlParser"), string("ParseXML"), msg );
-            hasError = true;
-    	}
+
+            case XmlName::Hash( "cancoder" ):
+                turnsensor = cancoderXML.get()->ParseXML(networkTableName, child);
+                break;
+
+            default:  // log errors
+            {
+                string msg = "unknown child ";
+                msg += child.name();
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("SwerveModuleXmlParser"), string("ParseXML"), msg );
+                hasError = true;
+                break;
+            }
+        }
     }
 
 
@@ -202,7 +260,20 @@ std::shared_ptr<SwerveModule> SwerveModuleXmlParser::ParseXML
                                                                          turnPeakVal,
                                                                          turnMaxAcc,
                                                                          turnCruiseVel,
-                                                                         countsOnTurnEncoderPerDegreesOnAngleSensor );
+                                                                         countsOnTurnEncoderPerDegreesOnAngleSensor,
+                                                                         turnFeedback );
+        if ( module.get() != nullptr && driveKv > 0.0 )
+        {
+            module.get()->SetDriveFeedforward(units::voltage::volt_t(driveKs), driveKv, driveKa);
+        }
+        else if ( module.get() != nullptr && driveModelMass > 0.0 )
+        {
+            module.get()->SetDriveModelMass(units::mass::pound_t(driveModelMass));
+        }
+        if ( module.get() != nullptr && turnMaxRate > 0.0 )
+        {
+            module.get()->SetMaxSteerRate(units::angular_velocity::degrees_per_second_t(turnMaxRate));
+        }
     }
     return module;
 }
@@ -0,0 +1,117 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+
+// FRC includes
+#include <frc/geometry/Rotation2d.h>
+#include <frc/kinematics/SwerveModuleState.h>
+#include <units/angle.h>
+#include <units/math.h>
+
+// Team 302 includes
+#include <chassis/swerve/SwerveSetpointGenerator.h>
+
+using frc::Rotation2d;
+using frc::SwerveModuleState;
+
+SwerveSetpointGenerator::SwerveSetpointGenerator
+(
+    units::acceleration::meters_per_second_squared_t    maxDriveAcceleration,
+    const SteerRates&                                   maxSteerRates
+) : m_maxDriveAcceleration(maxDriveAcceleration),
+    m_maxSteerRates(maxSteerRates),
+    m_previous(wpi::empty_array),
+    m_initialized(false)
+{
+    for (auto& state : m_previous)
+    {
+        state = SwerveModuleState{units::velocity::meters_per_second_t(0.0), Rotation2d()};
+    }
+}
+
+void SwerveSetpointGenerator::Reset
+(
+    const ModuleStates&     currentStates
+)
+{
+    m_previous = currentStates;
+    m_initialized = true;
+}
+
+void SwerveSetpointGenerator::Generate
+(
+    ModuleStates&           states,
+    units::time::second_t   dt
+)
+{
+    if (!m_initialized)
+    {
+        Reset(states);
+        return;
+    }
+
+    auto maxDeltaSpeed = m_maxDriveAcceleration * dt;
+
+    // first pass:  pick the shortest way to turn each module and find how much of the speed change all modules can make
+    double speedScale = 1.0;
+    for (int inx=0; inx<NUM_MODULES; ++inx)
+    {
+        auto& desired = states[inx];
+        auto& previous = m_previous[inx];
+
+        if (units::math::abs(desired.speed) < m_stoppedSpeed)
+        {
+            desired.angle = previous.angle;
+        }
+
+        auto delta = (desired.angle - previous.angle).Degrees();
+        if (units::math::abs(delta) > units::angle::degree_t(90.0))
+        {
+            desired.speed *= -1.0;
+            desired.angle = desired.angle + Rotation2d(units::angle::degree_t(180.0));
+        }
+
+        auto deltaSpeed = units::math::abs(desired.speed - previous.speed);
+        if (deltaSpeed > maxDeltaSpeed)
+        {
+            speedScale = std::min(speedScale, (maxDeltaSpeed / deltaSpeed).to<double>());
+        }
+    }
+
+    // second pass:  move each module toward its desired state within the limits
+    for (int inx=0; inx<NUM_MODULES; ++inx)
+    {
+        auto& desired = states[inx];
+        auto& previous = m_previous[inx];
+
+        auto speed = previous.speed + speedScale * (desired.speed - previous.speed);
+
+        units::angle::degree_t maxDeltaAngle = m_maxSteerRates[inx] * dt;
+        auto deltaAngle = (desired.angle - previous.angle).Degrees();
+        deltaAngle = std::clamp(deltaAngle, -1.0*maxDeltaAngle, maxDeltaAngle);
+        auto angle = previous.angle + Rotation2d(deltaAngle);
+
+        units::angle::radian_t remaining = (desired.angle - angle).Radians();
+        speed *= std::max(0.0, cos(remaining.to<double>()));
+
+        desired.speed = speed;
+        desired.angle = angle;
+        previous = desired;
+    }
+}
@@ -0,0 +1,87 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// FRC includes
+#include <frc/kinematics/SwerveModuleState.h>
+#include <units/acceleration.h>
+#include <units/angular_velocity.h>
+#include <units/time.h>
+#include <units/velocity.h>
+#include <wpi/array.h>
+
+/// @class SwerveSetpointGenerator
+/// @brief Sits between the kinematics output and SwerveModule::SetDesiredState.  Each cycle it turns the
+///        requested module states into states the modules can actually reach from the previous setpoint:
+///         - modules never get asked to turn more than 90 degrees (the wheel is reversed instead)
+///         - each module's steering angle changes at most its maxSteerRate * dt
+///         - all wheel speeds change by the same fraction so that no module exceeds maxDriveAcceleration * dt
+///           (this keeps the chassis motion direction while accelerating)
+///         - wheel speed is scaled by the cosine of the steering error still left so the wheel doesn't push sideways
+///        Everything is stored in fixed size arrays so no memory is allocated after construction.
+class SwerveSetpointGenerator
+{
+    public:
+        static constexpr int NUM_MODULES = 4;
+        using ModuleStates = wpi::array<frc::SwerveModuleState, NUM_MODULES>;
+        using SteerRates = wpi::array<units::angular_velocity::degrees_per_second_t, NUM_MODULES>;
+
+        /// @brief Create the generator
+        /// @param [in] units::meters_per_second_squared_t  maxDriveAcceleration:   maximum acceleration of a wheel
+        /// @param [in] SteerRates                          maxSteerRates:          maximum rate each module can turn (FL, FR, BL, BR)
+        SwerveSetpointGenerator
+        (
+            units::acceleration::meters_per_second_squared_t    maxDriveAcceleration,
+            const SteerRates&                                   maxSteerRates
+        );
+        SwerveSetpointGenerator() = delete;
+        ~SwerveSetpointGenerator() = default;
+
+        /// @brief Seed the previous setpoints with the measured module states (e.g. after the modules were stopped)
+        /// @param [in] const ModuleStates& currentStates: measured module states (FL, FR, BL, BR)
+        void Reset
+        (
+            const ModuleStates&     currentStates
+        );
+
+        /// @brief Forget the previous setpoints; the caller needs to Reset before the next Generate
+        void Invalidate() { m_initialized = false; }
+
+        /// @brief true if there are previous setpoints to limit against
+        bool IsInitialized() const { return m_initialized; }
+
+        /// @brief Convert the desired module states into feasible setpoints in place
+        /// @param [in/out] ModuleStates&   states: desired states in, feasible setpoints out (FL, FR, BL, BR)
+        /// @param [in] units::second_t     dt:     time since the previous setpoint
+        void Generate
+        (
+            ModuleStates&           states,
+            units::time::second_t   dt
+        );
+
+        /// @brief setpoints returned by the last Generate call
+        const ModuleStates& GetPreviousSetpoints() const { return m_previous; }
+
+    private:
+        units::acceleration::meters_per_second_squared_t    m_maxDriveAcceleration;
+        SteerRates                                          m_maxSteerRates;
+        ModuleStates                                        m_previous;
+        bool                                                m_initialized;
+
+        // below this the wheel is considered stopped and its angle is held instead of snapping to the kinematics angle
+        const units::velocity::meters_per_second_t          m_stoppedSpeed = units::velocity::meters_per_second_t(0.01);
+};
@@ -0,0 +1,170 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+
+// FRC includes
+#include <frc/geometry/Translation2d.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <units/math.h>
+
+// Team 302 includes
+#include <chassis/swerve/SwerveSlipDetector.h>
+#include <utils/AngleUtils.h>
+
+using std::hypot;
+
+SwerveSlipDetector::SwerveSlipDetector
+(
+    const frc::SwerveDriveKinematics<NUM_MODULES>&          kinematics,
+    const wpi::array<frc::Translation2d, NUM_MODULES>&      moduleLocations
+) : m_kinematics(kinematics),
+    m_moduleLocations(moduleLocations),
+    m_initialized(false),
+    m_state(SLIP_STATE::NONE),
+    m_holdUntil(units::time::second_t(0.0)),
+    m_lastTimestamp(units::time::second_t(0.0)),
+    m_lastYaw(units::angle::degree_t(0.0)),
+    m_lastSpeeds(),
+    m_lastMeasuredX(0.0),
+    m_lastMeasuredY(0.0),
+    m_kinematicX(0.0),
+    m_kinematicY(0.0),
+    m_measuredX(0.0),
+    m_measuredY(0.0),
+    m_wheelResidual(units::velocity::meters_per_second_t(0.0)),
+    m_accelResidual(units::acceleration::meters_per_second_squared_t(0.0))
+{
+}
+
+void SwerveSlipDetector::Reset()
+{
+    m_initialized = false;
+    m_state = SLIP_STATE::NONE;
+    m_kinematicX = 0.0;
+    m_kinematicY = 0.0;
+    m_measuredX = 0.0;
+    m_measuredY = 0.0;
+}
+
+SwerveSlipDetector::SLIP_STATE SwerveSlipDetector::Update
+(
+    const ModuleStates&                                 states,
+    units::angle::degree_t                              yaw,
+    units::acceleration::meters_per_second_squared_t    accelX,
+    units::acceleration::meters_per_second_squared_t    accelY,
+    units::time::second_t                               timestamp
+)
+{
+    auto speeds = m_kinematics.ToChassisSpeeds(states);
+    auto dt = timestamp - m_lastTimestamp;
+    auto measuredX = accelX.to<double>();
+    auto measuredY = accelY.to<double>();
+
+    if (m_initialized && dt > units::time::second_t(0.0) && dt < m_maxPeriod)
+    {
+        auto seconds = dt.to<double>();
+        units::angular_velocity::radians_per_second_t gyroRate = AngleUtils::GetDeltaAngle(m_lastYaw, yaw) / dt;
+
+        // rigid body fit:  each module should move at the chassis velocity plus omega x its location
+        m_wheelResidual = units::velocity::meters_per_second_t(0.0);
+        for (int inx=0; inx<NUM_MODULES; ++inx)
+        {
+            auto& location = m_moduleLocations[inx];
+            auto fitX = speeds.vx.to<double>() - speeds.omega.to<double>() * location.Y().to<double>();
+            auto fitY = speeds.vy.to<double>() + speeds.omega.to<double>() * location.X().to<double>();
+            auto moduleX = states[inx].speed.to<double>() * states[inx].angle.Cos();
+            auto moduleY = states[inx].speed.to<double>() * states[inx].angle.Sin();
+            auto residual = units::velocity::meters_per_second_t(hypot(moduleX - fitX, moduleY - fitY));
+            m_wheelResidual = residual > m_wheelResidual ? residual : m_wheelResidual;
+        }
+        auto yawRateResidual = units::math::abs(speeds.omega - gyroRate);
+
+        // the accelerometer sits in the rotating robot frame, so it also sees omega x v
+        auto omega = gyroRate.to<double>();
+        auto kinematicX = (speeds.vx - m_lastSpeeds.vx).to<double>() / seconds - omega * speeds.vy.to<double>();
+        auto kinematicY = (speeds.vy - m_lastSpeeds.vy).to<double>() / seconds + omega * speeds.vx.to<double>();
+        m_kinematicX += m_filterGain * (kinematicX - m_kinematicX);
+        m_kinematicY += m_filterGain * (kinematicY - m_kinematicY);
+        m_measuredX += m_filterGain * (measuredX - m_measuredX);
+        m_measuredY += m_filterGain * (measuredY - m_measuredY);
+
+        auto jerk = hypot(measuredX - m_lastMeasuredX, measuredY - m_lastMeasuredY) / seconds;
+        auto residual = hypot(m_measuredX - m_kinematicX, m_measuredY - m_kinematicY);
+        m_accelResidual = units::acceleration::meters_per_second_squared_t(residual);
+        auto kinematicMagnitude = hypot(m_kinematicX, m_kinematicY);
+        auto measuredMagnitude = hypot(m_measuredX, m_measuredY);
+
+        auto detected = SLIP_STATE::NONE;
+        if (jerk > m_collisionJerk)
+        {
+            detected = SLIP_STATE::COLLISION;
+        }
+        else if (m_wheelResidual > m_wheelResidualLimit ||
+                 yawRateResidual > m_yawRateResidualLimit ||
+                 (residual > m_accelResidualLimit && kinematicMagnitude > measuredMagnitude))
+        {
+            detected = SLIP_STATE::WHEEL_SLIP;
+        }
+        else if (residual > m_accelResidualLimit)
+        {
+            detected = SLIP_STATE::PUSHED;
+        }
+
+        if (detected != SLIP_STATE::NONE)
+        {
+            // don't let a slip detected while recovering hide the collision that caused it
+            if (m_state != SLIP_STATE::COLLISION || detected == SLIP_STATE::COLLISION)
+            {
+                m_state = detected;
+            }
+            m_holdUntil = timestamp + m_holdTime;
+        }
+        else if (timestamp > m_holdUntil)
+        {
+            m_state = SLIP_STATE::NONE;
+        }
+    }
+
+    m_initialized = true;
+    m_lastTimestamp = timestamp;
+    m_lastYaw = yaw;
+    m_lastSpeeds = speeds;
+    m_lastMeasuredX = measuredX;
+    m_lastMeasuredY = measuredY;
+    return m_state;
+}
+
+double SwerveSlipDetector::GetOdometryTrust() const
+{
+    switch (m_state)
+    {
+        case SLIP_STATE::WHEEL_SLIP:
+            return m_slipTrust;
+
+        case SLIP_STATE::COLLISION:
+            return m_collisionTrust;
+
+        case SLIP_STATE::PUSHED:
+            return m_pushedTrust;
+
+        default:
+            return 1.0;
+    }
+}
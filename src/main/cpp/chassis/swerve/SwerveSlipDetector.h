@@ -0,0 +1,136 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// FRC includes
+#include <frc/geometry/Translation2d.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <frc/kinematics/SwerveDriveKinematics.h>
+#include <frc/kinematics/SwerveModuleState.h>
+#include <units/acceleration.h>
+#include <units/angle.h>
+#include <units/angular_velocity.h>
+#include <units/time.h>
+#include <units/velocity.h>
+#include <wpi/array.h>
+
+/// @class SwerveSlipDetector
+/// @brief Compares what the swerve modules say the chassis is doing with what the gyro and accelerometer measure.
+///        Called once per odometry update, it classifies the disagreement as:
+///         - WHEEL_SLIP:  a module's velocity doesn't fit the rigid body motion of the others, the module yaw rate
+///                        doesn't match the gyro, or the wheels accelerate harder than the chassis does
+///         - COLLISION:   the measured acceleration jumps faster than the drivetrain could cause
+///         - PUSHED:      the chassis accelerates without the wheels commanding it
+///        A detection is held for m_holdTime so the pose estimator can lean on vision until odometry is good again.
+///        All state is a handful of scalars (no history buffers), so the memory footprint is fixed.
+///        The accelerometer is assumed to be mounted with X toward the robot front and Y toward the left.
+class SwerveSlipDetector
+{
+    public:
+        static constexpr int NUM_MODULES = 4;
+        using ModuleStates = wpi::array<frc::SwerveModuleState, NUM_MODULES>;
+
+        enum SLIP_STATE
+        {
+            NONE,
+            WHEEL_SLIP,
+            COLLISION,
+            PUSHED
+        };
+
+        /// @brief Create the detector
+        /// @param [in] const frc::SwerveDriveKinematics<4>&    kinematics:     chassis kinematics (must outlive the detector)
+        /// @param [in] const wpi::array<Translation2d,4>&      moduleLocations: module locations (FL, FR, BL, BR)
+        SwerveSlipDetector
+        (
+            const frc::SwerveDriveKinematics<NUM_MODULES>&          kinematics,
+            const wpi::array<frc::Translation2d, NUM_MODULES>&      moduleLocations
+        );
+        SwerveSlipDetector() = delete;
+        ~SwerveSlipDetector() = default;
+
+        /// @brief Forget the previous sample (e.g. after the pose or encoders were reset)
+        void Reset();
+
+        /// @brief Update the detector with this cycle's measurements
+        /// @param [in] const ModuleStates&                     states:     measured module states (FL, FR, BL, BR)
+        /// @param [in] units::degree_t                         yaw:        gyro yaw
+        /// @param [in] units::meters_per_second_squared_t      accelX:     measured acceleration toward the robot front
+        /// @param [in] units::meters_per_second_squared_t      accelY:     measured acceleration toward the robot left
+        /// @param [in] units::second_t                         timestamp:  FPGA time of the measurements
+        /// @returns SLIP_STATE current (held) state
+        SLIP_STATE Update
+        (
+            const ModuleStates&                                 states,
+            units::angle::degree_t                              yaw,
+            units::acceleration::meters_per_second_squared_t    accelX,
+            units::acceleration::meters_per_second_squared_t    accelY,
+            units::time::second_t                               timestamp
+        );
+
+        /// @brief current (held) state
+        SLIP_STATE GetState() const { return m_state; }
+
+        /// @brief how much the wheel odometry should be trusted in the current state
+        /// @returns double 1.0 when the wheels agree with the IMU down to m_collisionTrust during a collision
+        double GetOdometryTrust() const;
+
+        /// @brief worst module velocity error from the rigid body fit in the last update
+        units::velocity::meters_per_second_t GetWheelResidual() const { return m_wheelResidual; }
+
+        /// @brief filtered difference between the measured and kinematic acceleration in the last update
+        units::acceleration::meters_per_second_squared_t GetAccelResidual() const { return m_accelResidual; }
+
+    private:
+        const frc::SwerveDriveKinematics<NUM_MODULES>&          m_kinematics;
+        wpi::array<frc::Translation2d, NUM_MODULES>             m_moduleLocations;
+
+        bool                                                    m_initialized;
+        SLIP_STATE                                              m_state;
+        units::time::second_t                                   m_holdUntil;
+
+        // previous sample
+        units::time::second_t                                   m_lastTimestamp;
+        units::angle::degree_t                                  m_lastYaw;
+        frc::ChassisSpeeds                                      m_lastSpeeds;
+        double                                                  m_lastMeasuredX;
+        double                                                  m_lastMeasuredY;
+
+        // low pass filtered accelerations (m/s^2, robot frame)
+        double                                                  m_kinematicX;
+        double                                                  m_kinematicY;
+        double                                                  m_measuredX;
+        double                                                  m_measuredY;
+
+        units::velocity::meters_per_second_t                    m_wheelResidual;
+        units::acceleration::meters_per_second_squared_t        m_accelResidual;
+
+        // thresholds (starting points, tune on the robot)
+        const units::time::second_t                             m_maxPeriod = units::time::second_t(0.1);       // longer gaps would look like huge accelerations
+        const units::time::second_t                             m_holdTime = units::time::second_t(0.25);
+        const double                                            m_filterGain = 0.3;                             // single pole low pass on both accelerations
+        const double                                            m_collisionJerk = 400.0;                        // m/s^3 on the raw accelerometer
+        const double                                            m_accelResidualLimit = 3.0;                     // m/s^2
+        const units::velocity::meters_per_second_t              m_wheelResidualLimit = units::velocity::meters_per_second_t(0.5);
+        const units::angular_velocity::radians_per_second_t     m_yawRateResidualLimit = units::angular_velocity::radians_per_second_t(1.0);
+
+        // odometry trust while each state is held
+        const double                                            m_slipTrust = 0.25;
+        const double                                            m_pushedTrust = 0.1;
+        const double                                            m_collisionTrust = 0.1;
+};
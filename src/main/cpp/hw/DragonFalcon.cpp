@@ -29,7 +29,7 @@
 #include <hw/DistanceAngleCalcStruc.h>
 #include <hw/interfaces/IDragonMotorController.h>
 #include <hw/DragonFalcon.h>
-#include <hw/factories/PDPFactory.h>
+#include <hw/DragonPowerManager.h>
 #include <hw/factories/DragonControlToCTREAdapterFactory.h>
 #include <hw/usages/MotorControllerUsage.h>
 #include <utils/Logger.h>
@@ -58,12 +58,14 @@ DragonFalcon::DragonFalcon
 	MOTOR_TYPE 										motorType 
 ) : m_networkTableName(networkTableName),
 	m_talon( make_shared<WPI_TalonFX>(deviceID, canBusName)),
+	m_sensors( &m_talon.get()->GetSensorCollection() ),
 	m_controller(),
 	m_type(deviceType),
 	m_id(deviceID),
 	m_pdp( pdpID ),
 	m_calcStruc(calcStruc),
-	m_motorType(motorType)
+	m_motorType(motorType),
+	m_adapters(networkTableName + string(" - motor ") + to_string(deviceID), calcStruc, m_talon.get())
 {
 	m_networkTableName += string(" - motor ");
 	m_networkTableName += to_string(deviceID);
@@ -270,12 +272,8 @@ shared_ptr<MotorController> DragonFalcon::GetSpeedController() const
 
 double DragonFalcon::GetCurrent() const
 {
-	auto pdp = PDPFactory::GetFactory()->GetPDP();
-	if (pdp != nullptr)
-	{
-		return pdp->GetCurrent(m_pdp);
-	}
-	return 0.0;
+	// read from the once per loop snapshot instead of the CAN bus
+	return DragonPowerManager::GetPowerManager()->GetChannelCurrent(m_pdp);
 }
 
 /**
@@ -595,8 +593,17 @@ void DragonFalcon::SetAsFollowerMotor
 /// @return void
 void DragonFalcon::SetControlConstants(int slot, ControlData* controlInfo)
 {
-	delete m_controller[slot];
-	m_controller[slot] = DragonControlToCTREAdapterFactory::GetFactory()->CreateAdapter(m_networkTableName, slot, controlInfo, m_calcStruc, m_talon.get());
+	// the adapters are kept by m_adapters, so this only allocates/configures the first time controlInfo is used
+	m_controller[slot] = m_adapters.Activate(controlInfo);
+}
+
+/// @brief  Create and configure the adapter for the control constants without making it active
+/// @param [in] int             slot - hardware slot to use
+/// @param [in] ControlData*    pid - the control constants
+/// @return void
+void DragonFalcon::PrepareControlConstants(int slot, ControlData* controlInfo)
+{
+	m_adapters.Prepare(controlInfo);
 }
 
 
@@ -27,6 +27,7 @@
 
 // Team 302 includes
 #include <hw/DistanceAngleCalcStruc.h>
+#include <hw/ctreadapters/DragonControlToCTREAdapterCache.h>
 #include <hw/interfaces/IDragonMotorController.h>
 #include <hw/usages/MotorControllerUsage.h>
 
@@ -61,6 +62,8 @@ class DragonFalcon : public IDragonMotorController
         MotorControllerUsage::MOTOR_CONTROLLER_USAGE GetType() const override;
         int GetID() const override;
         std::shared_ptr<frc::MotorController> GetSpeedController() const override;
+        ctre::phoenix::motorcontrol::can::WPI_TalonFX* GetTalonFX() const override { return m_talon.get(); }
+        ctre::phoenix::motorcontrol::TalonFXSensorCollection* GetTalonFXSensors() const override { return m_sensors; }
         double GetCurrent() const override;
         IDragonMotorController::MOTOR_TYPE GetMotorType() const override;
 
@@ -79,6 +82,12 @@ class DragonFalcon : public IDragonMotorController
         /// @param [in] ControlData*    pid - the control constants
         /// @return void
         void SetControlConstants(int slot, ControlData* controlInfo) override;
+        /// @brief  Create and configure everything needed to use the control constants later without making them
+        ///         active, so the SetControlConstants call when a state is entered doesn't reconfigure the controller.
+        /// @param [in] int             slot - controller slot the constants will be set on
+        /// @param [in] ControlData*    pid - the control constants
+        /// @return void
+        void PrepareControlConstants(int slot, ControlData* controlInfo) override;
 
         // Method:		SelectClosedLoopProfile
         // Description:	Selects which profile slot to use for closed-loop control
@@ -155,11 +164,13 @@ class DragonFalcon : public IDragonMotorController
     private:
         std::string                                                         m_networkTableName;
         std::shared_ptr<ctre::phoenix::motorcontrol::can::WPI_TalonFX>      m_talon;
+        ctre::phoenix::motorcontrol::TalonFXSensorCollection*               m_sensors;
         IDragonControlToVendorControlAdapter*                               m_controller[4];
         MotorControllerUsage::MOTOR_CONTROLLER_USAGE                        m_type;
         int                                                                 m_id;
         int                                                                 m_pdp;
         DistanceAngleCalcStruc                                              m_calcStruc;
         IDragonMotorController::MOTOR_TYPE                                  m_motorType;
+        DragonControlToCTREAdapterCache                                     m_adapters;
 };
 
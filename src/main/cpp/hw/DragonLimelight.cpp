@@ -18,11 +18,16 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <span>
 
 // FRC includes
 #include <networktables/NetworkTableInstance.h>
 #include <networktables/NetworkTable.h>
 #include <networktables/NetworkTableEntry.h>
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/geometry/Transform2d.h>
+#include <frc/geometry/Translation2d.h>
 #include <units/angle.h>
 #include <units/length.h>
 #include <units/time.h>
@@ -48,16 +53,20 @@ DragonLimelight::DragonLimelight
     units::angle::degree_t      rotation,                   /// <I> - clockwise rotation of limelight
     units::angle::degree_t      mountingAngle,              /// <I> - mounting angle of the camera
     units::length::inch_t       targetHeight,               /// <I> - height the target
-    units::length::inch_t       targetHeight2               /// <I> - height of second target
+    units::length::inch_t       targetHeight2,              /// <I> - height of second target
+    units::length::inch_t       mountingForwardOffset,      /// <I> - mounting forward offset from the middle of the robot
+    units::angle::degree_t      mountingYaw                 /// <I> - counter clockwise yaw of the camera relative to the robot front
 ) : //IDragonSensor(),
     //IDragonDistanceSensor(),
+    m_tableName( tableName ),
     m_networktable( NetworkTableInstance::GetDefault().GetTable( tableName.c_str()) ),
     m_mountHeight( mountingHeight ),
     m_mountingHorizontalOffset( mountingHorizontalOffset ),
     m_rotation(rotation),
     m_mountingAngle( mountingAngle ),
     m_targetHeight( targetHeight ),
-    m_targetHeight2( targetHeight2 )
+    m_targetHeight2( targetHeight2 ),
+    m_robotToCamera( frc::Translation2d(mountingForwardOffset, mountingHorizontalOffset), frc::Rotation2d(mountingYaw) )
 {
     //SetLEDMode( DragonLimelight::LED_MODE::LED_OFF);
 }
@@ -99,47 +108,65 @@ units::angle::degree_t DragonLimelight::GetTy() const
 }
 
 units::angle::degree_t DragonLimelight::GetTargetHorizontalOffset() const
+{
+    return GetTargetHorizontalOffset(GetTx(), GetTy());
+}
+
+units::angle::degree_t DragonLimelight::GetTargetHorizontalOffset
+(
+    units::angle::degree_t  tx,
+    units::angle::degree_t  ty
+) const
 {
     if ( abs(m_rotation.to<double>()) < 1.0 )
     {
-        return GetTx();
+        return tx;
     }
     else if ( abs(m_rotation.to<double>()-90.0) < 1.0 )
     {
-        return -1.0 * GetTy();
+        return -1.0 * ty;
     }
     else if ( abs(m_rotation.to<double>()-180.0) < 1.0 )
     {
-        return -1.0 * GetTx();
+        return -1.0 * tx;
     }
     else if ( abs(m_rotation.to<double>()-270.0) < 1.0 )
     {
-        return GetTy();
+        return ty;
     }
     Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("DragonLimelight"), string("GetTargetVerticalOffset"), string("Invalid limelight rotation"));
-    return GetTx();
+    return tx;
 }
 
 units::angle::degree_t DragonLimelight::GetTargetVerticalOffset() const
+{
+    return GetTargetVerticalOffset(GetTx(), GetTy());
+}
+
+units::angle::degree_t DragonLimelight::GetTargetVerticalOffset
+(
+    units::angle::degree_t  tx,
+    units::angle::degree_t  ty
+) const
 {
     if ( abs(m_rotation.to<double>()) < 1.0 )
     {
-        return GetTy();
+        return ty;
     }
     else if ( abs(m_rotation.to<double>()-90.0) < 1.0 )
     {
-        return GetTx();
+        return tx;
     }
     else if ( abs(m_rotation.to<double>()-180.0) < 1.0 )
     {
-        return -1.0 * GetTy();
+        return -1.0 * ty;
     }
     else if ( abs(m_rotation.to<double>()-270.0) < 1.0 )
     {
-        return -1.0 * GetTx();
+        return -1.0 * tx;
     }
     Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("DragonLimelight"), string("GetTargetVerticalOffset"), string("Invalid limelight rotation"));
-    return GetTy();   
+    return ty;   
 }
 
 double DragonLimelight::GetTargetArea() const
@@ -167,11 +194,41 @@ units::time::microsecond_t DragonLimelight::GetPipelineLatency() const
     auto nt = m_networktable.get();
     if (nt != nullptr)
     {
-        return units::time::second_t(nt->GetNumber("tl", 0.0));
+        return units::time::millisecond_t(nt->GetNumber("tl", 0.0));
     }
-    return units::time::second_t(0.0);
+    return units::time::millisecond_t(0.0);
 }
 
+units::time::millisecond_t DragonLimelight::GetCaptureLatency() const
+{
+    auto nt = m_networktable.get();
+    if (nt != nullptr)
+    {
+        return units::time::millisecond_t(nt->GetNumber("cl", 0.0));
+    }
+    return units::time::millisecond_t(0.0);
+}
+
+bool DragonLimelight::GetBotPose
+(
+    frc::Pose2d&    pose
+) const
+{
+    auto nt = m_networktable.get();
+    if (nt != nullptr)
+    {
+        // x, y, z, roll, pitch, yaw in meters and degrees from the blue alliance origin
+        auto botpose = nt->GetNumberArray("botpose_wpiblue", std::span<const double>{});
+        if (botpose.size() >= 6)
+        {
+            pose = frc::Pose2d(units::length::meter_t(botpose[0]), 
+                               units::length::meter_t(botpose[1]), 
+                               frc::Rotation2d(units::angle::degree_t(botpose[5])));
+            return true;
+        }
+    }
+    return false;
+}
 
 void DragonLimelight::SetTargetHeight
 (
@@ -275,4 +332,18 @@ units::length::inch_t DragonLimelight::EstimateTargetDistance() const
     return (GetTargetHeight()-GetMountingHeight()) / tanAngle;
 }
 
+units::length::inch_t DragonLimelight::EstimateTargetDistance
+(
+    units::angle::degree_t  verticalOffset
+) const
+{
+    units::angle::radian_t angleRad = GetMountingAngle() + verticalOffset;
+    double tanAngle = tan(angleRad.to<double>());
+    if (abs(tanAngle) < 0.0001)
+    {
+        return units::length::inch_t(0.0);
+    }
+    return (GetTargetHeight()-GetMountingHeight()) / tanAngle;
+}
+
 
@@ -23,6 +23,8 @@
 #include <vector>
 
 // FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Transform2d.h>
 #include <networktables/NetworkTable.h>
 #include <units/angle.h>
 #include <units/length.h>
@@ -79,7 +81,9 @@ class DragonLimelight //: public IDragonSensor, public IDragonDistanceSensor
             units::angle::degree_t      rotation,                   /// <I> - clockwise rotation of limelight
             units::angle::degree_t      mountingAngle,              /// <I> - mounting angle of the camera
             units::length::inch_t       targetHeight,               /// <I> - height the target
-            units::length::inch_t       targetHeight2               /// <I> - height of second target
+            units::length::inch_t       targetHeight2,              /// <I> - height of second target
+            units::length::inch_t       mountingForwardOffset,      /// <I> - mounting forward offset from the middle of the robot
+            units::angle::degree_t      mountingYaw                 /// <I> - counter clockwise yaw of the camera relative to the robot front
         );
 
         ///-----------------------------------------------------------------------------------
@@ -93,10 +97,48 @@ class DragonLimelight //: public IDragonSensor, public IDragonDistanceSensor
         bool HasTarget() const;
         units::angle::degree_t GetTargetHorizontalOffset() const;
         units::angle::degree_t GetTargetVerticalOffset() const;
+
+        /// @brief Raw tx and ty from the network table (camera image axes, not corrected for the mounting rotation)
+        units::angle::degree_t GetTx() const;
+        units::angle::degree_t GetTy() const;
+
+        /// @brief Correct raw tx and ty that were read earlier for the mounting rotation (see GetTargetHorizontalOffset
+        ///        and GetTargetVerticalOffset).  Logs an invalid rotation, so call these from the main thread.
+        /// @param [in] units::angle::degree_t  tx: raw horizontal offset
+        /// @param [in] units::angle::degree_t  ty: raw vertical offset
+        /// @returns units::angle::degree_t  offset to the target
+        units::angle::degree_t GetTargetHorizontalOffset
+        (
+            units::angle::degree_t  tx,
+            units::angle::degree_t  ty
+        ) const;
+        units::angle::degree_t GetTargetVerticalOffset
+        (
+            units::angle::degree_t  tx,
+            units::angle::degree_t  ty
+        ) const;
+
         double GetTargetArea() const;
         units::angle::degree_t GetTargetSkew() const;
         units::time::microsecond_t GetPipelineLatency() const;
+        units::time::millisecond_t GetCaptureLatency() const;
         units::length::inch_t EstimateTargetDistance() const;
+
+        /// @brief Estimate the floor distance from the camera to the target without logging (safe to call off the main thread)
+        /// @param [in] units::angle::degree_t  verticalOffset: vertical offset to the target (see GetTargetVerticalOffset)
+        /// @returns units::length::inch_t  distance from the camera lens to the target
+        units::length::inch_t EstimateTargetDistance
+        (
+            units::angle::degree_t  verticalOffset
+        ) const;
+
+        /// @brief Get the robot pose the limelight solved from the field targets (botpose_wpiblue)
+        /// @param [out] frc::Pose2d&  pose:    solved robot pose in field coordinates
+        /// @returns bool   true if the limelight published a valid pose
+        bool GetBotPose
+        (
+            frc::Pose2d&    pose
+        ) const;
         std::vector<double> Get3DSolve() const;
 
         // Setters
@@ -147,11 +189,14 @@ class DragonLimelight //: public IDragonSensor, public IDragonDistanceSensor
         units::angle::degree_t GetMountingAngle() const {return m_mountingAngle;}
         units::length::inch_t  GetMountingHeight() const {return m_mountHeight;}
         units::length::inch_t  GetTargetHeight() const {return m_targetHeight;}
+        std::string GetNetworkTableName() const {return m_tableName;}
+
+        /// @brief Transform from the robot center to the camera lens on the floor plane
+        frc::Transform2d GetRobotToCameraTransform() const {return m_robotToCamera;}
 
     private:
-        units::angle::degree_t GetTx() const;
-        units::angle::degree_t GetTy() const;
         
+        std::string m_tableName;
         std::shared_ptr<nt::NetworkTable> m_networktable;
         units::length::inch_t m_mountHeight;
         units::length::inch_t m_mountingHorizontalOffset;
@@ -159,6 +204,7 @@ class DragonLimelight //: public IDragonSensor, public IDragonDistanceSensor
         units::angle::degree_t m_mountingAngle;
         units::length::inch_t m_targetHeight;
         units::length::inch_t m_targetHeight2;
+        frc::Transform2d m_robotToCamera;
 
         double PI = 3.14159265;
 
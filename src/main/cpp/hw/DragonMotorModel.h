@@ -0,0 +1,241 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <cmath>
+
+// FRC includes
+#include <units/angle.h>
+#include <units/angular_velocity.h>
+#include <units/current.h>
+#include <units/length.h>
+#include <units/mass.h>
+#include <units/moment_of_inertia.h>
+#include <units/velocity.h>
+#include <units/voltage.h>
+
+// Team 302 includes
+#include <hw/MotorData.h>
+#include <hw/interfaces/IDragonMotorController.h>
+
+/// @struct DragonFeedforward
+/// @brief  voltage = kS*sign(v) + kV*v + kA*a + kG (elevator) or kG*cos(angle) (arm).  The velocity units are
+///         the ones the gains were created for (meters or radians per second).
+struct DragonFeedforward
+{
+    double  kS;     ///< volts to overcome the motor friction
+    double  kV;     ///< volts per unit of velocity
+    double  kA;     ///< volts per unit of acceleration
+    double  kG;     ///< volts to hold against gravity
+
+    /// @brief  voltage for a velocity / acceleration setpoint (elevator or drivetrain)
+    constexpr double Calculate(double velocity, double acceleration) const
+    {
+        return (velocity > 0.0 ? kS : velocity < 0.0 ? -kS : 0.0) + kV*velocity + kA*acceleration + kG;
+    }
+
+    /// @brief  voltage for an arm setpoint; kG is scaled by the cosine of the angle from horizontal
+    double CalculateArm(units::angle::radian_t angle, double velocity, double acceleration) const
+    {
+        return (velocity > 0.0 ? kS : velocity < 0.0 ? -kS : 0.0) + kV*velocity + kA*acceleration + kG*std::cos(angle.to<double>());
+    }
+};
+
+/// @class DragonMotorModel
+/// @brief DC motor model built from the MotorData table:
+///            V = I*R + w/Kv      torque = Kt*I
+///        A model is a motor type, the number of motors driving the mechanism and the gear ratio
+///        (motor revolutions per output revolution, the same meaning as gearRatio in robot.xml).
+///        Everything is constexpr so a mechanism's constants can be computed at compile time.
+class DragonMotorModel
+{
+    public:
+        static constexpr double NOMINAL_VOLTAGE = 12.0;
+        static constexpr double GRAVITY = 9.80665;      // m/s^2
+
+        constexpr DragonMotorModel
+        (
+            IDragonMotorController::MOTOR_TYPE  motorType,
+            int                                 numMotors,
+            double                              gearRatio
+        ) : m_spec(MotorData::GetSpec(motorType)),
+            m_numMotors(numMotors > 0 ? numMotors : 1),
+            m_gearRatio(gearRatio > 0.0 ? gearRatio : 1.0)
+        {
+        }
+
+        /// @brief  false for unknown motors (all the constants are zero)
+        constexpr bool IsValid() const { return m_spec.stallCurrent > 0 && m_spec.freeSpeed > 0; }
+
+        /// @brief  winding resistance in ohms
+        constexpr double GetResistance() const { return IsValid() ? NOMINAL_VOLTAGE / m_spec.stallCurrent : 0.0; }
+
+        /// @brief  velocity constant in motor rad/s per volt of back EMF
+        constexpr double GetKv() const
+        {
+            return IsValid() ? FreeSpeed() / (NOMINAL_VOLTAGE - GetResistance()*m_spec.freeCurrent) : 0.0;
+        }
+
+        /// @brief  torque constant in newton meters per amp
+        constexpr double GetKt() const { return IsValid() ? m_spec.stallTorque / m_spec.stallCurrent : 0.0; }
+
+        /// @brief  volts needed to overcome the motor's own friction (free current through the winding)
+        constexpr double GetKs() const { return GetResistance()*m_spec.freeCurrent; }
+
+        constexpr int GetNumMotors() const { return m_numMotors; }
+        constexpr double GetGearRatio() const { return m_gearRatio; }
+
+        /// @brief  feedforward for a spinning wheel / roller (kV in volts per output rad/s)
+        /// @param [in] units::kilogram_square_meter_t inertia: moment of inertia at the output shaft
+        constexpr DragonFeedforward Flywheel
+        (
+            units::moment_of_inertia::kilogram_square_meter_t   inertia
+        ) const
+        {
+            if (!IsValid())
+            {
+                return DragonFeedforward{ 0.0, 0.0, 0.0, 0.0 };
+            }
+            return DragonFeedforward{ GetKs(), 
+                                      m_gearRatio / GetKv(), 
+                                      TorqueToVolts() * inertia.to<double>(), 
+                                      0.0 };
+        }
+
+        /// @brief  feedforward for a carriage lifted by a drum or sprocket (kV in volts per m/s)
+        /// @param [in] units::kilogram_t  mass:        moving mass
+        /// @param [in] units::meter_t     drumRadius:  radius of the drum / pitch radius of the sprocket
+        constexpr DragonFeedforward Elevator
+        (
+            units::mass::kilogram_t     mass,
+            units::length::meter_t      drumRadius
+        ) const
+        {
+            if (!IsValid() || drumRadius.to<double>() <= 0.0)
+            {
+                return DragonFeedforward{ 0.0, 0.0, 0.0, 0.0 };
+            }
+            auto r = drumRadius.to<double>();
+            auto m = mass.to<double>();
+            return DragonFeedforward{ GetKs(), 
+                                      m_gearRatio / (GetKv()*r), 
+                                      TorqueToVolts() * m * r, 
+                                      TorqueToVolts() * m * GRAVITY * r };
+        }
+
+        /// @brief  feedforward for an arm pivoting at the output shaft (kV in volts per rad/s, kG at horizontal)
+        /// @param [in] units::kilogram_t               mass:           arm mass
+        /// @param [in] units::meter_t                  comDistance:    pivot to center of mass
+        /// @param [in] units::kilogram_square_meter_t  inertia:        moment of inertia about the pivot
+        constexpr DragonFeedforward Arm
+        (
+            units::mass::kilogram_t                             mass,
+            units::length::meter_t                              comDistance,
+            units::moment_of_inertia::kilogram_square_meter_t   inertia
+        ) const
+        {
+            if (!IsValid())
+            {
+                return DragonFeedforward{ 0.0, 0.0, 0.0, 0.0 };
+            }
+            return DragonFeedforward{ GetKs(), 
+                                      m_gearRatio / GetKv(), 
+                                      TorqueToVolts() * inertia.to<double>(), 
+                                      TorqueToVolts() * mass.to<double>() * GRAVITY * comDistance.to<double>() };
+        }
+
+        /// @brief  feedforward for a drivetrain where this model is the motors on one wheel and the wheel 
+        ///         carries massShare of the robot (kV in volts per m/s of wheel speed)
+        /// @param [in] units::kilogram_t  massShare:    robot mass divided by the number of driven wheels
+        /// @param [in] units::meter_t     wheelRadius:  wheel radius
+        constexpr DragonFeedforward Drivetrain
+        (
+            units::mass::kilogram_t     massShare,
+            units::length::meter_t      wheelRadius
+        ) const
+        {
+            auto ff = Elevator(massShare, wheelRadius);
+            ff.kG = 0.0;
+            return ff;
+        }
+
+        /// @brief  current drawn by each motor
+        /// @param [in] units::volt_t                   voltage:        applied voltage
+        /// @param [in] units::radians_per_second_t     outputSpeed:    speed of the output shaft
+        constexpr units::current::ampere_t PredictCurrent
+        (
+            units::voltage::volt_t                          voltage,
+            units::angular_velocity::radians_per_second_t   outputSpeed
+        ) const
+        {
+            return units::current::ampere_t(IsValid() ? (voltage.to<double>() - m_gearRatio*outputSpeed.to<double>()/GetKv()) / GetResistance() : 0.0);
+        }
+
+        /// @brief  largest voltage that keeps each motor at or under currentLimit at the output speed
+        constexpr units::voltage::volt_t MaxVoltageForCurrent
+        (
+            units::current::ampere_t                        currentLimit,
+            units::angular_velocity::radians_per_second_t   outputSpeed
+        ) const
+        {
+            return units::voltage::volt_t(IsValid() ? currentLimit.to<double>()*GetResistance() + m_gearRatio*outputSpeed.to<double>()/GetKv() : 0.0);
+        }
+
+    private:
+        constexpr double FreeSpeed() const { return m_spec.freeSpeed * 2.0 * 3.14159265358979323846 / 60.0; }
+
+        // volts per newton meter at the output shaft (shared by all the motors)
+        constexpr double TorqueToVolts() const
+        {
+            return IsValid() ? GetResistance() / (m_numMotors * m_gearRatio * GetKt()) : 0.0;
+        }
+
+        MotorSpec   m_spec;
+        int         m_numMotors;
+        double      m_gearRatio;
+};
+
+// The model checked against values worked out by hand from the MotorData table (DragonMotorModelTest has the
+// derivations), so any build that includes this fails if the model or the table changes.
+namespace DragonMotorModelCheck
+{
+    constexpr bool Near(double value, double expected, double tolerance) { return value-expected <= tolerance && expected-value <= tolerance; }
+
+    constexpr DragonMotorModel FALCON(IDragonMotorController::MOTOR_TYPE::FALCON500, 1, 1.0);
+    static_assert(Near(FALCON.GetResistance(), 0.046693, 1e-6), "Falcon 500 R = 12/257 ohm");
+    static_assert(Near(FALCON.GetKv(), 56.003, 1e-3), "Falcon 500 Kv = 668.1 rad/s / (12 - R*1.5 A)");
+    static_assert(Near(FALCON.GetKt(), 0.018249, 1e-6), "Falcon 500 Kt = 4.69/257 Nm/A");
+
+    constexpr DragonMotorModel NEO(IDragonMotorController::MOTOR_TYPE::NEOMOTOR, 1, 1.0);
+    static_assert(Near(NEO.GetResistance(), 0.072289, 1e-6), "NEO R = 12/166 ohm");
+    static_assert(Near(NEO.GetKv(), 51.718, 1e-3), "NEO Kv = 615.8 rad/s / (12 - R*1.3 A)");
+    static_assert(Near(NEO.GetKt(), 0.020241, 1e-6), "NEO Kt = 3.36/166 Nm/A");
+
+    // one falcon at 1.5:1 spinning 0.01 kg m^2; two neos at 10:1 lifting 5 kg on a 2 cm drum; one falcon at 100:1 on a 3 kg arm
+    static_assert(Near(DragonMotorModel(IDragonMotorController::MOTOR_TYPE::FALCON500, 1, 1.5).Flywheel(units::moment_of_inertia::kilogram_square_meter_t(0.01)).kV, 0.026784, 1e-6));
+    static_assert(Near(DragonMotorModel(IDragonMotorController::MOTOR_TYPE::NEOMOTOR, 2, 10.0).Elevator(units::mass::kilogram_t(5.0), units::length::meter_t(0.02)).kV, 9.6680, 1e-3));
+    static_assert(Near(DragonMotorModel(IDragonMotorController::MOTOR_TYPE::NEOMOTOR, 2, 10.0).Elevator(units::mass::kilogram_t(5.0), units::length::meter_t(0.02)).kG, 0.17512, 1e-5));
+    static_assert(Near(DragonMotorModel(IDragonMotorController::MOTOR_TYPE::FALCON500, 1, 100.0).Arm(units::mass::kilogram_t(3.0), units::length::meter_t(0.5), units::moment_of_inertia::kilogram_square_meter_t(1.0)).kV, 1.78562, 1e-5));
+    static_assert(Near(DragonMotorModel(IDragonMotorController::MOTOR_TYPE::FALCON500, 1, 100.0).Arm(units::mass::kilogram_t(3.0), units::length::meter_t(0.5), units::moment_of_inertia::kilogram_square_meter_t(1.0)).kG, 0.37637, 1e-5));
+
+    // the voltage MaxVoltageForCurrent allows draws the limit
+    constexpr DragonMotorModel SWERVE_DRIVE(IDragonMotorController::MOTOR_TYPE::FALCON500, 1, 6.75);
+    static_assert(Near(SWERVE_DRIVE.PredictCurrent(SWERVE_DRIVE.MaxVoltageForCurrent(units::current::ampere_t(40.0), units::angular_velocity::radians_per_second_t(30.0)),
+                                                   units::angular_velocity::radians_per_second_t(30.0)).to<double>(), 40.0, 1e-9));
+}
@@ -0,0 +1,315 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <string>
+
+// FRC includes
+#include <frc/PowerDistribution.h>
+
+// Team 302 includes
+#include <hw/DragonPowerManager.h>
+#include <hw/factories/PDPFactory.h>
+#include <hw/interfaces/IDragonMotorController.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+DragonPowerManager* DragonPowerManager::m_instance = nullptr;
+DragonPowerManager* DragonPowerManager::GetPowerManager()
+{
+    if ( DragonPowerManager::m_instance == nullptr )
+    {
+        DragonPowerManager::m_instance = new DragonPowerManager();
+    }
+    return DragonPowerManager::m_instance;
+}
+
+DragonPowerManager::DragonPowerManager() : LoggableItem(),
+                                           m_channelCurrents(),
+                                           m_numChannels(0),
+                                           m_hasSnapshot(false),
+                                           m_voltage(units::voltage::volt_t(12.0)),
+                                           m_totalCurrent(0.0),
+                                           m_consumers(),
+                                           m_numConsumers(0),
+                                           m_scale(),
+                                           m_voltageFloor(units::voltage::volt_t(7.5)),
+                                           m_batteryResistance(0.02),
+                                           m_predictedVoltage(units::voltage::volt_t(12.0)),
+                                           m_minVoltage(units::voltage::volt_t(12.0)),
+                                           m_shedCurrent(0.0),
+                                           m_totalShedCurrent(0.0),
+                                           m_limitedLoops(0)
+{
+    m_channelCurrents.fill(0.0);
+    m_scale.fill(1.0);
+}
+
+int DragonPowerManager::Register
+(
+    shared_ptr<IDragonMotorController>  motor,
+    POWER_PRIORITY                      priority
+)
+{
+    if ( motor.get() == nullptr || priority < 0 || priority >= MAX_PRIORITIES )
+    {
+        return -1;
+    }
+
+    for ( auto inx=0; inx<m_numConsumers; ++inx )
+    {
+        if ( m_consumers[inx].motor.get() == motor.get() )
+        {
+            return inx;
+        }
+    }
+
+    DragonMotorModel model(motor.get()->GetMotorType(), 1, motor.get()->GetGearRatio());
+    if ( m_numConsumers >= m_maxConsumers || !model.IsValid() )
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("DragonPowerManager"), string("Register"), string("motor can't be modeled or too many motors"));
+        return -1;
+    }
+
+    auto& consumer = m_consumers[m_numConsumers];
+    consumer.motor = motor;
+    consumer.model = model;
+    consumer.priority = priority;
+    consumer.command = 0.0;
+    consumer.applied = 0.0;
+    consumer.backEMF = 0.0;
+    return m_numConsumers++;
+}
+
+double DragonPowerManager::Request
+(
+    int         handle,
+    double      outputFraction
+)
+{
+    if ( handle < 0 || handle >= m_numConsumers )
+    {
+        return 1.0;
+    }
+    auto& consumer = m_consumers[handle];
+    auto scale = m_scale[consumer.priority];
+    consumer.command = clamp(outputFraction, -1.0, 1.0);
+    consumer.applied = consumer.command * scale;
+    return scale;
+}
+
+bool DragonPowerManager::CanScale
+(
+    ControlModes::CONTROL_TYPE  mode
+)
+{
+    return mode == ControlModes::CONTROL_TYPE::PERCENT_OUTPUT ||
+           mode == ControlModes::CONTROL_TYPE::VOLTAGE ||
+           mode == ControlModes::CONTROL_TYPE::VELOCITY_RPS ||
+           mode == ControlModes::CONTROL_TYPE::VELOCITY_DEGREES;
+}
+
+double DragonPowerManager::ScaleTarget
+(
+    int                             handle,
+    ControlModes::CONTROL_TYPE      mode,
+    double                          target
+)
+{
+    if ( handle < 0 || handle >= m_numConsumers )
+    {
+        return target;
+    }
+
+    // turn the target into the output fraction it needs
+    auto& model = m_consumers[handle].model;
+    auto fraction = 0.0;
+    switch ( mode )
+    {
+        case ControlModes::CONTROL_TYPE::PERCENT_OUTPUT:
+            fraction = target;
+            break;
+
+        case ControlModes::CONTROL_TYPE::VOLTAGE:
+            fraction = target / m_voltage.to<double>();
+            break;
+
+        case ControlModes::CONTROL_TYPE::VELOCITY_RPS:
+            fraction = model.GetGearRatio() * target * 2.0 * numbers::pi / model.GetKv() / m_voltage.to<double>();
+            break;
+
+        case ControlModes::CONTROL_TYPE::VELOCITY_DEGREES:
+            fraction = model.GetGearRatio() * target * numbers::pi / 180.0 / model.GetKv() / m_voltage.to<double>();
+            break;
+
+        default:
+            return target;
+    }
+    return target * Request( handle, fraction );
+}
+
+void DragonPowerManager::Periodic()
+{
+    // snapshot
+    auto pdp = PDPFactory::GetFactory()->GetPDP();
+    if ( pdp != nullptr )
+    {
+        m_voltage = units::voltage::volt_t(pdp->GetVoltage());
+        m_totalCurrent = pdp->GetTotalCurrent();
+        m_numChannels = min(pdp->GetNumChannels(), m_maxChannels);
+        for ( auto inx=0; inx<m_numChannels; ++inx )
+        {
+            m_channelCurrents[inx] = pdp->GetCurrent(inx);
+        }
+        m_hasSnapshot = true;
+    }
+    if ( !m_hasSnapshot )
+    {
+        // without a measured voltage there is nothing to predict from
+        return;
+    }
+    auto volts = m_voltage.to<double>();
+    m_minVoltage = m_voltage < m_minVoltage ? m_voltage : m_minVoltage;
+
+    // back EMF at the measured speeds
+    auto modeledNow = 0.0;
+    for ( auto inx=0; inx<m_numConsumers; ++inx )
+    {
+        auto& consumer = m_consumers[inx];
+        auto speed = consumer.motor.get()->GetRPS() * 2.0 * numbers::pi;
+        consumer.backEMF = consumer.model.GetGearRatio() * speed / consumer.model.GetKv();
+        modeledNow += BatteryCurrent(consumer, consumer.applied);
+    }
+
+    // everything that isn't modeled (compressor, roborio, radio, unregistered motors) is assumed to stay the same
+    auto baseCurrent = max(0.0, m_totalCurrent - modeledNow);
+    auto restVoltage = volts + m_batteryResistance * m_totalCurrent;
+    auto budget = (restVoltage - m_voltageFloor.to<double>()) / m_batteryResistance - baseCurrent;
+
+    array<double, MAX_PRIORITIES> unlimited;
+    auto demand = 0.0;
+    for ( auto p=0; p<MAX_PRIORITIES; ++p )
+    {
+        unlimited[p] = PredictDraw(static_cast<POWER_PRIORITY>(p), 1.0);
+        demand += unlimited[p];
+    }
+
+    // shed from the lowest priority up; bisect for the largest scale that fits
+    array<double, MAX_PRIORITIES> scale;
+    scale.fill(1.0);
+    auto remaining = demand;
+    for ( auto p=0; p<MAX_PRIORITIES && remaining > budget; ++p )
+    {
+        auto others = remaining - unlimited[p];
+        auto low = 0.0;
+        auto high = 1.0;
+        for ( auto iter=0; iter<m_solveIterations; ++iter )
+        {
+            auto mid = 0.5 * (low + high);
+            if ( others + PredictDraw(static_cast<POWER_PRIORITY>(p), mid) > budget )
+            {
+                high = mid;
+            }
+            else
+            {
+                low = mid;
+            }
+        }
+        scale[p] = low;
+        remaining = others + PredictDraw(static_cast<POWER_PRIORITY>(p), low);
+    }
+
+    // shed right away but come back gradually so the voltage doesn't oscillate
+    auto limited = 0.0;
+    for ( auto p=0; p<MAX_PRIORITIES; ++p )
+    {
+        m_scale[p] = min(scale[p], m_scale[p] + m_recoveryPerLoop);
+        limited += PredictDraw(static_cast<POWER_PRIORITY>(p), m_scale[p]);
+    }
+
+    m_predictedVoltage = units::voltage::volt_t(restVoltage - m_batteryResistance * (baseCurrent + limited));
+    m_shedCurrent = max(0.0, demand - limited);
+    m_totalShedCurrent += m_shedCurrent;
+    m_limitedLoops += m_shedCurrent > 0.0 ? 1 : 0;
+}
+
+double DragonPowerManager::BatteryCurrent
+(
+    const Consumer&     consumer,
+    double              outputFraction
+) const
+{
+    // the controller chops the bus voltage, so the battery sees the motor current times the duty cycle
+    // (regenerating motors are counted as zero)
+    auto motorVolts = outputFraction * m_voltage.to<double>();
+    auto resistance = consumer.model.GetResistance();
+    auto motorCurrent = resistance > 0.0 ? (motorVolts - consumer.backEMF) / resistance : 0.0;
+    auto drawn = outputFraction >= 0.0 ? motorCurrent : -1.0 * motorCurrent;
+    return max(0.0, drawn) * abs(outputFraction);
+}
+
+double DragonPowerManager::PredictDraw
+(
+    POWER_PRIORITY      priority,
+    double              scale
+) const
+{
+    auto current = 0.0;
+    for ( auto inx=0; inx<m_numConsumers; ++inx )
+    {
+        auto& consumer = m_consumers[inx];
+        if ( consumer.priority == priority )
+        {
+            current += BatteryCurrent(consumer, consumer.command * scale);
+        }
+    }
+    return current;
+}
+
+double DragonPowerManager::GetChannelCurrent
+(
+    int         channel
+) const
+{
+    if ( m_hasSnapshot )
+    {
+        return channel >= 0 && channel < m_numChannels ? m_channelCurrents[channel] : 0.0;
+    }
+    auto pdp = PDPFactory::GetFactory()->GetPDP();
+    return pdp != nullptr ? pdp->GetCurrent(channel) : 0.0;
+}
+
+void DragonPowerManager::LogInformation() const
+{
+    auto ntName = string("DragonPowerManager");
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, ntName, string("voltage"), m_voltage.to<double>());
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, ntName, string("min voltage"), m_minVoltage.to<double>());
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, ntName, string("predicted voltage"), m_predictedVoltage.to<double>());
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, ntName, string("total current"), m_totalCurrent);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, ntName, string("mechanism scale"), m_scale[MECHANISM]);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, ntName, string("drive scale"), m_scale[DRIVE]);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, ntName, string("shed current"), m_shedCurrent);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, ntName, string("total shed current"), m_totalShedCurrent);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, ntName, string("limited loops"), m_limitedLoops);
+}
@@ -0,0 +1,185 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <memory>
+
+// FRC includes
+#include <units/voltage.h>
+
+// Team 302 includes
+#include <LoggableItem.h>
+#include <hw/DragonMotorModel.h>
+#include <hw/interfaces/IDragonMotorController.h>
+#include <mechanisms/controllers/ControlModes.h>
+
+/// @class DragonPowerManager
+/// @brief Keeps the battery above a voltage floor by scaling motor commands before a brownout instead of after one.
+///
+///        Once per robot loop (Periodic) the PDP channel currents and bus voltage are read into a snapshot; the motor
+///        GetCurrent calls read that snapshot instead of the CAN bus.  The commands the registered motors asked for
+///        this loop are run through each motor's DragonMotorModel (using the measured speed for the back EMF) to
+///        predict the battery current for the next loop.  If that current would pull the battery below the floor
+///        the lowest priority commands are scaled down first (mechanisms before the drive).
+///
+///        Everything is in fixed size arrays and the solve is a fixed number of bisection steps, so the per loop cost
+///        only depends on the number of registered motors.
+class DragonPowerManager : public LoggableItem
+{
+    public:
+        /// @brief  shed order: the first priority is scaled down first
+        enum POWER_PRIORITY
+        {
+            MECHANISM,
+            DRIVE,
+            MAX_PRIORITIES
+        };
+
+        /// @brief  Find or create the power manager
+        static DragonPowerManager* GetPowerManager();
+
+        /// @brief  Add a motor whose commands can be scaled.  Registering the same motor again returns the same handle.
+        /// @param [in] std::shared_ptr<IDragonMotorController> motor:      motor
+        /// @param [in] POWER_PRIORITY                          priority:   shed order
+        /// @return int     handle for Request/ScaleTarget or -1 if the motor can't be added
+        int Register
+        (
+            std::shared_ptr<IDragonMotorController>     motor,
+            POWER_PRIORITY                              priority
+        );
+
+        /// @brief  Record the output a motor is commanded to this loop and get the scale to apply to it
+        /// @param [in] int     handle:         handle from Register
+        /// @param [in] double  outputFraction: commanded output as a fraction of the bus voltage (-1.0 to 1.0)
+        /// @return double  scale (0.0 to 1.0) to multiply the command by
+        double Request
+        (
+            int                                         handle,
+            double                                      outputFraction
+        );
+
+        /// @brief  Request for a mechanism target:  percent output, voltage and velocity (RPS / degrees per second) 
+        ///         targets are scaled, anything else is returned as is.
+        /// @param [in] int                         handle: handle from Register
+        /// @param [in] ControlModes::CONTROL_TYPE  mode:   control mode of the target
+        /// @param [in] double                      target: target in the control mode's units
+        /// @return double  target to send to the motor
+        double ScaleTarget
+        (
+            int                                         handle,
+            ControlModes::CONTROL_TYPE                  mode,
+            double                                      target
+        );
+
+        /// @brief  true if ScaleTarget can scale targets in this control mode
+        static bool CanScale
+        (
+            ControlModes::CONTROL_TYPE                  mode
+        );
+
+        /// @brief  Take the PDP snapshot and solve the scales for the next loop.  Call once per robot loop after the
+        ///         mechanisms and the chassis have been commanded.
+        void Periodic();
+
+        /// @brief  current on a PDP channel from the last snapshot (reads the PDP if there isn't a snapshot yet)
+        double GetChannelCurrent
+        (
+            int                                         channel
+        ) const;
+
+        /// @brief  bus voltage from the last snapshot
+        units::voltage::volt_t GetVoltage() const { return m_voltage; }
+
+        /// @brief  current scale for a priority
+        double GetScale
+        (
+            POWER_PRIORITY                              priority
+        ) const { return m_scale[priority]; }
+
+        /// @brief  voltage the solve keeps the battery above (default 7.5 V; the roborio browns out at 6.8 V)
+        void SetVoltageFloor
+        (
+            units::voltage::volt_t                      floor
+        ) { m_voltageFloor = floor; }
+
+        /// @brief  battery internal resistance plus wiring (default 0.02 ohms)
+        void SetBatteryResistance
+        (
+            double                                      ohms
+        ) { m_batteryResistance = ohms > 0.0 ? ohms : m_batteryResistance; }
+
+        /// @brief  log the snapshot and how much output was shed
+        void LogInformation() const override;
+
+    private:
+        DragonPowerManager();
+        ~DragonPowerManager() = default;
+
+        struct Consumer
+        {
+            std::shared_ptr<IDragonMotorController>     motor;
+            DragonMotorModel                            model = DragonMotorModel(IDragonMotorController::MOTOR_TYPE::NONE, 1, 1.0);
+            POWER_PRIORITY                              priority;
+            double                                      command;        ///< requested output fraction
+            double                                      applied;        ///< command * scale that was handed back
+            double                                      backEMF;        ///< volts at the measured speed
+        };
+
+        /// @brief  battery current for one motor at an output fraction
+        double BatteryCurrent
+        (
+            const Consumer&                             consumer,
+            double                                      outputFraction
+        ) const;
+
+        /// @brief  predicted battery current for a priority with its commands scaled
+        double PredictDraw
+        (
+            POWER_PRIORITY                              priority,
+            double                                      scale
+        ) const;
+
+        static constexpr int                            m_maxChannels = 24;
+        static constexpr int                            m_maxConsumers = 32;
+        static constexpr int                            m_solveIterations = 10;
+        static constexpr double                         m_recoveryPerLoop = 0.05;
+
+        std::array<double, m_maxChannels>               m_channelCurrents;
+        int                                             m_numChannels;
+        bool                                            m_hasSnapshot;
+        units::voltage::volt_t                          m_voltage;
+        double                                          m_totalCurrent;
+
+        std::array<Consumer, m_maxConsumers>            m_consumers;
+        int                                             m_numConsumers;
+        std::array<double, MAX_PRIORITIES>              m_scale;
+
+        units::voltage::volt_t                          m_voltageFloor;
+        double                                          m_batteryResistance;
+
+        // telemetry
+        units::voltage::volt_t                          m_predictedVoltage;
+        units::voltage::volt_t                          m_minVoltage;
+        double                                          m_shedCurrent;
+        double                                          m_totalShedCurrent;
+        int                                             m_limitedLoops;
+
+        static DragonPowerManager*                      m_instance;
+};
@@ -78,6 +78,12 @@ class DragonTalonBase : public IDragonMotorController
         /// @param [in] ControlData*    pid - the control constants
         /// @return void
         void SetControlConstants(int slot, ControlData* controlInfo) override;
+        /// @brief  Create and configure everything needed to use the control constants later without making them
+        ///         active, so the SetControlConstants call when a state is entered doesn't reconfigure the controller.
+        /// @param [in] int             slot - controller slot the constants will be set on
+        /// @param [in] ControlData*    pid - the control constants
+        /// @return void
+        void PrepareControlConstants(int slot, ControlData* controlInfo) override;
         // Method:		SelectClosedLoopProfile
         // Description:	Selects which profile slot to use for closed-loop control
         // Returns:		void
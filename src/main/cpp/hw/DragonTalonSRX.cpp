@@ -30,7 +30,7 @@
 #include <hw/factories/DragonControlToCTREAdapterFactory.h>
 #include <hw/interfaces/IDragonMotorController.h>
 #include <hw/DragonTalonSRX.h>
-#include <hw/factories/PDPFactory.h>
+#include <hw/DragonPowerManager.h>
 #include <hw/usages/MotorControllerUsage.h>
 #include <hw/DistanceAngleCalcStruc.h>
 #include <utils/ConversionUtils.h>
@@ -64,7 +64,8 @@ DragonTalonSRX::DragonTalonSRX
 	m_id(deviceID),
 	m_pdp( pdpID ),
 	m_calcStruc(calcStruc),
-	m_motorType(motorType)
+	m_motorType(motorType),
+	m_adapters(networkTableName + string(" - motor ") + to_string(deviceID), calcStruc, m_talon.get())
 {
 	m_networkTableName += string(" - motor ");
 	m_networkTableName += to_string(deviceID);
@@ -202,12 +203,8 @@ shared_ptr<MotorController> DragonTalonSRX::GetSpeedController() const
 
 double DragonTalonSRX::GetCurrent() const
 {
-	auto pdp = PDPFactory::GetFactory()->GetPDP();
-	if (pdp != nullptr)
-	{
-		return pdp->GetCurrent(m_pdp);
-	}
-	return 0.0;
+	// read from the once per loop snapshot instead of the CAN bus
+	return DragonPowerManager::GetPowerManager()->GetChannelCurrent(m_pdp);
 }
 
 /**
@@ -442,8 +439,17 @@ void DragonTalonSRX::SetAsFollowerMotor
 /// @return void
 void DragonTalonSRX::SetControlConstants(int slot, ControlData* controlInfo)
 {
-	delete m_controller[slot];
-	m_controller[slot] = DragonControlToCTREAdapterFactory::GetFactory()->CreateAdapter(m_networkTableName, slot, controlInfo, m_calcStruc, m_talon.get());
+	// the adapters are kept by m_adapters, so this only allocates/configures the first time controlInfo is used
+	m_controller[slot] = m_adapters.Activate(controlInfo);
+}
+
+/// @brief  Create and configure the adapter for the control constants without making it active
+/// @param [in] int             slot - hardware slot to use
+/// @param [in] ControlData*    pid - the control constants
+/// @return void
+void DragonTalonSRX::PrepareControlConstants(int slot, ControlData* controlInfo)
+{
+	m_adapters.Prepare(controlInfo);
 }
 
 void DragonTalonSRX::SetForwardLimitSwitch
@@ -25,6 +25,7 @@
 
 #include <hw/DistanceAngleCalcStruc.h>
 #include <hw/interfaces/IDragonControlToVendorControlAdapter.h>
+#include <hw/ctreadapters/DragonControlToCTREAdapterCache.h>
 #include <hw/interfaces/IDragonMotorController.h>
 #include <hw/usages/MotorControllerUsage.h>
 #include <mechanisms/controllers/ControlModes.h>
@@ -60,6 +61,7 @@ class DragonTalonSRX : public IDragonMotorController
         MotorControllerUsage::MOTOR_CONTROLLER_USAGE GetType() const override;
         int GetID() const override;
         std::shared_ptr<frc::MotorController> GetSpeedController() const override;
+        ctre::phoenix::motorcontrol::can::WPI_TalonSRX* GetTalonSRX() const override { return m_talon.get(); }
         double GetCurrent() const override;
         IDragonMotorController::MOTOR_TYPE GetMotorType() const override;
 
@@ -77,6 +79,12 @@ class DragonTalonSRX : public IDragonMotorController
         /// @param [in] ControlData*    pid - the control constants
         /// @return void
         void SetControlConstants(int slot, ControlData* controlInfo) override;
+        /// @brief  Create and configure everything needed to use the control constants later without making them
+        ///         active, so the SetControlConstants call when a state is entered doesn't reconfigure the controller.
+        /// @param [in] int             slot - controller slot the constants will be set on
+        /// @param [in] ControlData*    pid - the control constants
+        /// @return void
+        void PrepareControlConstants(int slot, ControlData* controlInfo) override;
         // Method:		SelectClosedLoopProfile
         // Description:	Selects which profile slot to use for closed-loop control
         // Returns:		void
@@ -165,6 +173,7 @@ class DragonTalonSRX : public IDragonMotorController
         int                                                                 m_pdp;
         DistanceAngleCalcStruc                                              m_calcStruc;
         IDragonMotorController::MOTOR_TYPE                                  m_motorType;
+        DragonControlToCTREAdapterCache                                     m_adapters;
 };
 
 typedef std::vector<DragonTalonSRX*> DragonTalonSRXVector;
\ No newline at end of file
@@ -17,137 +17,77 @@
 /// @class MotorData
 /// @brief 
 ///        Creating a motor data class to get the stall current, free current, etc. of a motor.
+///        The values are one constexpr table indexed by motor type, so the lookups can be done
+///        at compile time (see DragonMotorModel) as well as at run time.
 /// --------------------------------------------------------------------------------------------
 #pragma once
+// C++ Includes
+#include <array>
+#include <memory>
+
 // Third Party Includes
 
 //302 includes
 #include <hw/interfaces/IDragonMotorController.h>
 
+/// @struct MotorSpec
+/// @brief  manufacturer data for one motor at 12 volts
+struct MotorSpec
+{
+    int     stallCurrent;   ///< amps
+    double  freeCurrent;    ///< amps
+    int     freeSpeed;      ///< rpm
+    int     maximumPower;   ///< watts
+    double  stallTorque;    ///< newton meters
+};
+
 class MotorData
 {
     public:
-        int getStallCurrent(IDragonMotorController::MOTOR_TYPE motorType) const;
-        double getFreeCurrent(IDragonMotorController::MOTOR_TYPE motorType) const;
-        int getFreeSpeed(IDragonMotorController::MOTOR_TYPE motorType) const;
-        int getMaximumPower(IDragonMotorController::MOTOR_TYPE motorType) const;
-        double getStallTorque(IDragonMotorController::MOTOR_TYPE motorType) const;
+        int getStallCurrent(IDragonMotorController::MOTOR_TYPE motorType) const { return GetSpec(motorType).stallCurrent; }
+        double getFreeCurrent(IDragonMotorController::MOTOR_TYPE motorType) const { return GetSpec(motorType).freeCurrent; }
+        int getFreeSpeed(IDragonMotorController::MOTOR_TYPE motorType) const { return GetSpec(motorType).freeSpeed; }
+        int getMaximumPower(IDragonMotorController::MOTOR_TYPE motorType) const { return GetSpec(motorType).maximumPower; }
+        double getStallTorque(IDragonMotorController::MOTOR_TYPE motorType) const { return GetSpec(motorType).stallTorque; }
         bool checkIfStall(std::shared_ptr<IDragonMotorController> motor);
         static MotorData* GetInstance();
 
+        /// @brief  data for a motor type (all zeros for unknown motors)
+        static constexpr const MotorSpec& GetSpec
+        (
+            IDragonMotorController::MOTOR_TYPE motorType
+        )
+        {
+            return (motorType >= 0 && motorType < IDragonMotorController::MOTOR_TYPE::MAX_MOTOR_TYPES) ? m_specs[motorType] : 
+                                                                                                         m_specs[IDragonMotorController::MOTOR_TYPE::NONE];
+        }
+
     private:
         MotorData() = default;
         ~MotorData() = default;
 
-        const int stallCurrentValues[IDragonMotorController::MOTOR_TYPE::MAX_MOTOR_TYPES] = 
-        {
-            257, //Falcon 500
-            166, //NEO Motor
-            111, //NEO 550 Motor
-            131, //CIM Motor
-            89,  //Mini CIM Motor
-            53,  //BAG Motor
-            134, //775pro Motor
-            71,  //AndyMark 9015
-            10,  //AndyMark NeveRest
-            18,  //AndyMark RS775-125
-            122, //AndyMark Redline A
-            11,  //REV Robotgics HD Hex Motor
-            97,  //BaneBots RS-775 18V
-            84,  //BaneBots RS-550
-            11,  //Modern Robotics 12VDC Motor
-            21,  //Johnson Electric Gear Motor
-            9,   //TETRIX MAX TorqueNADO Motor
-            0    //No motor
-        };
-
-        const double freeCurrentValues[IDragonMotorController::MOTOR_TYPE::MAX_MOTOR_TYPES] = 
-        {
-            1.5, //Falcon 500
-            1.3, //NEO Motor
-            1.1, //NEO 550 Motor
-            2.7, //CIM Motor
-            3,  //Mini CIM Motor
-            1.8,  //BAG Motor
-            0.7, //775pro Motor
-            3.7,  //AndyMark 9015
-            0.4,  //AndyMark NeveRest
-            1.6,  //AndyMark RS775-125
-            2.6, //AndyMark Redline A
-            0.3,  //REV Robotgics HD Hex Motor
-            2.7,  //BaneBots RS-775 18V
-            0.4,  //BaneBots RS-550
-            0.3,  //Modern Robotics 12VDC Motor
-            0.9,  //Johnson Electric Gear Motor
-            0.2,   //TETRIX MAX TorqueNADO Motor
-            0  //No motor
-        };
-
-        const int maximumPowerValues[IDragonMotorController::MOTOR_TYPE::MAX_MOTOR_TYPES] = 
-        {
-            783, //Falcon 500
-            516, //NEO Motor
-            332, //NEO 550 Motor
-            337, //CIM Motor
-            215,  //Mini CIM Motor
-            149,  //BAG Motor
-            347, //775pro Motor
-            134,  //AndyMark 9015
-            25,  //AndyMark NeveRest
-            43,  //AndyMark RS775-125
-            327, //AndyMark Redline A
-            28,  //REV Robotgics HD Hex Motor
-            246,  //BaneBots RS-775 18V
-            190,  //BaneBots RS-550
-            29,  //Modern Robotics 12VDC Motor
-            45,  //Johnson Electric Gear Motor
-            26,   //TETRIX MAX TorqueNADO Motor
-            0    //No motor
-        };
-
-        const double stallTorqueValues[IDragonMotorController::MOTOR_TYPE::MAX_MOTOR_TYPES] = 
-        {
-            4.69, //Falcon 500
-            3.36, //NEO Motor
-            1.08, //NEO 550 Motor
-            2.41, //CIM Motor
-            1.41,  //Mini CIM Motor
-            0.43,  //BAG Motor
-            0.71, //775pro Motor
-            0.36,  //AndyMark 9015
-            0.17,  //AndyMark NeveRest
-            0.28,  //AndyMark RS775-125
-            0.64, //AndyMark Redline A
-            0.182,  //REV Robotgics HD Hex Motor
-            0.72,  //BaneBots RS-775 18V
-            0.38,  //BaneBots RS-550
-            0.19,  //Modern Robotics 12VDC Motor
-            4.09,  //Johnson Electric Gear Motor
-            0.17,   //TETRIX MAX TorqueNADO Motor
-            0     //No motor
-        };
-
-        const int freeSpeedValues[IDragonMotorController::MOTOR_TYPE::MAX_MOTOR_TYPES] = 
-        {
-            6380, //Falcon 500
-            5880, //NEO Motor
-            11710, //NEO 550 Motor
-            5330, //CIM Motor
-            5840,  //Mini CIM Motor
-            13180,  //BAG Motor
-            18730, //775pro Motor
-            14270,  //AndyMark 9015
-            5480,  //AndyMark NeveRest
-            5800,  //AndyMark RS775-125
-            19500, //AndyMark Redline A
-            5960,  //REV Robotgics HD Hex Motor
-            13050,  //BaneBots RS-775 18V
-            19000,  //BaneBots RS-550
-            5900,  //Modern Robotics 12VDC Motor
-            420,  //Johnson Electric Gear Motor
-            5920,   //TETRIX MAX TorqueNADO Motor
-            0     //No motor
-        };
+        static constexpr std::array<MotorSpec, IDragonMotorController::MOTOR_TYPE::MAX_MOTOR_TYPES> m_specs = 
+        {{
+            // stall A, free A, free rpm, max W, stall Nm
+            {257,   1.5,    6380,   783,    4.69},      //Falcon 500
+            {166,   1.3,    5880,   516,    3.36},      //NEO Motor
+            {111,   1.1,    11710,  332,    1.08},      //NEO 550 Motor
+            {131,   2.7,    5330,   337,    2.41},      //CIM Motor
+            {89,    3.0,    5840,   215,    1.41},      //Mini CIM Motor
+            {53,    1.8,    13180,  149,    0.43},      //BAG Motor
+            {134,   0.7,    18730,  347,    0.71},      //775pro Motor
+            {71,    3.7,    14270,  134,    0.36},      //AndyMark 9015
+            {10,    0.4,    5480,   25,     0.17},      //AndyMark NeveRest
+            {18,    1.6,    5800,   43,     0.28},      //AndyMark RS775-125
+            {122,   2.6,    19500,  327,    0.64},      //AndyMark Redline A
+            {11,    0.3,    5960,   28,     0.182},     //REV Robotgics HD Hex Motor
+            {97,    2.7,    13050,  246,    0.72},      //BaneBots RS-775 18V
+            {84,    0.4,    19000,  190,    0.38},      //BaneBots RS-550
+            {11,    0.3,    5900,   29,     0.19},      //Modern Robotics 12VDC Motor
+            {21,    0.9,    420,    45,     4.09},      //Johnson Electric Gear Motor
+            {9,     0.2,    5920,   26,     0.17},      //TETRIX MAX TorqueNADO Motor
+            {0,     0.0,    0,      0,      0.0}        //No motor
+        }};
 
         static MotorData* m_instance;
-};
\ No newline at end of file
+};
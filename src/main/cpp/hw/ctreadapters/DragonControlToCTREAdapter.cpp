@@ -38,6 +38,9 @@ using namespace ctre::phoenix;
 using namespace ctre::phoenix::motorcontrol;
 using namespace ctre::phoenix::motorcontrol::can;
 
+int DragonControlToCTREAdapter::m_numCreated = 0;
+int DragonControlToCTREAdapter::m_numConfigCalls = 0;
+
 DragonControlToCTREAdapter::DragonControlToCTREAdapter
 (
     std::string                                                     networkTableName,
@@ -52,35 +55,155 @@ DragonControlToCTREAdapter::DragonControlToCTREAdapter
     m_calcStruc(calcStruc),
     m_controller(controller)
 {
+	m_numCreated++;
+
 	SetPeakAndNominalValues(networkTableName, controlInfo);
 
-	if ( controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_DEGREES ||
-	     controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_INCH ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VELOCITY_DEGREES ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VELOCITY_INCH ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VELOCITY_RPS  ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VOLTAGE ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::CURRENT ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::TRAPEZOID )
+	if ( UsesPIDConstants(controlInfo) )
 	{
 		SetPIDConstants(networkTableName, controllerSlot, controlInfo);
 	}
 	
-	if ( //controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE ||
-	     controlInfo->GetMode() == ControlModes::CONTROL_TYPE::TRAPEZOID  )
+	if ( UsesMotionMagic(controlInfo) )
 	{
 		SetMaxVelocityAcceleration(networkTableName, controlInfo);
 	}
 
 }
 
+bool DragonControlToCTREAdapter::UsesPIDConstants
+(
+    const ControlData*                                              controlInfo
+)
+{
+	auto mode = controlInfo->GetMode();
+	return ( mode == ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE ||
+		     mode == ControlModes::CONTROL_TYPE::POSITION_DEGREES ||
+	         mode == ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE ||
+		     mode == ControlModes::CONTROL_TYPE::POSITION_INCH ||
+		     mode == ControlModes::CONTROL_TYPE::VELOCITY_DEGREES ||
+		     mode == ControlModes::CONTROL_TYPE::VELOCITY_INCH ||
+		     mode == ControlModes::CONTROL_TYPE::VELOCITY_RPS  ||
+		     mode == ControlModes::CONTROL_TYPE::VOLTAGE ||
+		     mode == ControlModes::CONTROL_TYPE::CURRENT ||
+		     mode == ControlModes::CONTROL_TYPE::TRAPEZOID );
+}
+
+bool DragonControlToCTREAdapter::UsesMotionMagic
+(
+    const ControlData*                                              controlInfo
+)
+{
+	auto mode = controlInfo->GetMode();
+	return ( //mode == ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE ||
+		     mode == ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE ||
+	         mode == ControlModes::CONTROL_TYPE::TRAPEZOID );
+}
+
+void DragonControlToCTREAdapter::Activate
+(
+    const DragonControlToCTREAdapter*                               previous,
+    bool                                                            reloadPID
+)
+{
+	auto prevInfo = previous != nullptr ? previous->m_controlData : nullptr;
+
+	// peak/nominal output and the motion magic limits are shared by all of the profile slots
+	if ( prevInfo == nullptr || 
+		 prevInfo->GetPeakValue() != m_controlData->GetPeakValue() || 
+		 prevInfo->GetNominalValue() != m_controlData->GetNominalValue() )
+	{
+		SetPeakAndNominalValues(m_networkTableName, m_controlData);
+	}
+
+	if ( UsesMotionMagic(m_controlData) &&
+		 ( prevInfo == nullptr || 
+		   !UsesMotionMagic(prevInfo) ||
+		   prevInfo->GetMaxAcceleration() != m_controlData->GetMaxAcceleration() ||
+		   prevInfo->GetCruiseVelocity() != m_controlData->GetCruiseVelocity() ) )
+	{
+		SetMaxVelocityAcceleration(m_networkTableName, m_controlData);
+	}
+
+	if ( UsesPIDConstants(m_controlData) )
+	{
+		if ( reloadPID )
+		{
+			SetPIDConstants(m_networkTableName, m_controllerSlot, m_controlData);
+		}
+		else if ( previous == nullptr || previous->m_controllerSlot != m_controllerSlot || !UsesPIDConstants(prevInfo) )
+		{
+			auto error = m_controller->SelectProfileSlot(m_controllerSlot, 0);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, m_networkTableName, GetErrorPrompt(), string("SelectProfileSlot error"));
+			}
+		}
+	}
+}
+
+void DragonControlToCTREAdapter::ApplyChanges
+(
+    int                                                             changes,
+    bool                                                            ownsSlot,
+    bool                                                            isActive
+)
+{
+	if ( ownsSlot && UsesPIDConstants(m_controlData) )
+	{
+		// only the gains that changed; the slot stays selected
+		if ( (changes & ControlData::CONSTANT_CHANGES::KP_CHANGED) != 0 )
+		{
+			m_numConfigCalls++;
+			if ( m_controller->Config_kP(m_controllerSlot, m_controlData->GetP()) != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, m_networkTableName, GetErrorPrompt(), string("Config_kP error"));
+			}
+		}
+		if ( (changes & ControlData::CONSTANT_CHANGES::KI_CHANGED) != 0 )
+		{
+			m_numConfigCalls++;
+			if ( m_controller->Config_kI(m_controllerSlot, m_controlData->GetI()) != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, m_networkTableName, GetErrorPrompt(), string("Config_kI error"));
+			}
+		}
+		if ( (changes & ControlData::CONSTANT_CHANGES::KD_CHANGED) != 0 )
+		{
+			m_numConfigCalls++;
+			if ( m_controller->Config_kD(m_controllerSlot, m_controlData->GetD()) != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, m_networkTableName, GetErrorPrompt(), string("Config_kD error"));
+			}
+		}
+		if ( (changes & ControlData::CONSTANT_CHANGES::KF_CHANGED) != 0 )
+		{
+			m_numConfigCalls++;
+			if ( m_controller->Config_kF(m_controllerSlot, m_controlData->GetF()) != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, m_networkTableName, GetErrorPrompt(), string("Config_kF error"));
+			}
+		}
+	}
+
+	if ( isActive )
+	{
+		if ( (changes & ControlData::CONSTANT_CHANGES::PEAK_NOMINAL_CHANGED) != 0 )
+		{
+			SetPeakAndNominalValues(m_networkTableName, m_controlData);
+		}
+		if ( (changes & ControlData::CONSTANT_CHANGES::MOTION_CHANGED) != 0 && UsesMotionMagic(m_controlData) )
+		{
+			SetMaxVelocityAcceleration(m_networkTableName, m_controlData);
+		}
+	}
+}
+
 void DragonControlToCTREAdapter::InitializeDefaults()
 {
 	if (m_controller != nullptr)
 	{
+		m_numConfigCalls += 7;
 		auto error = m_controller->ConfigFactoryDefault();
 		if ( error != ErrorCode::OKAY )
 		{
@@ -141,6 +264,7 @@ void DragonControlToCTREAdapter::SetPeakAndNominalValues
     ControlData*                                                    controlInfo         
 )
 {
+	m_numConfigCalls += 4;
 	auto peak = controlInfo->GetPeakValue();
 	auto error = m_controller->ConfigPeakOutputForward(peak);
 	if ( error != ErrorCode::OKAY )
@@ -173,6 +297,7 @@ void DragonControlToCTREAdapter::SetMaxVelocityAcceleration
     ControlData*                                                    controlInfo         
 )
 {
+	m_numConfigCalls += 2;
 	auto error = m_controller->ConfigMotionAcceleration( controlInfo->GetMaxAcceleration() );
 	if ( error != ErrorCode::OKAY )
 	{
@@ -193,6 +318,7 @@ void DragonControlToCTREAdapter::SetPIDConstants
     ControlData*                                                    controlInfo         
 )
 {
+	m_numConfigCalls += 4;
 	auto error = m_controller->Config_kP(controllerSlot, controlInfo->GetP());
 	if ( error != ErrorCode::OKAY )
 	{
@@ -56,6 +56,40 @@ class DragonControlToCTREAdapter : public IDragonControlToVendorControlAdapter
         void InitializeDefaults() override;
         std::string GetErrorPrompt() const;
 
+        /// @brief  Make this adapter the one driving the motor controller.  Only the settings that differ from
+        ///         the previously active adapter are sent (peak/nominal output, motion magic limits, profile slot).
+        /// @param [in] const DragonControlToCTREAdapter*   previous:   adapter that was driving the controller (may be nullptr)
+        /// @param [in] bool                                reloadPID:  the profile slot was overwritten by another adapter
+        void Activate
+        (
+            const DragonControlToCTREAdapter*   previous,
+            bool                                reloadPID
+        );
+
+        /// @brief  Send the constants that changed in the control data (ControlData::UpdateConstants) to the controller
+        /// @param [in] int     changes:    ControlData::CONSTANT_CHANGES bits
+        /// @param [in] bool    ownsSlot:   the profile slot holds this adapter's gains
+        /// @param [in] bool    isActive:   this adapter is driving the controller (peak/nominal and motion magic are shared)
+        void ApplyChanges
+        (
+            int                                 changes,
+            bool                                ownsSlot,
+            bool                                isActive
+        );
+
+        int GetControllerSlot() const { return m_controllerSlot; }
+        ControlData* GetControlData() const { return m_controlData; }
+
+        /// @brief true if the control mode uses the PIDF constants in the profile slot
+        static bool UsesPIDConstants
+        (
+            const ControlData*                  controlInfo
+        );
+
+        /// @brief number of adapters created and number of configuration calls sent to the controllers
+        static int GetNumCreated() { return m_numCreated; }
+        static int GetNumConfigCalls() { return m_numConfigCalls; }
+
     protected:
 
         void SetPeakAndNominalValues
@@ -83,4 +117,12 @@ class DragonControlToCTREAdapter : public IDragonControlToVendorControlAdapter
         DistanceAngleCalcStruc                                              m_calcStruc;
         ctre::phoenix::motorcontrol::can::WPI_BaseMotorController*          m_controller;
 
+        static bool UsesMotionMagic
+        (
+            const ControlData*                  controlInfo
+        );
+
+        static int                                                          m_numCreated;
+        static int                                                          m_numConfigCalls;
+
 };
@@ -0,0 +1,160 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Team 302 includes
+#include <hw/ctreadapters/DragonControlToCTREAdapter.h>
+#include <hw/ctreadapters/DragonControlToCTREAdapterCache.h>
+#include <hw/factories/DragonControlToCTREAdapterFactory.h>
+#include <mechanisms/controllers/ControlData.h>
+
+// Third Party Includes
+#include <ctre/phoenix/motorcontrol/can/WPI_BaseMotorController.h>
+
+using namespace std;
+using namespace ctre::phoenix::motorcontrol::can;
+
+vector<DragonControlToCTREAdapterCache*> DragonControlToCTREAdapterCache::m_caches;
+
+DragonControlToCTREAdapterCache::DragonControlToCTREAdapterCache
+(
+    string                                                          networkTableName,
+    DistanceAngleCalcStruc                                          calcStruc,
+    WPI_BaseMotorController*                                        controller
+) : m_networkTableName(networkTableName),
+    m_calcStruc(calcStruc),
+    m_controller(controller),
+    m_adapters(),
+    m_profileOwner(),
+    m_numClosedLoop(0),
+    m_active(nullptr)
+{
+    m_profileOwner.fill(nullptr);
+    m_caches.emplace_back(this);
+}
+
+DragonControlToCTREAdapterCache::~DragonControlToCTREAdapterCache()
+{
+    for (auto& [controlInfo, adapter] : m_adapters)
+    {
+        delete adapter;
+    }
+    m_adapters.clear();
+    m_caches.erase(remove(m_caches.begin(), m_caches.end(), this), m_caches.end());
+}
+
+void DragonControlToCTREAdapterCache::ApplyChangesToAll
+(
+    const ControlData*                                              controlInfo,
+    int                                                             changes
+)
+{
+    for (auto cache : m_caches)
+    {
+        cache->ApplyChanges(controlInfo, changes);
+    }
+}
+
+void DragonControlToCTREAdapterCache::ApplyChanges
+(
+    const ControlData*                                              controlInfo,
+    int                                                             changes
+)
+{
+    auto adapter = Find(controlInfo);
+    if (adapter != nullptr)
+    {
+        // a slot that another control data took over gets reloaded when this one is activated again
+        auto ownsSlot = m_profileOwner[adapter->GetControllerSlot()] == controlInfo;
+        adapter->ApplyChanges(changes, ownsSlot, adapter == m_active);
+    }
+}
+
+DragonControlToCTREAdapter* DragonControlToCTREAdapterCache::Find
+(
+    const ControlData*                                              controlInfo
+) const
+{
+    // only a handful of states per motor, so a linear search is fine
+    for (auto& [info, adapter] : m_adapters)
+    {
+        if (info == controlInfo)
+        {
+            return adapter;
+        }
+    }
+    return nullptr;
+}
+
+DragonControlToCTREAdapter* DragonControlToCTREAdapterCache::Prepare
+(
+    ControlData*                                                    controlInfo
+)
+{
+    auto adapter = Find(controlInfo);
+    if (adapter == nullptr)
+    {
+        // each closed loop control gets its own profile slot until they run out, then they share
+        auto slot = 0;
+        if (DragonControlToCTREAdapter::UsesPIDConstants(controlInfo))
+        {
+            slot = m_numClosedLoop % m_numProfileSlots;
+            m_numClosedLoop++;
+            m_profileOwner[slot] = controlInfo;
+        }
+        adapter = DragonControlToCTREAdapterFactory::GetFactory()->CreateAdapter(m_networkTableName, slot, controlInfo, m_calcStruc, m_controller);
+        m_adapters.emplace_back(controlInfo, adapter);
+
+        // creating the adapter configured the controller for it, so put back what the active adapter needs
+        if (m_active != nullptr)
+        {
+            auto activeSlot = m_active->GetControllerSlot();
+            auto reloadPID = DragonControlToCTREAdapter::UsesPIDConstants(m_active->GetControlData()) && 
+                             m_profileOwner[activeSlot] != m_active->GetControlData();
+            m_active->Activate(adapter, reloadPID);
+            if (reloadPID)
+            {
+                m_profileOwner[activeSlot] = m_active->GetControlData();
+            }
+        }
+    }
+    return adapter;
+}
+
+DragonControlToCTREAdapter* DragonControlToCTREAdapterCache::Activate
+(
+    ControlData*                                                    controlInfo
+)
+{
+    auto adapter = Prepare(controlInfo);
+    if (adapter != m_active)
+    {
+        auto slot = adapter->GetControllerSlot();
+        auto reloadPID = DragonControlToCTREAdapter::UsesPIDConstants(controlInfo) && m_profileOwner[slot] != controlInfo;
+        adapter->Activate(m_active, reloadPID);
+        if (reloadPID)
+        {
+            m_profileOwner[slot] = controlInfo;
+        }
+        m_active = adapter;
+    }
+    return adapter;
+}
@@ -0,0 +1,113 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Team 302 includes
+#include <hw/DistanceAngleCalcStruc.h>
+
+// forward declares
+namespace ctre
+{
+    namespace phoenix
+    {
+        namespace motorcontrol
+        {
+            namespace can
+            {
+                class WPI_BaseMotorController;
+            }
+        }
+    }
+}
+class ControlData;
+class DragonControlToCTREAdapter;
+
+/// @class DragonControlToCTREAdapterCache
+/// @brief Keeps one adapter per ControlData used with a CTRE motor controller.  Adapters are created (and their
+///        PIDF constants loaded into their own profile slot) when a state is constructed, so entering a state later
+///        only switches the active adapter and sends the settings that actually differ.
+class DragonControlToCTREAdapterCache
+{
+    public:
+        DragonControlToCTREAdapterCache
+        (
+            std::string                                                     networkTableName,
+            DistanceAngleCalcStruc                                          calcStruc,
+            ctre::phoenix::motorcontrol::can::WPI_BaseMotorController*      controller
+        );
+        DragonControlToCTREAdapterCache() = delete;
+        DragonControlToCTREAdapterCache(const DragonControlToCTREAdapterCache&) = delete;
+        DragonControlToCTREAdapterCache& operator=(const DragonControlToCTREAdapterCache&) = delete;
+        ~DragonControlToCTREAdapterCache();
+
+        /// @brief  Find or create the adapter for the control data without making it active
+        /// @param [in] ControlData*    controlInfo:    control constants
+        /// @return DragonControlToCTREAdapter*   adapter for the control data
+        DragonControlToCTREAdapter* Prepare
+        (
+            ControlData*                                                    controlInfo
+        );
+
+        /// @brief  Find or create the adapter for the control data and make it the active one
+        /// @param [in] ControlData*    controlInfo:    control constants
+        /// @return DragonControlToCTREAdapter*   adapter for the control data
+        DragonControlToCTREAdapter* Activate
+        (
+            ControlData*                                                    controlInfo
+        );
+
+        /// @brief  Send the constants that changed in a control data to every motor controller that has an adapter for it
+        /// @param [in] const ControlData*  controlInfo:    control data that was updated in place
+        /// @param [in] int                 changes:        ControlData::CONSTANT_CHANGES bits
+        static void ApplyChangesToAll
+        (
+            const ControlData*                                              controlInfo,
+            int                                                             changes
+        );
+
+    private:
+        /// @brief  Send the constants that changed to this motor controller if it has an adapter for the control data
+        void ApplyChanges
+        (
+            const ControlData*                                              controlInfo,
+            int                                                             changes
+        );
+
+        DragonControlToCTREAdapter* Find
+        (
+            const ControlData*                                              controlInfo
+        ) const;
+
+        static constexpr int                                                m_numProfileSlots = 4;
+
+        std::string                                                         m_networkTableName;
+        DistanceAngleCalcStruc                                              m_calcStruc;
+        ctre::phoenix::motorcontrol::can::WPI_BaseMotorController*          m_controller;
+        std::vector<std::pair<const ControlData*, DragonControlToCTREAdapter*>> m_adapters;
+        std::array<const ControlData*, m_numProfileSlots>                   m_profileOwner;
+        int                                                                 m_numClosedLoop;
+        DragonControlToCTREAdapter*                                         m_active;
+
+        static std::vector<DragonControlToCTREAdapterCache*>                m_caches;
+};
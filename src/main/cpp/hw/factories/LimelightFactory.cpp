@@ -15,6 +15,7 @@
 //====================================================================================================================================================
 
 #include <map>
+#include <string>
 
 #include "hw/factories/LimelightFactory.h"
 #include <hw/DragonLimelight.h>
@@ -33,7 +34,8 @@ LimelightFactory* LimelightFactory::GetLimelightFactory()
     return m_limelightFactory;
 }
 
-LimelightFactory::LimelightFactory() : m_limelight( nullptr )
+LimelightFactory::LimelightFactory() : m_limelight( nullptr ),
+                                       m_limelights()
 {
 }
 
@@ -46,6 +48,8 @@ DragonLimelight* LimelightFactory::CreateLimelight
     units::angle::degree_t      mountingAngle,              /// <I> - mounting angle of the camera
     units::length::inch_t       targetHeight,               /// <I> - height the target
     units::length::inch_t       targetHeight2,               /// <I> - height of second target
+    units::length::inch_t       mountingForwardOffset,       /// <I> - mounting forward offset from the middle of the robot
+    units::angle::degree_t      mountingYaw,                 /// <I> - counter clockwise yaw of the camera relative to the robot front
     DragonLimelight::LED_MODE       ledMode,
     DragonLimelight::CAM_MODE       camMode,
     DragonLimelight::STREAM_MODE    streamMode,
@@ -56,15 +60,23 @@ DragonLimelight* LimelightFactory::CreateLimelight
     double                          secXHairY
 )
 {
-    if ( m_limelight == nullptr )
+    DragonLimelight* limelight = GetLimelight( tableName );
+    if ( limelight == nullptr )
     {
-        m_limelight = new DragonLimelight(tableName, 
-                                          mountingHeight, 
-                                          mountingHorizontalOffset, 
-                                          rotation, 
-                                          mountingAngle, 
-                                          targetHeight, 
-                                          targetHeight2);
+        limelight = new DragonLimelight(tableName, 
+                                        mountingHeight, 
+                                        mountingHorizontalOffset, 
+                                        rotation, 
+                                        mountingAngle, 
+                                        targetHeight, 
+                                        targetHeight2,
+                                        mountingForwardOffset,
+                                        mountingYaw);
+        m_limelights[tableName] = limelight;
+        if ( m_limelight == nullptr )
+        {
+            m_limelight = limelight;
+        }
         /**
         m_limelight->SetLEDMode( ledMode );
         m_limelight->SetCamMode( camMode );
@@ -80,7 +92,7 @@ DragonLimelight* LimelightFactory::CreateLimelight
         }
         **/
     }
-    return m_limelight;
+    return limelight;
 }
 
 DragonLimelight* LimelightFactory::GetLimelight()
@@ -88,3 +100,12 @@ DragonLimelight* LimelightFactory::GetLimelight()
     return m_limelight;
 }
 
+DragonLimelight* LimelightFactory::GetLimelight
+(
+    const string&   tableName
+) const
+{
+    auto itr = m_limelights.find( tableName );
+    return itr != m_limelights.end() ? itr->second : nullptr;
+}
+
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include <hw/DragonLimelight.h>
 
 
@@ -24,8 +27,20 @@ class LimelightFactory
     public:
         static LimelightFactory* GetLimelightFactory();
 
+        /// @brief Get the main limelight (the first one defined in robot.xml)
         DragonLimelight* GetLimelight();
 
+        /// @brief Get the limelight publishing to the network table name
+        /// @param [in] std::string tableName:  network table name of the limelight
+        /// @returns DragonLimelight*  limelight or nullptr if it wasn't defined
+        DragonLimelight* GetLimelight
+        (
+            const std::string&  tableName
+        ) const;
+
+        /// @brief Get all of the limelights keyed by network table name
+        const std::map<std::string, DragonLimelight*>& GetLimelights() const { return m_limelights; }
+
         DragonLimelight* CreateLimelight
         (
             std::string                     tableName,                  /// <I> - network table name
@@ -35,6 +50,8 @@ class LimelightFactory
             units::angle::degree_t          mountingAngle,              /// <I> - mounting angle of the camera
             units::length::inch_t           targetHeight,               /// <I> - height the target
             units::length::inch_t           targetHeight2,               /// <I> - height of second target
+            units::length::inch_t           mountingForwardOffset,       /// <I> - mounting forward offset from the middle of the robot
+            units::angle::degree_t          mountingYaw,                 /// <I> - counter clockwise yaw of the camera relative to the robot front
             DragonLimelight::LED_MODE       ledMode,
             DragonLimelight::CAM_MODE       camMode,
             DragonLimelight::STREAM_MODE    streamMode,
@@ -51,4 +68,5 @@ class LimelightFactory
 
         static LimelightFactory* m_limelightFactory;
         DragonLimelight* m_limelight;
+        std::map<std::string, DragonLimelight*> m_limelights;
 };
@@ -33,6 +33,16 @@
 #include <ctre/phoenix/motorcontrol/RemoteSensorSource.h>
 #include <ctre/phoenix/motorcontrol/StatusFrame.h>
 
+namespace ctre::phoenix::motorcontrol
+{
+    class TalonFXSensorCollection;
+    namespace can
+    {
+        class WPI_TalonFX;
+        class WPI_TalonSRX;
+    }
+}
+
 /// @interface IDragonMotorController
 /// @brief The general interface to motor mechanisms/controllers so that the specific mechanisms that use motors,
 ///        don't need to special case what motor controller is being used.
@@ -99,6 +109,19 @@ class IDragonMotorController
         /// @return std::shared_ptr<frc::SpeedControll> - pointer to the speed controller object
         virtual std::shared_ptr<frc::MotorController> GetSpeedController() const = 0;
 
+        /// @brief  Return the TalonFX this controller wraps.  The pointer is owned by this object and is valid for its
+        ///         lifetime, so callers can resolve it once and keep it instead of casting GetSpeedController().
+        /// @return ctre::phoenix::motorcontrol::can::WPI_TalonFX* - TalonFX or nullptr if this isn't a TalonFX
+        virtual ctre::phoenix::motorcontrol::can::WPI_TalonFX* GetTalonFX() const { return nullptr; }
+
+        /// @brief  Return the TalonFX integrated sensor collection (same lifetime as GetTalonFX())
+        /// @return ctre::phoenix::motorcontrol::TalonFXSensorCollection* - sensors or nullptr if this isn't a TalonFX
+        virtual ctre::phoenix::motorcontrol::TalonFXSensorCollection* GetTalonFXSensors() const { return nullptr; }
+
+        /// @brief  Return the TalonSRX this controller wraps (same lifetime rules as GetTalonFX())
+        /// @return ctre::phoenix::motorcontrol::can::WPI_TalonSRX* - TalonSRX or nullptr if this isn't a TalonSRX
+        virtual ctre::phoenix::motorcontrol::can::WPI_TalonSRX* GetTalonSRX() const { return nullptr; }
+
         // Setters
         virtual void Set(double value) = 0;
         virtual void SetRotationOffset(double rotations) = 0;
@@ -119,6 +142,13 @@ class IDragonMotorController
         /// @return void
         virtual void SetControlConstants(int slot, ControlData* controlInfo) = 0;
 
+        /// @brief  Create and configure everything needed to use the control constants later without making them
+        ///         active, so the SetControlConstants call when a state is entered doesn't reconfigure the controller.
+        /// @param [in] int             slot - controller slot the constants will be set on
+        /// @param [in] ControlData*    pid - the control constants
+        /// @return void
+        virtual void PrepareControlConstants(int slot, ControlData* controlInfo) = 0;
+
         virtual void SetRemoteSensor
         (
             int                                             canID,
@@ -46,7 +46,6 @@
 // --------------------------------------------------------------------------------------------
 
 // C++ includes
-#include <string.h>
 
 // FRC includes
 #include <frc/AnalogInput.h>
@@ -55,6 +54,7 @@
 // Team302 includes
 #include <hw/DragonAnalogInput.h>
 #include <hw/xml/AnalogInputXmlParser.h>
+#include <utils/XmlName.h>
 
 // Third Party includes
 #include <pugixml/pugixml.hpp>
@@ -88,56 +88,62 @@ DragonAnalogInput* AnalogInputXmlParser::ParseXML
 
     for (pugi::xml_attribute attr = motorNode.first_attribute(); attr; attr = attr.next_attribute())
     {
-        if ( strcmp( attr.name(), "type" ) == 0 )
+        switch ( XmlName::Hash( attr.name() ) )
         {
-        	int iVal = attr.as_int();
-        	switch ( iVal )
-        	{
-                case DragonAnalogInput::ANALOG_GENERAL:
-                    type = DragonAnalogInput::ANALOG_GENERAL;
-                    break;
-
-                case DragonAnalogInput::ANALOG_GYRO:
-                    type = DragonAnalogInput::ANALOG_GYRO;
-                    break;
-
-                case DragonAnalogInput::POTENTIOMETER:
-                    type = DragonAnalogInput::POTENTIOMETER;
-                    break;
-
-                case DragonAnalogInput::PRESSURE_GAUGE:
-                    type = DragonAnalogInput::PRESSURE_GAUGE;
-                    break;
-
-                default:
-                    printf( "==>> AnalogInputXmlParser::ParseXML: invalid type %d \n", iVal );
-                    break;
-        	}
-        }
-        else if ( strcmp( attr.name(), "analogId" ) == 0 )
-        {
-        	analogID = attr.as_int();
-        }
-        else if ( strcmp( attr.name(), "voltageMin" ) == 0 )
-        {
-        	voltageMin = attr.as_float();
-        }
-        else if ( strcmp( attr.name(), "voltageMax" ) == 0 )
-        {
-        	voltageMax = attr.as_float();
-        }
-        else if ( strcmp( attr.name(), "outputMin" ) == 0 )
-        {
-        	outputMin = attr.as_float();
-        }
-        else if ( strcmp( attr.name(), "outputMax" ) == 0 )
-        {
-        	outputMax = attr.as_float();
-        }
-        else
-        {
-            printf( "AnalogInputXmlParser::ParseXML: invalid attribute %s \n", attr.name() );
-            hasError = true;
+            case XmlName::Hash( "type" ):
+            {
+                int iVal = attr.as_int();
+                switch ( iVal )
+                {
+                    case DragonAnalogInput::ANALOG_GENERAL:
+                        type = DragonAnalogInput::ANALOG_GENERAL;
+                        break;
+
+                    case DragonAnalogInput::ANALOG_GYRO:
+                        type = DragonAnalogInput::ANALOG_GYRO;
+                        break;
+
+                    case DragonAnalogInput::POTENTIOMETER:
+                        type = DragonAnalogInput::POTENTIOMETER;
+                        break;
+
+                    case DragonAnalogInput::PRESSURE_GAUGE:
+                        type = DragonAnalogInput::PRESSURE_GAUGE;
+                        break;
+
+                    default:
+                        printf( "==>> AnalogInputXmlParser::ParseXML: invalid type %d \n", iVal );
+                        break;
+                }
+                break;
+            }
+
+            case XmlName::Hash( "analogId" ):
+                analogID = attr.as_int();
+                break;
+
+            case XmlName::Hash( "voltageMin" ):
+                voltageMin = attr.as_float();
+                break;
+
+            case XmlName::Hash( "voltageMax" ):
+                voltageMax = attr.as_float();
+                break;
+
+            case XmlName::Hash( "outputMin" ):
+                outputMin = attr.as_float();
+                break;
+
+            case XmlName::Hash( "outputMax" ):
+                outputMax = attr.as_float();
+                break;
+
+            default:
+            {
+                printf( "AnalogInputXmlParser::ParseXML: invalid attribute %s \n", attr.name() );
+                hasError = true;
+                break;
+            }
         }
     }
 
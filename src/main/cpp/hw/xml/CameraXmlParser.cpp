@@ -31,6 +31,7 @@
 
 // Team302 includes
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 #include <hw/xml/CameraXmlParser.h>
 
 // Third Party includes
@@ -69,65 +70,70 @@ cs::UsbCamera CameraXmlParser::ParseXML
 	//Parse/validate xml
 	for(pugi::xml_attribute attr = cameraNode.first_attribute(); attr && !hasError; attr = attr.next_attribute() )
 	{
-		if ( strcmp( attr.name(), "ID") == 0 )
-		{
-			id = attr.as_int();
-		}
-		else if (strcmp(attr.name(), "format" ) == 0)
-		{
-			// todo: parse strings and map to the cs::VideoMode enum
-			int iVal = attr.as_int();
-			switch(iVal)
-			{
-				case CameraXmlParser::KMJPEG:
-					type = cs::VideoMode::kMJPEG;
-					break;
-
-				case CameraXmlParser::KYUYV:
-					type = cs::VideoMode::kYUYV;
-					break;
-
-				case CameraXmlParser::KRGB565:
-					type = cs::VideoMode::kRGB565;
-					break;
-
-				case CameraXmlParser::KBGR:
-					type = cs::VideoMode::kBGR;
-					break;
-
-				case CameraXmlParser::KGRAY:
-					type = cs::VideoMode::kGray;
-					break;
-
-				default:
-					type = cs::VideoMode::kUnknown;
-					string msg = "unknown camera format ";
-					msg += to_string( iVal );
-					Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("CameraXmlParser"), string("ParseXML"), msg );
-					hasError = true;
-					break;
-			}
-		}
-		else if (strcmp(attr.name(), "width") == 0)
-		{
-			width = attr.as_int();
-		}
-
-		else if (strcmp(attr.name(), "height") == 0)
-		{
-			height = attr.as_int();
-		}
-		else if (strcmp(attr.name(), "fps") == 0)
-		{
-			fps = attr.as_int();
-		}
-		else
-		{
-            string msg = "unknown attribute ";
-            msg += attr.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("CameraXmlParser"), string("ParseXML"), msg );
-            hasError = true;
-		}
+        switch ( XmlName::Hash( attr.name() ) )
+        {
+            case XmlName::Hash( "ID" ):
+                id = attr.as_int();
+                break;
+
+            case XmlName::Hash( "format" ):
+            {
+                // todo: parse strings and map to the cs::VideoMode enum
+                int iVal = attr.as_int();
+                switch(iVal)
+                {
+                    case CameraXmlParser::KMJPEG:
+                        type = cs::VideoMode::kMJPEG;
+                        break;
+
+                    case CameraXmlParser::KYUYV:
+                        type = cs::VideoMode::kYUYV;
+                        break;
+
+                    case CameraXmlParser::KRGB565:
+                        type = cs::VideoMode::kRGB565;
+                        break;
+
+                    case CameraXmlParser::KBGR:
+                        type = cs::VideoMode::kBGR;
+                        break;
+
+                    case CameraXmlParser::KGRAY:
+                        type = cs::VideoMode::kGray;
+                        break;
+
+                    default:
+                        type = cs::VideoMode::kUnknown;
+                        string msg = "unknown camera format ";
+                        msg += to_string( iVal );
+                        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("CameraXmlParser"), string("ParseXML"), msg );
+                        hasError = true;
+                        break;
+                }
+                break;
+            }
+
+            case XmlName::Hash( "width" ):
+                width = attr.as_int();
+                break;
+
+            case XmlName::Hash( "height" ):
+                height = attr.as_int();
+                break;
+
+            case XmlName::Hash( "fps" ):
+                fps = attr.as_int();
+                break;
+
+            default:
+            {
+                string msg = "unknown attribute ";
+                msg += attr.name();
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("CameraXmlParser"), string("ParseXML"), msg );
+                hasError = true;
+                break;
+            }
+        }
 
 	}
 
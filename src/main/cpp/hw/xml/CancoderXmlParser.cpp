@@ -16,7 +16,6 @@
 
 // C++ includes
 #include <string>
-#include <cstring>
 
 // wpilib includes
 
@@ -25,6 +24,7 @@
 #include <hw/xml/CancoderXmlParser.h>
 #include <utils/HardwareIDValidation.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 
 // third party includes
 #include <pugixml/pugixml.hpp>
@@ -55,31 +55,37 @@ DragonCanCoder* CancoderXmlParser::ParseXML
 
     for(xml_attribute attr = CanCoderNode.first_attribute(); attr &&!hasError; attr = attr.next_attribute() )
     {
-        if ( strcmp( attr.name(), "usage") == 0)
+        switch ( XmlName::Hash( attr.name() ) )
         {
-            usage = attr.value();
-        }
-        else if ( strcmp( attr.name(), "canId" ) == 0 )
-        {
-            canID = attr.as_int();
-            hasError = HardwareIDValidation::ValidateCANID( canID, string( "CancoderXmlParser::ParseXML" ) );
-        }        
-        else if (strcmp(attr.name(), "canbus") == 0)
-        {
-            canBusName = attr.as_string();
-        }
-        else if ( strcmp( attr.name(), "offset" ) == 0 )
-        {
-            offset = attr.as_double();
-        }        
-        else if ( strcmp( attr.name(), "reverse" ) == 0 )
-        {
-            reverse = attr.as_bool();
-        }        
-        else
-        {
-            Logger::GetLogger()->LogData (LOGGER_LEVEL::ERROR_ONCE, string("CancoderXmlParser"), string("invalid attribute"), string(attr.value()));
-            hasError = true;
+            case XmlName::Hash( "usage" ):
+                usage = attr.value();
+                break;
+
+            case XmlName::Hash( "canId" ):
+            {
+                canID = attr.as_int();
+                hasError = HardwareIDValidation::ValidateCANID( canID, string( "CancoderXmlParser::ParseXML" ) );
+                break;
+            }
+
+            case XmlName::Hash( "canbus" ):
+                canBusName = attr.as_string();
+                break;
+
+            case XmlName::Hash( "offset" ):
+                offset = attr.as_double();
+                break;
+
+            case XmlName::Hash( "reverse" ):
+                reverse = attr.as_bool();
+                break;
+
+            default:
+            {
+                Logger::GetLogger()->LogData (LOGGER_LEVEL::ERROR_ONCE, string("CancoderXmlParser"), string("invalid attribute"), string(attr.value()));
+                hasError = true;
+                break;
+            }
         }
 
     }   
@@ -25,6 +25,7 @@
 #include <hw/usages/DigitalInputUsage.h>
 #include <utils/HardwareIDValidation.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 #include <hw/xml/DigitalInputXmlParser.h>
 
 // Third Party includes
@@ -61,31 +62,37 @@ shared_ptr<DragonDigitalInput> DigitalInputXmlParser::ParseXML
     // Parse/validate the XML
     for (pugi::xml_attribute attr = DigitalNode.first_attribute(); attr; attr = attr.next_attribute())
     {
-        string attrName (attr.name());
-        if (attrName.compare("usage") == 0)
+        switch ( XmlName::Hash( attr.name() ) )
         {
-            auto usageString = string(attr.value());
-            usage = DigitalInputUsage::GetInstance()->GetUsage(usageString );
-        }
-        else if (attrName.compare("digitalId") == 0)
-        {
-            digitalID = attr.as_int();
-            hasError = HardwareIDValidation::ValidateDIOID( digitalID, string( "DigitalInputXmlParser::ParseXML(digital Input pin)" ) );
-        }
-        else if (attrName.compare("reversed" ) == 0)
-        {
-            reversed = attr.as_bool();
+            case XmlName::Hash( "usage" ):
+            {
+                auto usageString = string(attr.value());
+                usage = DigitalInputUsage::GetInstance()->GetUsage(usageString );
+                break;
+            }
 
-        }
-        else if (attrName.compare("debouncetime") == 0)
-        {
-            debounceTime = units::time::second_t(attr.as_double());
-        }
-        else
-        {
-            string msg = "unknown attribute ";
-            msg += attr.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("DigitalInputXmlParser "), string("ParseXML "), msg );
+            case XmlName::Hash( "digitalId" ):
+            {
+                digitalID = attr.as_int();
+                hasError = HardwareIDValidation::ValidateDIOID( digitalID, string( "DigitalInputXmlParser::ParseXML(digital Input pin)" ) );
+                break;
+            }
+
+            case XmlName::Hash( "reversed" ):
+                reversed = attr.as_bool();
+                break;
+
+            case XmlName::Hash( "debouncetime" ):
+                debounceTime = units::time::second_t(attr.as_double());
+                break;
+
+            default:
+            {
+                string msg = "unknown attribute ";
+                msg += attr.name();
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("DigitalInputXmlParser "), string("ParseXML "), msg );
+                break;
+            }
         }
     }
 
@@ -25,6 +25,7 @@
 #include <hw/xml/LedXmlParser.h>
 #include <utils/HardwareIDValidation.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 
 // Third Party Includes
 #include <pugixml/pugixml.hpp>
@@ -53,22 +54,27 @@ using namespace std;
         // parse/validate the xml
         for (pugi::xml_attribute attr = ledNode.first_attribute(); attr && !hasError; attr = attr.next_attribute())
         {
-            string attrName (attr.name());
-            if (attrName.compare("pwmId" ) == 0)
+            switch ( XmlName::Hash( attr.name() ) )
             {
-                pwmID = attr.as_int();
-                hasError = HardwareIDValidation::ValidateDIOID( pwmID, string( "ServoXmlParser::ParseXML(PWM ID)" ) );
-            }
-            else if (attrName.compare("number" ) == 0)
-            {
-                numLeds = attr.as_int();
-            }
-            else
-            {
-                string msg = "unknown attribute ";
-                msg += attr.name();
-                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("LedXmlParser"), string("ParseXML"), msg );
-                hasError = true;
+                case XmlName::Hash( "pwmId" ):
+                {
+                    pwmID = attr.as_int();
+                    hasError = HardwareIDValidation::ValidateDIOID( pwmID, string( "ServoXmlParser::ParseXML(PWM ID)" ) );
+                    break;
+                }
+
+                case XmlName::Hash( "number" ):
+                    numLeds = attr.as_int();
+                    break;
+
+                default:
+                {
+                    string msg = "unknown attribute ";
+                    msg += attr.name();
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("LedXmlParser"), string("ParseXML"), msg );
+                    hasError = true;
+                    break;
+                }
             }
         }
 
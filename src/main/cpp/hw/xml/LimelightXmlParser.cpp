@@ -20,6 +20,7 @@
 #include <hw/factories/LimelightFactory.h>
 #include <hw/xml/LimelightXmlParser.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 #include <utils/UsageValidation.h>
 
 #include <pugixml/pugixml.hpp>
@@ -38,6 +39,8 @@ DragonLimelight* LimelightXmlParser::ParseXML(pugi::xml_node    limelightNode)
     std::string tableName = "";
     units::length::inch_t mountingHeight = units::length::inch_t(0.0);
     units::length::inch_t horizontalOffset = units::length::inch_t(0.0);
+    units::length::inch_t forwardOffset = units::length::inch_t(0.0);
+    units::angle::degree_t mountingYaw = units::angle::degree_t(0.0);
     units::angle::degree_t mountingAngle = units::angle::degree_t(0.0);
     units::angle::degree_t rotation = units::angle::degree_t(0.0);
     units::length::inch_t targetHeight = units::length::inch_t(0.0);
@@ -55,111 +58,131 @@ DragonLimelight* LimelightXmlParser::ParseXML(pugi::xml_node    limelightNode)
     for (pugi::xml_attribute attr = limelightNode.first_attribute(); attr && !hasError; attr = attr.next_attribute())
     {
         // validate/set the usage
-        if ( strcmp( attr.name(), "usage" ) == 0 )
+        switch ( XmlName::Hash( attr.name() ) )
         {
-            usage = UsageValidation::ValidateSensorUsage( attr.value(), "LimelightXmlParser::ParseXML");
-            if ( usage == IDragonSensor::SENSOR_USAGE::UNKNOWN_SENSOR)
+            case XmlName::Hash( "usage" ):
             {
-                hasError = true;
+                usage = UsageValidation::ValidateSensorUsage( attr.value(), "LimelightXmlParser::ParseXML");
+                if ( usage == IDragonSensor::SENSOR_USAGE::UNKNOWN_SENSOR)
+                {
+                    hasError = true;
+                }
+                break;
             }
-        }
-        else if ( strcmp( attr.name(), "tablename" ) == 0 )
-        {
-            tableName = attr.value();
-        }
-        else if ( strcmp( attr.name(), "mountingheight" ) == 0 )
-        {
-            mountingHeight = units::length::inch_t(attr.as_double());
-        }
-        else if ( strcmp( attr.name(), "horizontaloffset" ) == 0 )
-        {
-            horizontalOffset = units::length::inch_t(attr.as_double());
-        }
-        else if ( strcmp( attr.name(), "mountingangle" ) == 0 )
-        {
-            mountingAngle = units::angle::degree_t(attr.as_double());
-        }
-        else if ( strcmp( attr.name(), "rotation" ) == 0 )
-        {
-            rotation = units::angle::degree_t(attr.as_double());
-        }
-        else if ( strcmp( attr.name(), "targetheight" ) == 0 )
-        {
-            targetHeight = units::length::inch_t(attr.as_double());
-        }
-        else if ( strcmp( attr.name(), "targetheight2" ) == 0 )
-        {
-            targetHeight2 = units::length::inch_t(attr.as_double());
-        }
-        else if ( strcmp( attr.name(), "defaultledmode" ) == 0 )
-        {
-            if ( strcmp( attr.value(), "currentpipeline") == 0 )
-            {
-                ledMode = DragonLimelight::LED_MODE::LED_DEFAULT;
-            }
-            else if ( strcmp( attr.value(), "off") == 0 )
-            {
-                ledMode = DragonLimelight::LED_MODE::LED_OFF;
-            }
-            else if ( strcmp( attr.value(), "blink") == 0 )
-            {
-                ledMode = DragonLimelight::LED_MODE::LED_BLINK;
-            }
-            else if ( strcmp( attr.value(), "on") == 0 )
-            {
-                ledMode = DragonLimelight::LED_MODE::LED_ON;
-            }
-        }        
-        else if ( strcmp( attr.name(), "defaultcammode" ) == 0 )
-        {
-            if ( strcmp( attr.value(), "drivercamera")==0)
+
+            case XmlName::Hash( "tablename" ):
+                tableName = attr.value();
+                break;
+
+            case XmlName::Hash( "mountingheight" ):
+                mountingHeight = units::length::inch_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "horizontaloffset" ):
+                horizontalOffset = units::length::inch_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "forwardoffset" ):
+                forwardOffset = units::length::inch_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "mountingyaw" ):
+                mountingYaw = units::angle::degree_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "mountingangle" ):
+                mountingAngle = units::angle::degree_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "rotation" ):
+                rotation = units::angle::degree_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "targetheight" ):
+                targetHeight = units::length::inch_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "targetheight2" ):
+                targetHeight2 = units::length::inch_t(attr.as_double());
+                break;
+
+            case XmlName::Hash( "defaultledmode" ):
             {
-                camMode = DragonLimelight::CAM_MODE::CAM_DRIVER;
+                if ( strcmp( attr.value(), "currentpipeline") == 0 )
+                {
+                    ledMode = DragonLimelight::LED_MODE::LED_DEFAULT;
+                }
+                else if ( strcmp( attr.value(), "off") == 0 )
+                {
+                    ledMode = DragonLimelight::LED_MODE::LED_OFF;
+                }
+                else if ( strcmp( attr.value(), "blink") == 0 )
+                {
+                    ledMode = DragonLimelight::LED_MODE::LED_BLINK;
+                }
+                else if ( strcmp( attr.value(), "on") == 0 )
+                {
+                    ledMode = DragonLimelight::LED_MODE::LED_ON;
+                }
+                break;
             }
-        }        
-        else if ( strcmp( attr.name(), "streammode" ) == 0 )
-        {
-            if ( strcmp( attr.value(), "pipmain") == 0 )
+
+            case XmlName::Hash( "defaultcammode" ):
             {
-                streamMode = DragonLimelight::STREAM_MODE::STREAM_MAIN_AND_SECOND;
+                if ( strcmp( attr.value(), "drivercamera")==0)
+                {
+                    camMode = DragonLimelight::CAM_MODE::CAM_DRIVER;
+                }
+                break;
             }
-            else if ( strcmp( attr.value(), "pipsecondary" ) == 0 )
+
+            case XmlName::Hash( "streammode" ):
             {
-                streamMode = DragonLimelight::STREAM_MODE::STREAM_SECOND_AND_MAIN;
+                if ( strcmp( attr.value(), "pipmain") == 0 )
+                {
+                    streamMode = DragonLimelight::STREAM_MODE::STREAM_MAIN_AND_SECOND;
+                }
+                else if ( strcmp( attr.value(), "pipsecondary" ) == 0 )
+                {
+                    streamMode = DragonLimelight::STREAM_MODE::STREAM_SECOND_AND_MAIN;
+                }
+                break;
             }
-        }        
-        else if ( strcmp( attr.name(), "snapshots" ) == 0 )
-        {
-            if ( strcmp( attr.value(), "twopersec") == 0 )
+
+            case XmlName::Hash( "snapshots" ):
             {
-                snapMode = DragonLimelight::SNAPSHOT_MODE::SNAP_ON;
+                if ( strcmp( attr.value(), "twopersec") == 0 )
+                {
+                    snapMode = DragonLimelight::SNAPSHOT_MODE::SNAP_ON;
+                }
+                break;
             }
-        }
-        else if ( strcmp( attr.name(), "crosshairx" ) == 0 )
-        {
-            defaultXHairX = attr.as_double();
-        }        
-        else if ( strcmp( attr.name(), "crosshairy" ) == 0 )
-        {
-            defaultXHairY = attr.as_double();
-        }        
-        else if ( strcmp( attr.name(), "secondcrosshairx" ) == 0 )
-        {
-            secXHairX = attr.as_double();
-        }        
-        else if ( strcmp( attr.name(), "secondcrosshairy" ) == 0 )
-        {
-            secXHairY = attr.as_double();
-        }
 
+            case XmlName::Hash( "crosshairx" ):
+                defaultXHairX = attr.as_double();
+                break;
 
-		//todo:  add cross hair stuff/streaming options -- everything after target heights
-        else
-        {
-            string msg = "unknown attribute ";
-            msg += attr.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("LimelightXmlParser"), string("ParseXML"), msg );
-            hasError = true;
+            case XmlName::Hash( "crosshairy" ):
+                defaultXHairY = attr.as_double();
+                break;
+
+            case XmlName::Hash( "secondcrosshairx" ):
+                secXHairX = attr.as_double();
+                break;
+
+            case XmlName::Hash( "secondcrosshairy" ):
+                secXHairY = attr.as_double();
+                break;
+
+            //todo:  add cross hair stuff/streaming options -- everything after target heights
+            default:
+            {
+                string msg = "unknown attribute ";
+                msg += attr.name();
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("LimelightXmlParser"), string("ParseXML"), msg );
+                hasError = true;
+                break;
+            }
         }
     }
 
@@ -174,6 +197,8 @@ DragonLimelight* LimelightXmlParser::ParseXML(pugi::xml_node    limelightNode)
             mountingAngle,
             targetHeight,
             targetHeight2,
+            forwardOffset,
+            mountingYaw,
             ledMode,
             camMode,
             streamMode,
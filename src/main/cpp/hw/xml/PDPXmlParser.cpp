@@ -28,6 +28,7 @@
 #include <hw/factories/PDPFactory.h>
 #include <utils/HardwareIDValidation.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 #include <hw/xml/PDPXmlParser.h>
 
 // Third Party Includes
@@ -59,37 +60,45 @@ PowerDistribution* PDPXmlParser::ParseXML
     // parse/validate the PDP XML node
     for (xml_attribute attr = PDPNode.first_attribute(); attr && !hasError; attr = attr.next_attribute())
     {
-        if ( strcmp( attr.name(), "canId" ) == 0 )
+        switch ( XmlName::Hash( attr.name() ) )
         {
-            canID = attr.as_int();
-            hasError = HardwareIDValidation::ValidateCANID( canID, string( "PDPXmlParser::ParseXML" ) );
-        }
-        else if ( strcmp( attr.name(), "type" ) == 0 )
-        {
-            auto val = string( attr.value() );
-            if ( val.compare( "CTRE") == 0 )
+            case XmlName::Hash( "canId" ):
             {
-                type = PowerDistribution::ModuleType::kCTRE;
-                if (canID == -1)
-                {
-                    canID = 0;
-                }
+                canID = attr.as_int();
+                hasError = HardwareIDValidation::ValidateCANID( canID, string( "PDPXmlParser::ParseXML" ) );
+                break;
             }
-            else if (val.compare("REV") == 0)
+
+            case XmlName::Hash( "type" ):
             {
-                type = PowerDistribution::ModuleType::kRev;
-                if (canID == -1)
+                auto val = string( attr.value() );
+                if ( val.compare( "CTRE") == 0 )
+                {
+                    type = PowerDistribution::ModuleType::kCTRE;
+                    if (canID == -1)
+                    {
+                        canID = 0;
+                    }
+                }
+                else if (val.compare("REV") == 0)
                 {
-                    canID = 1;
+                    type = PowerDistribution::ModuleType::kRev;
+                    if (canID == -1)
+                    {
+                        canID = 1;
+                    }
                 }
+                break;
+            }
+
+            default:
+            {
+                string msg = "unknown attribute ";
+                msg += attr.name();
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("PDPXmlParser"), string("ParseXML"), msg );
+                hasError = true;
+                break;
             }
-        }
-        else
-        {
-            string msg = "unknown attribute ";
-            msg += attr.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("PDPXmlParser"), string("ParseXML"), msg );
-            hasError = true;
         }
     }
 
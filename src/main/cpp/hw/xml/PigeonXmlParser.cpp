@@ -25,6 +25,7 @@
 #include <hw/DragonPigeon.h>
 #include <utils/HardwareIDValidation.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 #include <hw/factories/PigeonFactory.h>
 
 // Third Party Includes
@@ -59,48 +60,58 @@ DragonPigeon* PigeonXmlParser::ParseXML
     // parse/validate xml
     for (xml_attribute attr = pigeonNode.first_attribute(); attr; attr = attr.next_attribute())
     {
-        if ( strcmp( attr.name(), "canId" ) == 0 )
+        switch ( XmlName::Hash( attr.name() ) )
         {
-            canID = attr.as_int();
-            hasError = HardwareIDValidation::ValidateCANID( canID, string( "Pigeon::ParseXML" ) );
-        }
-        else if (strcmp(attr.name(), "canbus") == 0)
-        {
-            canBusName = attr.as_string();
-        }
-        else if ( strcmp( attr.name(), "rotation") == 0 )
-        {
-            rotation = attr.as_double();
-        }
-        else if (strcmp(attr.name(), "type") == 0)
-        {
-            if (strcmp(attr.value(), "PIGEON2") == 0)
+            case XmlName::Hash( "canId" ):
             {
-                type = DragonPigeon::PIGEON_TYPE::PIGEON2;
+                canID = attr.as_int();
+                hasError = HardwareIDValidation::ValidateCANID( canID, string( "Pigeon::ParseXML" ) );
+                break;
             }
-            else 
+
+            case XmlName::Hash( "canbus" ):
+                canBusName = attr.as_string();
+                break;
+
+            case XmlName::Hash( "rotation" ):
+                rotation = attr.as_double();
+                break;
+
+            case XmlName::Hash( "type" ):
             {
-                type = DragonPigeon::PIGEON_TYPE::PIGEON1;
+                if (strcmp(attr.value(), "PIGEON2") == 0)
+                {
+                    type = DragonPigeon::PIGEON_TYPE::PIGEON2;
+                }
+                else
+                {
+                    type = DragonPigeon::PIGEON_TYPE::PIGEON1;
+                }
+                break;
             }
-        }
-        else if (strcmp(attr.name(), "usage") == 0)
-        {
-            if (strcmp(attr.value(), "CENTER_OF_SHOOTER") == 0)
+
+            case XmlName::Hash( "usage" ):
             {
-                usage = DragonPigeon::PIGEON_USAGE::CENTER_OF_SHOOTER;
+                if (strcmp(attr.value(), "CENTER_OF_SHOOTER") == 0)
+                {
+                    usage = DragonPigeon::PIGEON_USAGE::CENTER_OF_SHOOTER;
+                }
+                else
+                {
+                    usage = DragonPigeon::PIGEON_USAGE::CENTER_OF_ROBOT;
+                }
+                break;
             }
-            else 
+
+            default:
             {
-                usage = DragonPigeon::PIGEON_USAGE::CENTER_OF_ROBOT;
+                string msg("Invalid attribute ");
+                msg += attr.name();
+                Logger::GetLogger()->LogData( LOGGER_LEVEL::ERROR, string("PigeonXmlParser"), string("ParseXML"), msg );
+                hasError = true;
+                break;
             }
         }
-        else
-        {
-            string msg("Invalid attribute ");
-            msg += attr.name();
-            Logger::GetLogger()->LogData( LOGGER_LEVEL::ERROR, string("PigeonXmlParser"), string("ParseXML"), msg );
-            hasError = true;
-        }
 
     }
 
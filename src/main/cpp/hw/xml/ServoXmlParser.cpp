@@ -26,6 +26,7 @@
 #include <hw/usages/ServoUsage.h>
 #include <utils/HardwareIDValidation.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 #include <hw/xml/ServoXmlParser.h>
 
 // Third Party Includes
@@ -60,30 +61,35 @@ using namespace std;
         // parse/validate the xml
         for (pugi::xml_attribute attr = ServoNode.first_attribute(); attr && !hasError; attr = attr.next_attribute())
         {
-            string attrName (attr.name());
-            if (attrName.compare("usage") == 0)
+            switch ( XmlName::Hash( attr.name() ) )
             {
-                usage = ServoUsage::GetInstance()->GetUsage( string( attr.value()));
-            }
-            else if (attrName.compare("pwmId" ) == 0)
-            {
-                pwmID = attr.as_int();
-                hasError = HardwareIDValidation::ValidateDIOID( pwmID, string( "ServoXmlParser::ParseXML(PWM ID)" ) );
-            }
-            else if (attrName.compare("minAngle" ) == 0)
-            {
-                minAngle = attr.as_int();
-            }
-            else if (attrName.compare("maxAngle" ) == 0)
-            {
-                maxAngle = attr.as_int();
-            }
-            else
-            {
-                string msg = "unknown attribute ";
-                msg += attr.name();
-                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ServoXmlParser"), string("ParseXML"), msg );
-                hasError = true;
+                case XmlName::Hash( "usage" ):
+                    usage = ServoUsage::GetInstance()->GetUsage( string( attr.value()));
+                    break;
+
+                case XmlName::Hash( "pwmId" ):
+                {
+                    pwmID = attr.as_int();
+                    hasError = HardwareIDValidation::ValidateDIOID( pwmID, string( "ServoXmlParser::ParseXML(PWM ID)" ) );
+                    break;
+                }
+
+                case XmlName::Hash( "minAngle" ):
+                    minAngle = attr.as_int();
+                    break;
+
+                case XmlName::Hash( "maxAngle" ):
+                    maxAngle = attr.as_int();
+                    break;
+
+                default:
+                {
+                    string msg = "unknown attribute ";
+                    msg += attr.name();
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ServoXmlParser"), string("ParseXML"), msg );
+                    hasError = true;
+                    break;
+                }
             }
         }
 
@@ -31,6 +31,7 @@
 #include <hw/usages/SolenoidUsage.h>
 #include <utils/HardwareIDValidation.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 
 
 // Third Party Includes
@@ -61,31 +62,39 @@ shared_ptr<DragonSolenoid> SolenoidXmlParser::ParseXML
 
     for (xml_attribute attr = solenoidNode.first_attribute(); attr && !hasError; attr = attr.next_attribute())
     {
-        if ( strcmp( attr.name(), "usage" ) == 0 )
+        switch ( XmlName::Hash( attr.name() ) )
         {
-             usage = SolenoidUsage::GetInstance()->GetUsage( string(attr.value()));
-        }
-        else if ( strcmp( attr.name(), "canId" ) == 0 )
-        {
-            pcmID = attr.as_int();
-            hasError = HardwareIDValidation::ValidateCANID( pcmID, string( "SolenoidXmlParser::ParseXML" ) );
-        }
-        else if ( strcmp( attr.name(), "channel" ) == 0 )
-        {
-            channel = attr.as_int();
-            hasError = HardwareIDValidation::ValidateSolenoidChannel( channel, string( "SolenoidXmlParser::ParseXML" ) );
-        }
-		// brake mode (or coast)
-        else if ( strcmp( attr.name(), "reversed" ) == 0 )
-        {
-            reversed = attr.as_bool();
-        }
-        else
-        {
-            string msg = "Invalid attribute";
-            msg += attr.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("Solenoid "), string("ParseXML "), msg );
-            hasError = true;
+            case XmlName::Hash( "usage" ):
+                usage = SolenoidUsage::GetInstance()->GetUsage( string(attr.value()));
+                break;
+
+            case XmlName::Hash( "canId" ):
+            {
+                pcmID = attr.as_int();
+                hasError = HardwareIDValidation::ValidateCANID( pcmID, string( "SolenoidXmlParser::ParseXML" ) );
+                break;
+            }
+
+            case XmlName::Hash( "channel" ):
+            {
+                channel = attr.as_int();
+                hasError = HardwareIDValidation::ValidateSolenoidChannel( channel, string( "SolenoidXmlParser::ParseXML" ) );
+                break;
+            }
+
+            // brake mode (or coast)
+            case XmlName::Hash( "reversed" ):
+                reversed = attr.as_bool();
+                break;
+
+            default:
+            {
+                string msg = "Invalid attribute";
+                msg += attr.name();
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("Solenoid "), string("ParseXML "), msg );
+                hasError = true;
+                break;
+            }
         }
     }
 
@@ -1,5 +1,6 @@
 #include <string>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 #include <pugixml/pugixml.hpp>
 #include <utils/HardwareIDValidation.h>
 #include <hw/xml/ThroughBoreEncoderXmlParser.h>
@@ -23,32 +24,43 @@ Encoder* ThroughBoreEncoderXmlParser::ParseXML
     Encoder* throughboreencoder = nullptr;
     for ( xml_attribute attr = throughBoreEncoderNode.first_attribute(); attr && !hasError; attr = attr.next_attribute())
     {
-        if ( strcmp (attr.name(), "usage") == 0 )
+        switch ( XmlName::Hash( attr.name() ) )
         {
-            usage = attr.value();
-        }
-        else if (strcmp (attr.name(), "DIOA") == 0 )
-        {
-            DIOA = attr.as_int();
-            hasError = HardwareIDValidation::ValidateDIOID( DIOA, string( "ThroughBoreEncoderXmlParser::ParseXML" ) );
-        }
-        else if ( strcmp( attr.name(), "DIOB ") == 0)
-        {
-            DIOB = attr.as_int();
-            hasError = HardwareIDValidation::ValidateDIOID( DIOB, string( "ThroughBoreEncoderXmlParser::ParseXML" ) );
-        }
-        else if ( strcmp (attr.name(), "PWMID") == 0)
-        {
-            int iVal = attr.as_int();
-            if (iVal >= 0 && iVal <= 9) //filler values todo need to find actual values or have ID Validation
+            case XmlName::Hash( "usage" ):
+                usage = attr.value();
+                break;
+
+            case XmlName::Hash( "DIOA" ):
+            {
+                DIOA = attr.as_int();
+                hasError = HardwareIDValidation::ValidateDIOID( DIOA, string( "ThroughBoreEncoderXmlParser::ParseXML" ) );
+                break;
+            }
+
+            case XmlName::Hash( "DIOB" ):
             {
-                PWMID = attr.as_int();
+                DIOB = attr.as_int();
+                hasError = HardwareIDValidation::ValidateDIOID( DIOB, string( "ThroughBoreEncoderXmlParser::ParseXML" ) );
+                break;
             }
-            else
+
+            case XmlName::Hash( "PWMID" ):
             {
-                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ThroughBoreEncoderXmlParser::ParseXML"),string("invalid PWN ID \n"), string("iVal"));
-                hasError = true;
+                int iVal = attr.as_int();
+                if (iVal >= 0 && iVal <= 9) //filler values todo need to find actual values or have ID Validation
+                {
+                    PWMID = attr.as_int();
+                }
+                else
+                {
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ThroughBoreEncoderXmlParser::ParseXML"),string("invalid PWN ID \n"), string("iVal"));
+                    hasError = true;
+                }
+                break;
             }
+
+            default:
+                break;
         }
     }
     if (!hasError)
@@ -73,6 +73,36 @@ void StateMgrHelper::SetMechanismStateFromParam
     }
 }
 
+void StateMgrHelper::SetMechanismStateFromName
+(
+    const string&           name
+)
+{
+    auto separator = name.find(':');
+    auto mechName = separator != string::npos ? name.substr(0, separator) : string();
+    auto stateName = separator != string::npos ? name.substr(separator+1) : name;
+
+    auto found = false;
+    for (auto i=MechanismTypes::MECHANISM_TYPE::EXAMPLE+1; i<MechanismTypes::MECHANISM_TYPE::MAX_MECHANISM_TYPES; ++i)
+    {
+        auto mech = MechanismFactory::GetMechanismFactory()->GetMechanism(static_cast<MechanismTypes::MECHANISM_TYPE>(i));
+        auto stateMgr = mech != nullptr ? mech->GetStateMgr() : nullptr;
+        if (stateMgr != nullptr && (mechName.empty() || mech->GetNetworkTableName() == mechName))
+        {
+            auto stateID = stateMgr->GetStateID(stateName);
+            if (stateID > -1)
+            {
+                stateMgr->SetCurrentState(stateID, true);
+                found = true;
+            }
+        }
+    }
+    if (!found)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateMgrHelper"), string("unknown state"), name);
+    }
+}
+
 void StateMgrHelper::SetCheckGamepadInputsForStateTransitions
 (
     bool  check
@@ -89,6 +119,19 @@ void StateMgrHelper::SetCheckGamepadInputsForStateTransitions
     }   
 }
 
+void StateMgrHelper::ReloadStateTargets()
+{
+    for (auto i=MechanismTypes::MECHANISM_TYPE::EXAMPLE+1; i<MechanismTypes::MECHANISM_TYPE::MAX_MECHANISM_TYPES; ++i)
+    {
+        auto mech = MechanismFactory::GetMechanismFactory()->GetMechanism(static_cast<MechanismTypes::MECHANISM_TYPE>(i));
+        auto stateMgr = mech != nullptr ? mech->GetStateMgr() : nullptr;
+        if (stateMgr != nullptr)
+        {
+            stateMgr->ReloadTargets();
+        }
+    }   
+}
+
 State* StateMgrHelper::CreateState
 (
     Mech*                       mech,
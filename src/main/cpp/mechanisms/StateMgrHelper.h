@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <mechanisms/StateStruc.h>
 
 class Mech;
@@ -31,10 +33,18 @@ class StateMgrHelper
         (
             PrimitiveParams*        params
         );
+        /// @brief set a mechanism state by name (e.g. from a path event marker); "mechanism:state" limits it to the
+        ///        mechanism with that network table name, otherwise every mechanism with a state of that name changes
+        static void SetMechanismStateFromName
+        (
+            const std::string&      name
+        );
         static void SetCheckGamepadInputsForStateTransitions
         (
             bool  check
         );
+        /// @brief push tuned state targets into every state manager's states
+        static void ReloadStateTargets();
 
         static State* CreateState
         (
@@ -107,6 +107,21 @@ void Mech1IndMotor::SetControlConstants
     }
 }
 
+/// @brief  Get the motor ready to use the control constants so setting them later is cheap
+/// @param [in] ControlData* pid:  the control constants
+/// @return void
+void Mech1IndMotor::PrepareControlConstants
+(
+    int                                         slot,
+    ControlData*                                pid                 
+)
+{
+    if ( m_motor.get() != nullptr )
+    {
+        m_motor.get()->PrepareControlConstants( slot, pid );
+    }
+}
+
 
 
 /// @brief log data to the network table if it is activated and time period has past
@@ -75,6 +75,15 @@ class Mech1IndMotor :  public Mech
             int                                         slot,
             ControlData*                                pid                 
         );
+
+        /// @brief  Get the motor ready to use the control constants so setting them later is cheap
+        /// @param [in] ControlData*                                   pid:  the control constants
+        /// @return void
+        void PrepareControlConstants
+        (
+            int                                         slot,
+            ControlData*                                pid                 
+        );
         double GetTarget() const { return m_target; }
         std::shared_ptr<IDragonMotorController> GetMotor() const {return m_motor;}
 
@@ -68,6 +68,14 @@ void Mech1IndMotorSolenoidState::Init()
 }
 
 
+void Mech1IndMotorSolenoidState::UpdateTargets
+(
+    const MechanismTargetData*  targetData
+)
+{
+    m_motorState.get()->UpdateTargets( targetData );
+}
+
 void Mech1IndMotorSolenoidState::Run()           
 {
     m_motorState.get()->Run();
@@ -48,6 +48,7 @@ class Mech1IndMotorSolenoidState : public State
         void Run() override;
         void Exit() override;
         bool AtTarget() const override;
+        void UpdateTargets( const MechanismTargetData* targetData ) override;
 
         double GetTarget() const;
         double GetRPS() const;
@@ -22,9 +22,11 @@
 
 // Team 302 includes
 #include <State.h>
+#include <hw/DragonPowerManager.h>
 #include <mechanisms/base/Mech1MotorState.h>
 #include <mechanisms/controllers/ControlData.h>
 #include <mechanisms/controllers/MechanismTargetData.h>
+#include <mechanisms/controllers/RioControlLoop.h>
 #include <mechanisms/base/Mech1IndMotor.h>
 #include <utils/Logger.h>
 
@@ -48,7 +50,9 @@ Mech1MotorState::Mech1MotorState
     m_control( control ),
     m_target( target ),
     m_positionBased( false ),
-    m_speedBased( false )
+    m_speedBased( false ),
+    m_rioLoop( -1 ),
+    m_powerHandle( -1 )
 {
     auto ntName = string("Mech1MotorState");
     if ( mechanism == nullptr )
@@ -117,6 +121,23 @@ Mech1MotorState::Mech1MotorState
                 m_speedBased = false;
                 break;
         }
+
+        // states are created when the state manager is initialized, so do the controller setup now instead of in Init()
+        if ( mechanism != nullptr )
+        {
+            if ( control->GetRunLoc() == ControlModes::CONTROL_RUN_LOCS::ROBORIO && control->GetMode() != ControlModes::CONTROL_TYPE::PERCENT_OUTPUT )
+            {
+                m_rioLoop = RioControlLoop::GetRioControlLoop()->Register( mechanism->GetMotor(), control );
+            }
+            if ( m_rioLoop < 0 )
+            {
+                mechanism->PrepareControlConstants( 0, control );
+                if ( DragonPowerManager::CanScale( control->GetMode() ) )
+                {
+                    m_powerHandle = DragonPowerManager::GetPowerManager()->Register( mechanism->GetMotor(), DragonPowerManager::POWER_PRIORITY::MECHANISM );
+                }
+            }
+        }
     }
     
 }
@@ -125,22 +146,53 @@ void Mech1MotorState::Init()
 {
     if ( m_mechanism != nullptr && m_control != nullptr )
     {
-        m_mechanism->SetControlConstants( 0, m_control );
-        m_mechanism->UpdateTarget( m_target );
+        if ( m_rioLoop >= 0 )
+        {
+            RioControlLoop::GetRioControlLoop()->SetTarget( m_rioLoop, m_target );
+        }
+        else
+        {
+            // the controller was set up for m_control in the constructor, so this only switches to it
+            m_mechanism->SetControlConstants( 0, m_control );
+            m_mechanism->UpdateTarget( m_target );
+        }
     }
 }
 
 
 void Mech1MotorState::Run()           
 {
-    if ( m_mechanism != nullptr)
+    // the roborio control loop thread drives the motor
+    if ( m_mechanism != nullptr && m_rioLoop < 0 )
     {
-        m_mechanism->Update();
+        if ( m_powerHandle >= 0 )
+        {
+            m_mechanism->UpdateTarget( DragonPowerManager::GetPowerManager()->ScaleTarget( m_powerHandle, m_control->GetMode(), m_target ) );
+        }
+        else
+        {
+            m_mechanism->Update();
+        }
     }
 }
 
 void Mech1MotorState::Exit() 
 {
+    if ( m_rioLoop >= 0 )
+    {
+        RioControlLoop::GetRioControlLoop()->Disable( m_rioLoop );
+    }
+}
+
+void Mech1MotorState::UpdateTargets
+(
+    const MechanismTargetData*  targetData
+)
+{
+    if ( targetData != nullptr )
+    {
+        m_target = targetData->GetTarget();
+    }
 }
 
 bool Mech1MotorState::AtTarget() const
@@ -40,6 +40,7 @@ class Mech1MotorState : public State
         void Run() override;
         void Exit() override;
         bool AtTarget() const override;
+        void UpdateTargets( const MechanismTargetData* targetData ) override;
 
         void LogInformation() const override;
 
@@ -56,4 +57,6 @@ class Mech1MotorState : public State
         double                          m_target;
         bool                            m_positionBased;
         bool                            m_speedBased;
+        int                             m_rioLoop;          // RioControlLoop handle when the control runs on the roborio
+        int                             m_powerHandle;      // DragonPowerManager handle when the target can be scaled
 };
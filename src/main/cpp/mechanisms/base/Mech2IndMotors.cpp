@@ -152,6 +152,32 @@ void Mech2IndMotors::SetSecondaryControlConstants
     }    
 }
 
+/// @brief  Get the motors ready to use the control constants so setting them later is cheap
+/// @param [in] ControlData*                                   pid:  the control constants
+/// @return void
+void Mech2IndMotors::PrepareControlConstants
+(
+    int                                         slot,
+    ControlData*                                pid                 
+) 
+{
+    if ( m_primary.get() != nullptr )
+    {
+        m_primary.get()->PrepareControlConstants(slot, pid);
+    }
+}
+void Mech2IndMotors::PrepareSecondaryControlConstants
+(
+    int                                         slot,
+    ControlData*                                pid                 
+) 
+{
+    if ( m_secondary.get() != nullptr )
+    {
+        m_secondary.get()->PrepareControlConstants(slot, pid);
+    }    
+}
+
 
 /// @brief log data to the network table if it is activated and time period has past
 void Mech2IndMotors::LogInformation() const
@@ -92,6 +92,20 @@ class Mech2IndMotors : public Mech
             ControlData*                                pid                 
         );
 
+        /// @brief  Get the motors ready to use the control constants so setting them later is cheap
+        /// @param [in] ControlData*                                   pid:  the control constants
+        /// @return void
+        void PrepareControlConstants
+        (
+            int                                         slot,
+            ControlData*                                pid                 
+        );
+        void PrepareSecondaryControlConstants
+        (
+            int                                         slot,
+            ControlData*                                pid                 
+        );
+
         double GetPrimaryTarget() const { return m_primaryTarget; }
         double GetSecondaryTarget() const { return m_secondaryTarget; }
 
@@ -22,8 +22,10 @@
 
 // Team 302 includes
 #include <State.h>
+#include <hw/DragonPowerManager.h>
 #include <mechanisms/base/Mech2MotorState.h>
 #include <mechanisms/controllers/ControlData.h>
+#include <mechanisms/controllers/RioControlLoop.h>
 #include <mechanisms/controllers/MechanismTargetData.h>
 #include <mechanisms/base/Mech2IndMotors.h>
 #include <utils/Logger.h>
@@ -52,7 +54,11 @@ Mech2MotorState::Mech2MotorState
     m_primaryTarget( primaryTarget ),
     m_secondaryTarget( secondaryTarget ),
     m_positionBased( false ),
-    m_speedBased( false )
+    m_speedBased( false ),
+    m_rioLoop( -1 ),
+    m_rioLoop2( -1 ),
+    m_powerHandle( -1 ),
+    m_powerHandle2( -1 )
 {
     if ( mechanism == nullptr )
     {
@@ -127,7 +133,26 @@ Mech2MotorState::Mech2MotorState
         {
             Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, mechanism->GetNetworkTableName(), ("Mech2MotorState::Mech2MotorState"), string("inconsistent control modes"));
         }
-        
+
+        // states are created when the state manager is initialized, so do the controller setup now instead of in Init()
+        // (both motors run on the roborio or neither does, so one state never mixes the two)
+        if ( control->GetRunLoc() == ControlModes::CONTROL_RUN_LOCS::ROBORIO && mode != ControlModes::CONTROL_TYPE::PERCENT_OUTPUT && 
+             control2->GetRunLoc() == ControlModes::CONTROL_RUN_LOCS::ROBORIO && mode2 != ControlModes::CONTROL_TYPE::PERCENT_OUTPUT )
+        {
+            m_rioLoop = RioControlLoop::GetRioControlLoop()->Register( mechanism->GetPrimaryMotor(), control );
+            m_rioLoop2 = RioControlLoop::GetRioControlLoop()->Register( mechanism->GetSecondaryMotor(), control2 );
+        }
+        if ( m_rioLoop < 0 || m_rioLoop2 < 0 )
+        {
+            m_rioLoop = -1;
+            m_rioLoop2 = -1;
+            mechanism->PrepareControlConstants( 0, control );
+            mechanism->PrepareSecondaryControlConstants( 0, control2 );
+
+            auto powerMgr = DragonPowerManager::GetPowerManager();
+            m_powerHandle = DragonPowerManager::CanScale( mode ) ? powerMgr->Register( mechanism->GetPrimaryMotor(), DragonPowerManager::POWER_PRIORITY::MECHANISM ) : -1;
+            m_powerHandle2 = DragonPowerManager::CanScale( mode2 ) ? powerMgr->Register( mechanism->GetSecondaryMotor(), DragonPowerManager::POWER_PRIORITY::MECHANISM ) : -1;
+        }
     }
     
 }
@@ -136,23 +161,59 @@ void Mech2MotorState::Init()
 {
     if ( m_mechanism != nullptr && m_control != nullptr && m_control2 != nullptr )
     {
-        m_mechanism->SetControlConstants( 0, m_control );
-        m_mechanism->SetSecondaryControlConstants( 0, m_control2 );
-        m_mechanism->UpdateTargets( m_primaryTarget, m_secondaryTarget );
+        if ( m_rioLoop >= 0 )
+        {
+            RioControlLoop::GetRioControlLoop()->SetTarget( m_rioLoop, m_primaryTarget );
+            RioControlLoop::GetRioControlLoop()->SetTarget( m_rioLoop2, m_secondaryTarget );
+        }
+        else
+        {
+            // the controllers were set up in the constructor, so this only switches to them
+            m_mechanism->SetControlConstants( 0, m_control );
+            m_mechanism->SetSecondaryControlConstants( 0, m_control2 );
+            m_mechanism->UpdateTargets( m_primaryTarget, m_secondaryTarget );
+        }
     }
 }
 
 
 void Mech2MotorState::Run()           
 {
-    if ( m_mechanism != nullptr )
+    // the roborio control loop thread drives the motors
+    if ( m_mechanism != nullptr && m_rioLoop < 0 )
     {
-        m_mechanism->Update();
+        if ( m_powerHandle >= 0 || m_powerHandle2 >= 0 )
+        {
+            auto powerMgr = DragonPowerManager::GetPowerManager();
+            m_mechanism->UpdateTargets( powerMgr->ScaleTarget( m_powerHandle, m_control->GetMode(), m_primaryTarget ),
+                                        powerMgr->ScaleTarget( m_powerHandle2, m_control2->GetMode(), m_secondaryTarget ) );
+        }
+        else
+        {
+            m_mechanism->Update();
+        }
     }
 }
 
 void Mech2MotorState::Exit() 
 {
+    if ( m_rioLoop >= 0 )
+    {
+        RioControlLoop::GetRioControlLoop()->Disable( m_rioLoop );
+        RioControlLoop::GetRioControlLoop()->Disable( m_rioLoop2 );
+    }
+}
+
+void Mech2MotorState::UpdateTargets
+(
+    const MechanismTargetData*  targetData
+)
+{
+    if ( targetData != nullptr )
+    {
+        m_primaryTarget = targetData->GetTarget();
+        m_secondaryTarget = targetData->GetSecondTarget();
+    }
 }
 
 bool Mech2MotorState::AtTarget() const
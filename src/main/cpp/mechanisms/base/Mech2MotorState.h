@@ -44,6 +44,7 @@ class Mech2MotorState : public State
         void Run() override;
         void Exit() override;
         bool AtTarget() const override;
+        void UpdateTargets( const MechanismTargetData* targetData ) override;
 
         void LogInformation() const override;
 
@@ -63,4 +64,8 @@ class Mech2MotorState : public State
         double                          m_secondaryTarget;
         bool                            m_positionBased;
         bool                            m_speedBased;
+        int                             m_rioLoop;          // RioControlLoop handles when the controls run on the roborio
+        int                             m_rioLoop2;
+        int                             m_powerHandle;      // DragonPowerManager handles when the targets can be scaled
+        int                             m_powerHandle2;
 };
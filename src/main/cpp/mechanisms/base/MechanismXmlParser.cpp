@@ -46,6 +46,7 @@
 #include <mechanisms/MechanismFactory.h>
 #include <mechanisms/MechanismTypes.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 
 // Third Party Includes
 #include <pugixml/pugixml.hpp>
@@ -73,28 +74,33 @@ void MechanismXmlParser::ParseXML
     // Parse/validate xml
     for (xml_attribute attr = mechanismNode.first_attribute(); attr; attr = attr.next_attribute())
     {
-        string attrName (attr.name());
-        if ( attrName.compare("type") == 0 )
+        switch ( XmlName::Hash( attr.name() ) )
         {
-            string typeStr = attr.as_string();
-            for_each( typeStr.begin(), typeStr.end(), [](char & c){c = ::toupper(c);});
+            case XmlName::Hash( "type" ):
+            {
+                string typeStr = attr.as_string();
+                for_each( typeStr.begin(), typeStr.end(), [](char & c){c = ::toupper(c);});
 
-            type = MechanismTypes::GetInstance()->GetType(typeStr);
-        }
-        else if ( attrName.compare("networkTable") == 0 )
-        {
-            networkTableName = attr.as_string();
-        }
-        else if ( attrName.compare("controlFile") == 0 )
-        {
-            controlFileName = attr.as_string();
-        }
-        else
-        {
-            string msg = "invalid attribute ";
-            msg += attr.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("MechanismXmlParser"), string("ParseXML"), msg );
-            hasError = true;
+                type = MechanismTypes::GetInstance()->GetType(typeStr);
+                break;
+            }
+
+            case XmlName::Hash( "networkTable" ):
+                networkTableName = attr.as_string();
+                break;
+
+            case XmlName::Hash( "controlFile" ):
+                controlFileName = attr.as_string();
+                break;
+
+            default:
+            {
+                string msg = "invalid attribute ";
+                msg += attr.name();
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("MechanismXmlParser"), string("ParseXML"), msg );
+                hasError = true;
+                break;
+            }
         }
     }
 
@@ -115,55 +121,69 @@ void MechanismXmlParser::ParseXML
 
     for (xml_node child = mechanismNode.first_child(); child  && !hasError; child = child.next_sibling())
     {
-        if ( strcmp( child.name(), "motor") == 0 )
+        switch ( XmlName::Hash( child.name() ) )
         {
-            auto motor = motorXML.get()->ParseXML(networkTableName, child);
-            if ( motor.get() != nullptr )
+            case XmlName::Hash( "motor" ):
             {
-                motors[ motor.get()->GetType() ] =  motor ;
+                auto motor = motorXML.get()->ParseXML(networkTableName, child);
+                if ( motor.get() != nullptr )
+                {
+                    motors[ motor.get()->GetType() ] =  motor ;
+                }
+                break;
             }
-        }
-        else if ( strcmp( child.name(), "analogInput") == 0 )
-        {
-            auto analogIn = analogXML->ParseXML(networkTableName, child);
-            if ( analogIn != nullptr )
+
+            case XmlName::Hash( "analogInput" ):
             {
-                analogInputs[analogIn->GetType()] = analogIn;
+                auto analogIn = analogXML->ParseXML(networkTableName, child);
+                if ( analogIn != nullptr )
+                {
+                    analogInputs[analogIn->GetType()] = analogIn;
+                }
+                break;
             }
-        }
-        else if ( strcmp( child.name(), "digitalInput") == 0 )
-        {
-            auto digitalIn = digitalXML->ParseXML(networkTableName, child);
-            if ( digitalIn.get() != nullptr )
+
+            case XmlName::Hash( "digitalInput" ):
             {
-                digitalInputs[digitalIn.get()->GetType()] = digitalIn;
+                auto digitalIn = digitalXML->ParseXML(networkTableName, child);
+                if ( digitalIn.get() != nullptr )
+                {
+                    digitalInputs[digitalIn.get()->GetType()] = digitalIn;
+                }
+                break;
             }
-        }
-        else if ( strcmp( child.name(), "servo") == 0 )
-        {
-            auto servo = servoXML->ParseXML(networkTableName, child);
-            if ( servo != nullptr )
+
+            case XmlName::Hash( "servo" ):
             {
-                servos[servo->GetUsage()] = servo;
+                auto servo = servoXML->ParseXML(networkTableName, child);
+                if ( servo != nullptr )
+                {
+                    servos[servo->GetUsage()] = servo;
+                }
+                break;
             }
-        }
-        else if ( strcmp( child.name(), "solenoid" ) == 0 )
-        {
-            auto sol = solenoidXML->ParseXML(networkTableName, child);
-            if ( sol.get() != nullptr )
+
+            case XmlName::Hash( "solenoid" ):
             {
-                solenoids[sol.get()->GetType()] = sol;
+                auto sol = solenoidXML->ParseXML(networkTableName, child);
+                if ( sol.get() != nullptr )
+                {
+                    solenoids[sol.get()->GetType()] = sol;
+                }
+                break;
+            }
+
+            case XmlName::Hash( "canCoder" ):
+                canCoder = cancoderXML.get()->ParseXML(networkTableName, child);
+                break;
+
+            default:
+            {
+                string msg = "unknown child ";
+                msg += child.name();
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("MechanismXmlParser"), string("unknown child"), msg );
+                break;
             }
-        }
-        else if ( strcmp( child.name(), "canCoder" ) == 0)
-        {
-            canCoder = cancoderXML.get()->ParseXML(networkTableName, child);
-        }
-        else
-        {
-            string msg = "unknown child ";
-            msg += child.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("MechanismXmlParser"), string("unknown child"), msg );
         }
     }
 
@@ -19,17 +19,20 @@
 #include <vector>
 
 // FRC includes
+#include <frc/Timer.h>
 #include <networktables/NetworkTableInstance.h>
 #include <networktables/NetworkTable.h>
 #include <networktables/NetworkTableEntry.h>
 
 // Team 302 includes
 #include <auton/PrimitiveParams.h>
+#include <hw/ctreadapters/DragonControlToCTREAdapter.h>
 #include <State.h>
+#include <TeleopControl.h>
 #include <mechanisms/base/Mech.h>
 #include <mechanisms/base/StateMgr.h>
 #include <mechanisms/controllers/MechanismTargetData.h>
-#include <mechanisms/controllers/StateDataXmlParser.h>
+#include <mechanisms/controllers/StateDataCache.h>
 #include <mechanisms/MechanismFactory.h>
 #include <mechanisms/StateMgrHelper.h>
 #include <mechanisms/StateStruc.h>
@@ -43,8 +46,22 @@ using namespace std;
 StateMgr::StateMgr() : m_mech(nullptr),
                        m_currentState(),
                        m_stateVector(),
+                       m_stateTargetData(),
                        m_currentStateID(0),
-                       m_checkGamePadTransitions(true)
+                       m_checkGamePadTransitions(true),
+                       m_transitions(nullptr),
+                       m_numTransitions(0),
+                       m_transitionInputs(),
+                       m_tableChecks(0),
+                       m_tableEdges(0),
+                       m_tableTransitions(0),
+                       m_tableTime(units::time::second_t(0.0)),
+                       m_maxTableTime(units::time::second_t(0.0)),
+                       m_maxTransitionLatency(units::time::second_t(0.0)),
+                       m_stateChanges(0),
+                       m_stateChangeAdapters(0),
+                       m_stateChangeConfigCalls(0),
+                       m_maxStateChangeConfigCalls(0)
 {
 }
 void StateMgr::Init
@@ -56,9 +73,8 @@ void StateMgr::Init
     m_mech = mech;
     if (mech != nullptr)
     {
-        // Parse the configuration file 
-        auto stateXML = make_unique<StateDataXmlParser>();
-        vector<MechanismTargetData*> targetData = stateXML.get()->ParseXML(mech->GetType());
+        // the configuration file is parsed the first time any state manager uses it
+        auto& targetData = StateDataCache::GetStateDataCache()->GetTargetData(mech->GetControlFileName());
 
         if (targetData.empty())
         {
@@ -68,6 +84,7 @@ void StateMgr::Init
         {
             // initialize the xml string to state map
             m_stateVector.resize(stateMap.size(), nullptr);
+            m_stateTargetData.resize(stateMap.size(), nullptr);
             // create the states passing the configuration data
             auto stateId=0;
             for ( auto td: targetData )
@@ -84,13 +101,7 @@ void StateMgr::Init
                         auto thisState = StateMgrHelper::CreateState(mech, struc, td);
                 	    if (thisState != nullptr)
                 	    {
-                    	    m_stateVector[slot] = thisState;
-                            if (struc.isDefault)
-                            {
-                        	    m_currentState = thisState;
-                        	    m_currentStateID = slot;
-                        	    m_currentState->Init();
-                    	    }
+                            AddState(mech, slot, thisState, td, struc.isDefault);
                 	    }
             	    }
             	    else
@@ -108,6 +119,55 @@ void StateMgr::Init
     }
 }
 
+/// @brief  Put a state in the state vector.  The default state becomes the current state and is initialized.
+/// @param [in]     Mech* mech - mechanism the state belongs to
+/// @param [in]     int slot - state id
+/// @param [in]     State* state - the state
+/// @param [in]     const MechanismTargetData* targetData - state data the state was created from (may be nullptr)
+/// @param [in]     bool isDefault - true if this is the default state
+/// @return void
+void StateMgr::AddState
+(
+    Mech*                                   mech,
+    int                                     slot,
+    State*                                  state,
+    const MechanismTargetData*              targetData,
+    bool                                    isDefault
+)
+{
+    m_mech = mech;
+    if ( slot >= static_cast<int>(m_stateVector.size()) )
+    {
+        m_stateVector.resize(slot+1, nullptr);
+        m_stateTargetData.resize(slot+1, nullptr);
+    }
+    m_stateVector[slot] = state;
+    m_stateTargetData[slot] = targetData;
+    if ( isDefault )
+    {
+        m_currentState = state;
+        m_currentStateID = slot;
+        m_currentState->Init();
+    }
+}
+
+/// @brief  Copy the (tuned) targets from the state data into the states and re-initialize the current state
+/// @return void
+void StateMgr::ReloadTargets()
+{
+    for ( unsigned int slot=0; slot<m_stateVector.size(); ++slot )
+    {
+        if ( m_stateVector[slot] != nullptr )
+        {
+            m_stateVector[slot]->UpdateTargets( m_stateTargetData[slot] );
+        }
+    }
+    if ( m_currentState != nullptr )
+    {
+        m_currentState->Init();
+    }
+}
+
 /// @brief  run the current state
 /// @return void
 void StateMgr::RunCurrentState()
@@ -132,6 +192,94 @@ void StateMgr::CheckForStateTransition()
     {
         CheckForGamepadTransitions();
     }
+    if (m_numTransitions > 0)
+    {
+        CheckTransitionTable();
+    }
+}
+
+void StateMgr::SetTransitionTable
+(
+    const StateTransition*      transitions,
+    size_t                      numTransitions
+)
+{
+    m_transitions = transitions;
+    m_numTransitions = transitions != nullptr ? numTransitions : 0;
+
+    // read each input once per loop no matter how many rows use it
+    m_transitionInputs.clear();
+    for (size_t inx=0; inx<m_numTransitions; ++inx)
+    {
+        auto& row = m_transitions[inx];
+        auto found = false;
+        for (auto& input : m_transitionInputs)
+        {
+            found = found || (input.type == row.inputType && input.input == row.input);
+        }
+        if (!found)
+        {
+            m_transitionInputs.emplace_back(TransitionInput{row.inputType, row.input, false});
+        }
+    }
+}
+
+bool StateMgr::IsSensorActive
+(
+    int         sensor
+) const
+{
+    // override this method if the transition table uses sensors
+    return false;
+}
+
+void StateMgr::CheckTransitionTable()
+{
+    auto start = frc::Timer::GetFPGATimestamp();
+    auto controller = m_checkGamePadTransitions ? TeleopControl::GetInstance() : nullptr;
+
+    for (auto& input : m_transitionInputs)
+    {
+        auto isActive = input.isActive;
+        if (input.type == StateTransition::INPUT_TYPE::SENSOR)
+        {
+            isActive = IsSensorActive(input.input);
+        }
+        else if (controller != nullptr)
+        {
+            isActive = controller->IsButtonPressed(static_cast<TeleopControl::FUNCTION_IDENTIFIER>(input.input));
+        }
+
+        if (isActive != input.isActive)
+        {
+            input.isActive = isActive;
+            m_tableEdges++;
+
+            auto edge = isActive ? StateTransition::EDGE::RISING : StateTransition::EDGE::FALLING;
+            for (size_t inx=0; inx<m_numTransitions; ++inx)
+            {
+                auto& row = m_transitions[inx];
+                if ((row.fromState == StateTransition::ANY_STATE || row.fromState == m_currentStateID) &&
+                    row.inputType == input.type && row.input == input.input && row.edge == edge)
+                {
+                    if (row.toState != m_currentStateID)
+                    {
+                        // RunCurrentState runs the new state right after this
+                        SetCurrentState(row.toState, false);
+                        m_tableTransitions++;
+                        auto latency = frc::Timer::GetFPGATimestamp() - start;
+                        m_maxTransitionLatency = latency > m_maxTransitionLatency ? latency : m_maxTransitionLatency;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    auto elapsed = frc::Timer::GetFPGATimestamp() - start;
+    m_tableChecks++;
+    m_tableTime += elapsed;
+    m_maxTableTime = elapsed > m_maxTableTime ? elapsed : m_maxTableTime;
 }
 
 void StateMgr::CheckForSensorTransitions()
@@ -170,9 +318,18 @@ void StateMgr::SetCurrentState
             }
 
             // Transition to the new state
+            auto adapters = DragonControlToCTREAdapter::GetNumCreated();
+            auto configCalls = DragonControlToCTREAdapter::GetNumConfigCalls();
             m_currentState = state;
             m_currentStateID = stateID;       
             m_currentState->Init();
+
+            // the controllers are set up when the states are created, so these should stay at zero
+            configCalls = DragonControlToCTREAdapter::GetNumConfigCalls() - configCalls;
+            m_stateChanges++;
+            m_stateChangeAdapters += DragonControlToCTREAdapter::GetNumCreated() - adapters;
+            m_stateChangeConfigCalls += configCalls;
+            m_maxStateChangeConfigCalls = configCalls > m_maxStateChangeConfigCalls ? configCalls : m_maxStateChangeConfigCalls;
             
             // Run current new state if requested
             if ( run )
@@ -195,6 +352,21 @@ int StateMgr::GetCurrentStateParam
     return -1;
 }
 
+int StateMgr::GetStateID
+(
+    const string&   stateName
+) const
+{
+    for (unsigned int inx=0; inx<m_stateVector.size(); ++inx)
+    {
+        if (m_stateVector[inx] != nullptr && m_stateVector[inx]->GetStateName() == stateName)
+        {
+            return static_cast<int>(inx);
+        }
+    }
+    return -1;
+}
+
 void StateMgr::LogInformation() const
 {
     if (m_mech != nullptr)
@@ -205,6 +377,21 @@ void StateMgr::LogInformation() const
             Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_mech->GetNetworkTableName(), string("current state"), m_currentState->GetStateName());
             Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_mech->GetNetworkTableName(), string("current state id"), m_currentState->GetStateId());
         }
+        if (m_tableChecks > 0)
+        {
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_mech->GetNetworkTableName(), string("transition table avg (us)"), units::time::microsecond_t(m_tableTime / m_tableChecks).to<double>());
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_mech->GetNetworkTableName(), string("transition table max (us)"), units::time::microsecond_t(m_maxTableTime).to<double>());
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_mech->GetNetworkTableName(), string("transition table edges"), m_tableEdges);
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_mech->GetNetworkTableName(), string("transition table transitions"), m_tableTransitions);
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_mech->GetNetworkTableName(), string("transition latency max (us)"), units::time::microsecond_t(m_maxTransitionLatency).to<double>());
+        }
+        if (m_stateChanges > 0)
+        {
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_mech->GetNetworkTableName(), string("state changes"), m_stateChanges);
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_mech->GetNetworkTableName(), string("state change adapters created"), m_stateChangeAdapters);
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_mech->GetNetworkTableName(), string("state change config calls"), m_stateChangeConfigCalls);
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, m_mech->GetNetworkTableName(), string("state change config calls max"), m_maxStateChangeConfigCalls);
+        }
         auto index = 0;
         for (auto state : m_stateVector)
         {
@@ -17,16 +17,23 @@
 #pragma once
 
 // C++ Includes
+#include <cstddef>
 #include <map>
+#include <string>
 #include <vector>
 
+// FRC includes
+#include <units/time.h>
+
 // Team 302 includes
 #include <State.h>
 #include <mechanisms/StateStruc.h>
+#include <mechanisms/base/StateTransition.h>
 #include <LoggableItem.h>
 
 // forward declare 
 class Mech;
+class MechanismTargetData;
 class PrimitiveParams;
 
 // Third Party Includes
@@ -65,6 +72,14 @@ class StateMgr : public LoggableItem
             PrimitiveParams*    currentParams
         );
 
+        /// @brief  Find a state by the name used in the mechanism's state xml file
+        /// @param [in]     const std::string& stateName - state name
+        /// @returns int state id - -1 indicates that this mechanism doesn't have the state
+        int GetStateID
+        (
+            const std::string&  stateName
+        ) const;
+
         /// @brief  return the current state
         /// @return int - the current state
         inline int GetCurrentState() const { return m_currentStateID; };
@@ -74,20 +89,89 @@ class StateMgr : public LoggableItem
 
         void SetAreGamepadTransitionsChecked(bool checkGamepadTransitions) {m_checkGamePadTransitions = checkGamepadTransitions;}
 
+        /// @brief  Copy the (tuned) targets from the state data into the states and re-initialize the current state
+        /// @return void
+        void ReloadTargets();
+
 
     protected:
+        /// @brief  Put a state in the state vector.  Init does this for the states in the state data; a state
+        ///         manager can also add states it created itself.  The default state becomes the current state.
+        /// @param [in]     Mech* mech - mechanism the state belongs to
+        /// @param [in]     int slot - state id
+        /// @param [in]     State* state - the state
+        /// @param [in]     const MechanismTargetData* targetData - state data the state was created from (may be nullptr)
+        /// @param [in]     bool isDefault - true if this is the default state
+        /// @return void
+        void AddState
+        (
+            Mech*                                   mech,
+            int                                     slot,
+            State*                                  state,
+            const MechanismTargetData*              targetData,
+            bool                                    isDefault
+        );
+
         virtual void CheckForStateTransition();
         virtual void CheckForSensorTransitions();
         virtual void CheckForGamepadTransitions();
 
+        /// @brief  Use a transition table for this mechanism.  The table is only evaluated for an input when its
+        ///         value changes, so the state manager doesn't need to hand code the transitions.
+        /// @param [in]     const StateTransition* transitions - table rows (must outlive the state manager, e.g. static constexpr)
+        /// @param [in]     size_t numTransitions - number of rows
+        /// @return void
+        void SetTransitionTable
+        (
+            const StateTransition*      transitions,
+            size_t                      numTransitions
+        );
+
+        /// @brief  read a sensor used in the transition table
+        /// @param [in]     int sensor - sensor id from the table
+        /// @return bool - true if the sensor is active
+        virtual bool IsSensorActive
+        (
+            int         sensor
+        ) const;
+
     private:
+        /// @brief  check the transition table inputs for edges and make the transition for the first matching row
+        void CheckTransitionTable();
+
+        struct TransitionInput
+        {
+            StateTransition::INPUT_TYPE     type;
+            int                             input;
+            bool                            isActive;   // value the last time it was read
+        };
+
 
         Mech*                   m_mech;
         State*                  m_currentState;
         std::vector<State*>     m_stateVector;
+        std::vector<const MechanismTargetData*> m_stateTargetData;     // state data each state was created from
         int                     m_currentStateID;
         bool                    m_checkGamePadTransitions;
 
+        const StateTransition*          m_transitions;
+        size_t                          m_numTransitions;
+        std::vector<TransitionInput>    m_transitionInputs;     // each input in the table once
+
+        // transition table cost:  checks is the number of loops, edges the number of input changes that were evaluated
+        int                             m_tableChecks;
+        int                             m_tableEdges;
+        int                             m_tableTransitions;
+        units::time::second_t           m_tableTime;
+        units::time::second_t           m_maxTableTime;
+        units::time::second_t           m_maxTransitionLatency; // from reading the edge until the new state is initialized
+
+        // state entry cost:  motor controller adapters created and configuration calls sent while initializing new states
+        int                             m_stateChanges;
+        int                             m_stateChangeAdapters;
+        int                             m_stateChangeConfigCalls;
+        int                             m_maxStateChangeConfigCalls;
+
 };
 
 
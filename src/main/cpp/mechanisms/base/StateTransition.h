@@ -0,0 +1,46 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+/// @struct StateTransition
+/// @brief  One row of a state manager's transition table:  when the input has the edge while the mechanism is in
+///         fromState, go to toState.  Rows are plain values so a mechanism can declare its table constexpr, e.g.
+///         static constexpr std::array<StateTransition, 2> m_transitions{{ {...}, {...} }};
+///         The first matching row wins.
+struct StateTransition
+{
+    enum INPUT_TYPE
+    {
+        BUTTON,     ///< input is a TeleopControl::FUNCTION_IDENTIFIER
+        SENSOR      ///< input is an id the state manager reads in IsSensorActive
+    };
+
+    enum EDGE
+    {
+        RISING,     ///< button pressed / sensor became active
+        FALLING     ///< button released / sensor became inactive
+    };
+
+    static constexpr int ANY_STATE = -1;
+
+    int             fromState;      ///< state id or ANY_STATE
+    INPUT_TYPE      inputType;
+    int             input;
+    EDGE            edge;
+    int             toState;
+};
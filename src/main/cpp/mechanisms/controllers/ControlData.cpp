@@ -65,3 +65,52 @@ ControlData::ControlData
 {
 
 }
+
+bool ControlData::HasSameConstants
+(
+    const ControlData&  other
+) const
+{
+    return m_mode == other.m_mode &&
+           m_runLoc == other.m_runLoc &&
+           m_proportional == other.m_proportional &&
+           m_integral == other.m_integral &&
+           m_derivative == other.m_derivative &&
+           m_feedforward == other.m_feedforward &&
+           m_iZone == other.m_iZone &&
+           m_maxAcceleration == other.m_maxAcceleration &&
+           m_cruiseVelocity == other.m_cruiseVelocity &&
+           m_peakValue == other.m_peakValue &&
+           m_nominalValue == other.m_nominalValue;
+}
+
+int ControlData::UpdateConstants
+(
+    const ControlData&  other
+)
+{
+    if ( m_mode != other.m_mode || m_runLoc != other.m_runLoc )
+    {
+        return CONSTANT_CHANGES::MODE_CHANGED;
+    }
+
+    auto changes = static_cast<int>(CONSTANT_CHANGES::NO_CHANGES);
+    changes |= m_proportional != other.m_proportional ? CONSTANT_CHANGES::KP_CHANGED : 0;
+    changes |= m_integral != other.m_integral ? CONSTANT_CHANGES::KI_CHANGED : 0;
+    changes |= m_derivative != other.m_derivative ? CONSTANT_CHANGES::KD_CHANGED : 0;
+    changes |= m_feedforward != other.m_feedforward ? CONSTANT_CHANGES::KF_CHANGED : 0;
+    changes |= m_iZone != other.m_iZone ? CONSTANT_CHANGES::IZONE_CHANGED : 0;
+    changes |= ( m_peakValue != other.m_peakValue || m_nominalValue != other.m_nominalValue ) ? CONSTANT_CHANGES::PEAK_NOMINAL_CHANGED : 0;
+    changes |= ( m_maxAcceleration != other.m_maxAcceleration || m_cruiseVelocity != other.m_cruiseVelocity ) ? CONSTANT_CHANGES::MOTION_CHANGED : 0;
+
+    m_proportional = other.m_proportional;
+    m_integral = other.m_integral;
+    m_derivative = other.m_derivative;
+    m_feedforward = other.m_feedforward;
+    m_iZone = other.m_iZone;
+    m_maxAcceleration = other.m_maxAcceleration;
+    m_cruiseVelocity = other.m_cruiseVelocity;
+    m_peakValue = other.m_peakValue;
+    m_nominalValue = other.m_nominalValue;
+    return changes;
+}
@@ -22,6 +22,20 @@
 class ControlData
 {
     public:
+        /// @brief  bits returned by UpdateConstants for the constants that changed
+        enum CONSTANT_CHANGES
+        {
+            NO_CHANGES              = 0x00,
+            KP_CHANGED              = 0x01,
+            KI_CHANGED              = 0x02,
+            KD_CHANGED              = 0x04,
+            KF_CHANGED              = 0x08,
+            IZONE_CHANGED           = 0x10,
+            PEAK_NOMINAL_CHANGED    = 0x20,
+            MOTION_CHANGED          = 0x40,     ///< max acceleration or cruise velocity
+            MODE_CHANGED            = 0x80      ///< mode or run location; these can't be changed in place
+        };
+
         /// @brief default constructor will create a basic percent output control data.
         ControlData();
 
@@ -105,6 +119,23 @@ class ControlData
         /// @return double - nominal value
         inline double GetNominalValue() const { return m_nominalValue; };
 
+        /// @brief  Check if another control data has the same mode, run location and constants (the identifier isn't compared)
+        /// @param [in] const ControlData& other - control data to compare to
+        /// @return bool - true if they control the same way
+        bool HasSameConstants
+        (
+            const ControlData&  other
+        ) const;
+
+        /// @brief  Copy the gains and limits from another control data (used for tuning while the robot runs).  The
+        ///         object keeps its identity so everything holding a pointer to it sees the new values.
+        /// @param [in] const ControlData& other - control data with the new constants
+        /// @return int - CONSTANT_CHANGES bits; if MODE_CHANGED is set nothing was copied
+        int UpdateConstants
+        (
+            const ControlData&  other
+        );
+
  
     private:
 
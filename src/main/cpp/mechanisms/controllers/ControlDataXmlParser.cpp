@@ -16,7 +16,6 @@
 //====================================================================================================================================================
 
 // C++ Includes
-#include <cstring>
 #include <map>
 #include <string>
 
@@ -26,6 +25,7 @@
 #include <mechanisms/controllers/ControlData.h>
 #include <mechanisms/controllers/ControlModes.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 #include <mechanisms/controllers/ControlDataXmlParser.h>
 
 // Third Party Includes
@@ -62,6 +62,7 @@ ControlData* ControlDataXmlParser::ParseXML
 
 	map<string, ControlModes::CONTROL_TYPE> modeMap;
 	modeMap[string("PERCENT_OUTPUT")] = ControlModes::CONTROL_TYPE::PERCENT_OUTPUT;
+	modeMap[string("POSITION_INCH")]  = ControlModes::CONTROL_TYPE::POSITION_INCH;
 	modeMap[string("VELOCITY_INCH")]  = ControlModes::CONTROL_TYPE::VELOCITY_INCH;
 	modeMap[string("VELOCITY_DEGREES")] = ControlModes::CONTROL_TYPE::VELOCITY_DEGREES;
 	modeMap[string("VELOCITY_RPS")]  = ControlModes::CONTROL_TYPE::VELOCITY_RPS;
@@ -83,68 +84,76 @@ ControlData* ControlDataXmlParser::ParseXML
     // parse/validate xml
     for (pugi::xml_attribute attr = PIDNode.first_attribute(); attr; attr = attr.next_attribute())
     {
-        if ( strcmp( attr.name(), "identifier") == 0 )
+        switch ( XmlName::Hash( attr.name() ) )
         {
-            identifier = string( attr.value() );
-        }
-        else if ( strcmp( attr.name(), "mode" ) == 0 )
-        {
-			auto it = modeMap.find( string(attr.value() ) );
-			if ( it != modeMap.end() )
-			{
-				mode = it->second;
-			}
-        }
-		else if ( strcmp( attr.name(), "constrolServer" ) == 0 )
-		{
-			auto itr = serverMap.find( string( attr.value() ) );
-			if ( itr != serverMap.end() )
-			{
-				server = itr->second;
-			}
-		}				
-        else if ( strcmp( attr.name(), "proportional") == 0 )
-        {
-            p = attr.as_double();
-        }       
-        else if ( strcmp( attr.name(), "integral") == 0 )
-        {
-            i = attr.as_double();
-        }        
-        else if ( strcmp( attr.name(), "derivative") == 0 )
-        {
-            d = attr.as_double();
-        }        
-        else if ( strcmp( attr.name(), "feedforward") == 0 )
-        {
-            f = attr.as_double();
-        }        
-        else if ( strcmp( attr.name(), "izone") == 0 )
-        {
-            izone = attr.as_double();
-        }
-        else if ( strcmp( attr.name(), "maxacceleration") == 0 )
-        {
-            maxAccel = attr.as_double();
-        }
-        else if ( strcmp( attr.name(), "cruisevelocity") == 0 )
-        {
-            cruiseVel = attr.as_double();
-        }
-        else if ( strcmp( attr.name(), "peak") == 0 )
-        {
-            peak = attr.as_double();
-        }
-        else if ( strcmp( attr.name(), "nominal") == 0 )
-        {
-            nominal = attr.as_double();
-        }
-        else
-        {
-            string msg = string("invalid attribute ");
-            msg += attr.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ControlDataXmlParser"), string("ParseXML"), msg );
-            hasError = true;
+            case XmlName::Hash( "identifier" ):
+                identifier = string( attr.value() );
+                break;
+
+            case XmlName::Hash( "mode" ):
+            {
+                auto it = modeMap.find( string(attr.value() ) );
+                if ( it != modeMap.end() )
+                {
+                    mode = it->second;
+                }
+                break;
+            }
+
+            case XmlName::Hash( "constrolServer" ):
+            {
+                auto itr = serverMap.find( string( attr.value() ) );
+                if ( itr != serverMap.end() )
+                {
+                    server = itr->second;
+                }
+                break;
+            }
+
+            case XmlName::Hash( "proportional" ):
+                p = attr.as_double();
+                break;
+
+            case XmlName::Hash( "integral" ):
+                i = attr.as_double();
+                break;
+
+            case XmlName::Hash( "derivative" ):
+                d = attr.as_double();
+                break;
+
+            case XmlName::Hash( "feedforward" ):
+                f = attr.as_double();
+                break;
+
+            case XmlName::Hash( "izone" ):
+                izone = attr.as_double();
+                break;
+
+            case XmlName::Hash( "maxacceleration" ):
+                maxAccel = attr.as_double();
+                break;
+
+            case XmlName::Hash( "cruisevelocity" ):
+                cruiseVel = attr.as_double();
+                break;
+
+            case XmlName::Hash( "peak" ):
+                peak = attr.as_double();
+                break;
+
+            case XmlName::Hash( "nominal" ):
+                nominal = attr.as_double();
+                break;
+
+            default:
+            {
+                string msg = string("invalid attribute ");
+                msg += attr.name();
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("ControlDataXmlParser"), string("ParseXML"), msg );
+                hasError = true;
+                break;
+            }
         }
     }
     if ( !hasError )
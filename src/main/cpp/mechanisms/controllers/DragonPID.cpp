@@ -13,36 +13,56 @@
 // OR OTHER DEALINGS IN THE SOFTWARE.
 //====================================================================================================================================================
 
-#include <frc/Timer.h>
+// C++ Includes
+#include <algorithm>
+#include <limits>
 
+// Team 302 includes
 #include <mechanisms/controllers/ControlData.h>
 #include <mechanisms/controllers/DragonPID.h>
+#include <mechanisms/controllers/DragonPIDLoop.h>
 
 DragonPID::DragonPID
 (
-    ControlData*        controlData
-) : m_kP(controlData->GetP()),
-    m_kI(controlData->GetI()),
-    m_kD(controlData->GetD()),
-    m_kF(controlData->GetF()),
-    m_accumError(0.0),
-    m_prevError(0.0),
-    m_timer(new frc::Timer())
+    ControlData*            controlData,
+    units::time::second_t   period
+) : m_loop(period),
+    m_kF(0.0),
+    m_peak(0.0)
 {
-    m_timer->Start();
+    UpdateGains(controlData);
+}
+
+void DragonPID::UpdateGains
+(
+    const ControlData*      controlData
+)
+{
+    m_kF = controlData->GetF();
+    m_peak = controlData->GetPeakValue();
+
+    auto& gains = m_loop.GetGains();
+    gains.kP = controlData->GetP();
+    gains.kI = controlData->GetI();
+    gains.kD = controlData->GetD();
+    gains.iZone = controlData->GetIZone();
+    auto limit = m_peak > 0.0 ? m_peak : std::numeric_limits<double>::infinity();
+    gains.iLimit = limit;
+    gains.minOutput = -limit;
+    gains.maxOutput = limit;
 }
 
 void DragonPID::UpdateKP(double kP)
 {
-    m_kP = kP;
+    m_loop.GetGains().kP = kP;
 }
 void DragonPID::UpdateKI(double kI)
 {
-    m_kI = kI;
+    m_loop.GetGains().kI = kI;
 }
 void DragonPID::UpdateKD(double kD)
 {
-    m_kD = kD;
+    m_loop.GetGains().kD = kD;
 }
 void DragonPID::UpdateKF(double kF)
 {
@@ -56,12 +76,29 @@ double DragonPID::Calculate
     double targetVal
 )
 {
-    auto error = targetVal - currentVal;
-    m_accumError += error;
-    auto deltaT = m_timer->Get().to<double>();
-    m_timer->Reset();
-    auto deltaErr = error - m_prevError;
-    m_prevError = error;
+    return Limit(motorOutput + m_loop.Calculate(currentVal, targetVal) + m_kF);
+}
 
-    return motorOutput + m_kP*error + m_kI*m_accumError + m_kD*deltaErr/deltaT + m_kF;
-}
\ No newline at end of file
+double DragonPID::Calculate
+(
+    double                  motorOutput,
+    double                  currentVal,
+    double                  targetVal,
+    units::time::second_t   dt
+)
+{
+    return Limit(motorOutput + m_loop.Calculate(currentVal, targetVal, dt) + m_kF);
+}
+
+void DragonPID::Reset()
+{
+    m_loop.Reset();
+}
+
+double DragonPID::Limit
+(
+    double  output
+) const
+{
+    return m_peak > 0.0 ? std::clamp(output, -m_peak, m_peak) : output;
+}
@@ -15,17 +15,23 @@
 
 #pragma once
 
-#include <frc/Timer.h>
+// FRC includes
+#include <units/time.h>
 
+// Team 302 includes
 #include <mechanisms/controllers/ControlData.h>
+#include <mechanisms/controllers/DragonPIDLoop.h>
 
-
+/// @class DragonPID
+/// @brief RoboRIO side PID for a ControlData.  The gains come from the control data (I and D are per second),
+///        the integral is limited to the izone and the output to +/- the peak value.
 class DragonPID
 {
     public:
         DragonPID
         (
-            ControlData*                    controlData
+            ControlData*                    controlData,
+            units::time::second_t           period = units::time::second_t(0.02)
         );
 
         DragonPID() = delete;
@@ -36,6 +42,17 @@ class DragonPID
         void UpdateKD(double kD);
         void UpdateKF(double kF);
 
+        /// @brief  reload all of the gains and limits from the control data (doesn't allocate)
+        void UpdateGains
+        (
+            const ControlData*              controlData
+        );
+
+        /// @brief  step the loop with the fixed period
+        /// @param [in] double  motorOutput:    output the PID correction is added to
+        /// @param [in] double  currentVal:     measured value
+        /// @param [in] double  targetVal:      target value
+        /// @return double  motorOutput plus the correction (limited to the peak value)
         double Calculate
         (
             double motorOutput,
@@ -43,12 +60,25 @@ class DragonPID
             double targetVal
         );
 
+        /// @brief  step the loop with a measured period
+        double Calculate
+        (
+            double                  motorOutput,
+            double                  currentVal,
+            double                  targetVal,
+            units::time::second_t   dt
+        );
+
+        /// @brief clear the integral and derivative history
+        void Reset();
+
     private:
-        double                              m_kP;
-        double                              m_kI;
-        double                              m_kD;
+        double Limit
+        (
+            double  output
+        ) const;
+
+        DragonPIDLoop<DragonPIDGains>       m_loop;
         double                              m_kF;
-        double                              m_accumError;
-        double                              m_prevError;
-        frc::Timer*                         m_timer;
-};
\ No newline at end of file
+        double                              m_peak;
+};
@@ -0,0 +1,221 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+// FRC includes
+#include <units/time.h>
+
+/// @struct DragonPIDGains
+/// @brief  PID gains and limits that can be changed at run time.  The gains are per second (like frc2::PIDController)
+///         so they don't change when the loop period does.
+struct DragonPIDGains
+{
+    double  kP = 0.0;
+    double  kI = 0.0;
+    double  kD = 0.0;
+    double  kF = 0.0;                                               ///< multiplied by the setpoint
+    double  iZone = 0.0;                                            ///< only integrate while |error| < iZone (0 means always)
+    double  iLimit = std::numeric_limits<double>::infinity();       ///< largest magnitude of the integral term (output units)
+    double  minOutput = -std::numeric_limits<double>::infinity();
+    double  maxOutput = std::numeric_limits<double>::infinity();
+    double  dFilterTime = 0.0;                                      ///< derivative low pass time constant in seconds (0 means no filter)
+};
+
+/// @struct DragonPIDConstGains
+/// @brief  Base for gains that are known at compile time.  Derive from it and hide the members that change, e.g.
+///             struct ShooterGains : DragonPIDConstGains { static constexpr double kP = 0.2; };
+///         DragonPIDLoop<ShooterGains> then has the gains folded into the calculation.
+struct DragonPIDConstGains
+{
+    static constexpr double kP = 0.0;
+    static constexpr double kI = 0.0;
+    static constexpr double kD = 0.0;
+    static constexpr double kF = 0.0;
+    static constexpr double iZone = 0.0;
+    static constexpr double iLimit = std::numeric_limits<double>::infinity();
+    static constexpr double minOutput = -std::numeric_limits<double>::infinity();
+    static constexpr double maxOutput = std::numeric_limits<double>::infinity();
+    static constexpr double dFilterTime = 0.0;
+};
+
+/// @struct DragonPIDState
+/// @brief  What one loop remembers between steps
+struct DragonPIDState
+{
+    double  integral = 0.0;         ///< integral term in output units (already multiplied by kI)
+    double  prevMeasurement = 0.0;
+    double  derivative = 0.0;       ///< filtered rate of change of the measurement
+    bool    hasPrevious = false;    ///< false until the first step, so that step has no derivative kick
+};
+
+/// @brief  One step of a PID loop
+///             - derivative on measurement (setpoint changes don't kick the output) with an optional low pass filter
+///             - integral limited to iZone/iLimit and not accumulated while the output is saturated in the same direction
+///             - output limited to [minOutput, maxOutput]
+/// @param [in]     const GAINS&    gains:          DragonPIDGains or a DragonPIDConstGains derived struct
+/// @param [in/out] DragonPIDState& state:          loop state
+/// @param [in]     double          measurement:    current value
+/// @param [in]     double          setpoint:       target value
+/// @param [in]     double          dt:             seconds since the previous step (must be > 0)
+/// @return double  output
+template <typename GAINS>
+inline double DragonPIDStep
+(
+    const GAINS&        gains,
+    DragonPIDState&     state,
+    double              measurement,
+    double              setpoint,
+    double              dt
+)
+{
+    auto error = setpoint - measurement;
+
+    if (state.hasPrevious)
+    {
+        auto rate = (measurement - state.prevMeasurement) / dt;
+        auto alpha = gains.dFilterTime > 0.0 ? gains.dFilterTime / (gains.dFilterTime + dt) : 0.0;
+        state.derivative = alpha*state.derivative + (1.0-alpha)*rate;
+    }
+    state.prevMeasurement = measurement;
+    state.hasPrevious = true;
+
+    auto output = gains.kF*setpoint + gains.kP*error - gains.kD*state.derivative;
+
+    if (gains.kI != 0.0)
+    {
+        if (gains.iZone > 0.0 && std::abs(error) >= gains.iZone)
+        {
+            state.integral = 0.0;
+        }
+        else
+        {
+            auto integral = std::clamp(state.integral + gains.kI*error*dt, -gains.iLimit, gains.iLimit);
+            auto windingUp = (output + integral > gains.maxOutput && error > 0.0) || 
+                             (output + integral < gains.minOutput && error < 0.0);
+            state.integral = windingUp ? state.integral : integral;
+        }
+    }
+
+    return std::clamp(output + state.integral, gains.minOutput, gains.maxOutput);
+}
+
+/// @class DragonPIDLoop
+/// @brief Allocation free PID loop.  Calculate(measurement, setpoint) steps with the fixed loop period;
+///        Calculate(measurement, setpoint, dt) uses a measured period, falling back to the fixed one when the
+///        measured value isn't usable (first call, timer reset, a long pause).
+template <typename GAINS = DragonPIDGains>
+class DragonPIDLoop
+{
+    public:
+        explicit DragonPIDLoop
+        (
+            units::time::second_t   period = units::time::second_t(0.02),
+            const GAINS&            gains = GAINS{}
+        ) : m_gains(gains),
+            m_state(),
+            m_period(period.to<double>())
+        {
+        }
+        ~DragonPIDLoop() = default;
+
+        double Calculate
+        (
+            double                  measurement,
+            double                  setpoint
+        )
+        {
+            return DragonPIDStep(m_gains, m_state, measurement, setpoint, m_period);
+        }
+
+        double Calculate
+        (
+            double                  measurement,
+            double                  setpoint,
+            units::time::second_t   dt
+        )
+        {
+            auto seconds = dt.to<double>();
+            seconds = (seconds > 0.0 && seconds < m_maxPeriods*m_period) ? seconds : m_period;
+            return DragonPIDStep(m_gains, m_state, measurement, setpoint, seconds);
+        }
+
+        /// @brief clear the integral and derivative history (e.g. when the mechanism is re-enabled)
+        void Reset() { m_state = DragonPIDState{}; }
+
+        GAINS& GetGains() { return m_gains; }
+        const GAINS& GetGains() const { return m_gains; }
+        const DragonPIDState& GetState() const { return m_state; }
+        units::time::second_t GetPeriod() const { return units::time::second_t(m_period); }
+
+    private:
+        static constexpr double     m_maxPeriods = 5.0;
+
+        GAINS                       m_gains;
+        DragonPIDState              m_state;
+        double                      m_period;
+};
+
+/// @class DragonPIDBatch
+/// @brief N loops that share one set of gains and one fixed period (e.g. the steering of each swerve module),
+///        stepped together in one pass over contiguous arrays.
+template <typename GAINS, std::size_t N>
+class DragonPIDBatch
+{
+    public:
+        explicit DragonPIDBatch
+        (
+            units::time::second_t   period = units::time::second_t(0.02),
+            const GAINS&            gains = GAINS{}
+        ) : m_gains(gains),
+            m_states(),
+            m_period(period.to<double>())
+        {
+        }
+        ~DragonPIDBatch() = default;
+
+        void Calculate
+        (
+            const std::array<double, N>&    measurements,
+            const std::array<double, N>&    setpoints,
+            std::array<double, N>&          outputs
+        )
+        {
+            for (std::size_t inx=0; inx<N; ++inx)
+            {
+                outputs[inx] = DragonPIDStep(m_gains, m_states[inx], measurements[inx], setpoints[inx], m_period);
+            }
+        }
+
+        void Reset() { m_states.fill(DragonPIDState{}); }
+        void Reset(std::size_t inx) { m_states[inx] = DragonPIDState{}; }
+
+        GAINS& GetGains() { return m_gains; }
+        const GAINS& GetGains() const { return m_gains; }
+
+    private:
+        GAINS                                   m_gains;
+        std::array<DragonPIDState, N>           m_states;
+        double                                  m_period;
+};
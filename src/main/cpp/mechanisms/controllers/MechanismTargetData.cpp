@@ -87,3 +87,21 @@ void MechanismTargetData::Update( std::vector<ControlData*> data )
         m_controlData2 = m_controlData;
     }
 }
+
+bool MechanismTargetData::UpdateTargets
+(
+    const MechanismTargetData&  other
+)
+{
+    auto changed = m_target != other.m_target ||
+                   m_secondTarget != other.m_secondTarget ||
+                   m_robotPitch != other.m_robotPitch ||
+                   m_function1Coeff != other.m_function1Coeff ||
+                   m_function2Coeff != other.m_function2Coeff;
+    m_target = other.m_target;
+    m_secondTarget = other.m_secondTarget;
+    m_robotPitch = other.m_robotPitch;
+    m_function1Coeff = other.m_function1Coeff;
+    m_function2Coeff = other.m_function2Coeff;
+    return changed;
+}
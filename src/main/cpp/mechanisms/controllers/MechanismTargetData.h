@@ -98,6 +98,17 @@ class MechanismTargetData
         /// @return void
         void Update( std::vector<ControlData*> data );
 
+        /// @brief replace the controllers (e.g. with a shared copy that has the same constants)
+        /// @param [in] ControlData* - controller
+        /// @param [in] ControlData* - second controller
+        /// @return void
+        void SetControllers( ControlData* controlData, ControlData* controlData2 ) { m_controlData = controlData; m_controlData2 = controlData2; }
+
+        /// @brief copy the targets from another target data for the same state (used for tuning while the robot runs)
+        /// @param [in] const MechanismTargetData& - target data with the new values
+        /// @return bool - true if any of the targets changed
+        bool UpdateTargets( const MechanismTargetData& other );
+
         std::array<double,3> GetFunction1Coeff() const {return m_function1Coeff;}
         std::array<double,3> GetFunction2Coeff() const {return m_function2Coeff;}
 
@@ -24,6 +24,7 @@
 // Team 302 includes
 #include <mechanisms/controllers/MechanismTargetData.h>
 #include <utils/Logger.h>
+#include <utils/XmlName.h>
 #include <mechanisms/controllers/MechanismTargetXmlParser.h>
 
 // Third Party Includes
@@ -66,81 +67,87 @@ MechanismTargetData*  MechanismTargetXmlParser::ParseXML
     // parse/validate xml
     for (xml_attribute attr = MechanismDataNode.first_attribute(); attr; attr = attr.next_attribute())
     {
-        if ( strcmp( attr.name(), "stateIdentifier" ) == 0 )
+        switch ( XmlName::Hash( attr.name() ) )
         {
-            stateName = string( attr.value() );
-        }
-        else if ( strcmp( attr.name(), "controlDataIdentifier" ) == 0 )
-        {
-            controllerIdentifier = string( attr.value() );
-        }
-        else if ( strcmp( attr.name(), "controlDataIdentifier2" ) == 0 )
-        {
-            controllerIdentifier2 = string( attr.value() );
-        }
-        else if ( strcmp( attr.name(), "value") == 0 )
-        {
-            target = attr.as_double();
-        }
-        else if ( strcmp( attr.name(), "secondValue") == 0 )
-        {
-            secondTarget = attr.as_double();
-        }
-        else if ( strcmp( attr.name(), "robotPitch") == 0 )
-        {
-            robotPitch = attr.as_double();
-        }
-        else if ( strcmp( attr.name(), "function1A") == 0 )
-        {
-            function1Coeff[0] = attr.as_double();
-        }
-        else if ( strcmp( attr.name(), "function1B") == 0 )
-        {
-            function1Coeff[1] = attr.as_double();
-        }
-        else if ( strcmp( attr.name(), "function1C") == 0 )
-        {
-            function1Coeff[2] = attr.as_double();
-        }
-        else if ( strcmp( attr.name(), "function2A") == 0 )
-        {
-            function2Coeff[0] = attr.as_double();
-        }
-        else if ( strcmp( attr.name(), "function2B") == 0 )
-        {
-            function2Coeff[1] = attr.as_double();
-        }
-        else if ( strcmp( attr.name(), "function2C") == 0 )
-        {
-            function2Coeff[2] = attr.as_double();
-        }
-        else if( strcmp( attr.name(), "solenoid" ) == 0 )
-        {
-            auto val = attr.value();
-            if(strcmp(val, "ON") == 0)
-            {
-                solenoid = MechanismTargetData::SOLENOID::ON;
-            }
-            else if ( strcmp(val, "REVERSE") == 0)
-            {
-                solenoid = MechanismTargetData::SOLENOID::REVERSE;
-            }
-            else if( strcmp(val, "NONE") == 0)
+            case XmlName::Hash( "stateIdentifier" ):
+                stateName = string( attr.value() );
+                break;
+
+            case XmlName::Hash( "controlDataIdentifier" ):
+                controllerIdentifier = string( attr.value() );
+                break;
+
+            case XmlName::Hash( "controlDataIdentifier2" ):
+                controllerIdentifier2 = string( attr.value() );
+                break;
+
+            case XmlName::Hash( "value" ):
+                target = attr.as_double();
+                break;
+
+            case XmlName::Hash( "secondValue" ):
+                secondTarget = attr.as_double();
+                break;
+
+            case XmlName::Hash( "robotPitch" ):
+                robotPitch = attr.as_double();
+                break;
+
+            case XmlName::Hash( "function1A" ):
+                function1Coeff[0] = attr.as_double();
+                break;
+
+            case XmlName::Hash( "function1B" ):
+                function1Coeff[1] = attr.as_double();
+                break;
+
+            case XmlName::Hash( "function1C" ):
+                function1Coeff[2] = attr.as_double();
+                break;
+
+            case XmlName::Hash( "function2A" ):
+                function2Coeff[0] = attr.as_double();
+                break;
+
+            case XmlName::Hash( "function2B" ):
+                function2Coeff[1] = attr.as_double();
+                break;
+
+            case XmlName::Hash( "function2C" ):
+                function2Coeff[2] = attr.as_double();
+                break;
+
+            case XmlName::Hash( "solenoid" ):
             {
-                solenoid = MechanismTargetData::SOLENOID::NONE;
+                auto val = attr.value();
+                if(strcmp(val, "ON") == 0)
+                {
+                    solenoid = MechanismTargetData::SOLENOID::ON;
+                }
+                else if ( strcmp(val, "REVERSE") == 0)
+                {
+                    solenoid = MechanismTargetData::SOLENOID::REVERSE;
+                }
+                else if( strcmp(val, "NONE") == 0)
+                {
+                    solenoid = MechanismTargetData::SOLENOID::NONE;
+                }
+                else
+                {
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("MechanismTargetXmlParser"), string("ParseXML"), string("solenoid enum"));
+                }
+                break;
             }
-            else
+
+            default:
             {
-                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("MechanismTargetXmlParser"), string("ParseXML"), string("solenoid enum"));
+                string msg = "unknown attribute ";
+                msg += attr.name();
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("MechanismTargetXmlParser"), string("ParseXML"), msg );
+                hasError = true;
+                break;
             }
         }
-        else
-        {
-            string msg = "unknown attribute ";
-            msg += attr.name();
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("MechanismTargetXmlParser"), string("ParseXML"), msg );
-            hasError = true;
-        }
     }
 
     if ( !hasError && !stateName.empty() && !controllerIdentifier.empty() )
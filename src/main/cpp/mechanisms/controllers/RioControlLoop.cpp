@@ -0,0 +1,349 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <thread>
+
+// FRC includes
+#include <frc/DriverStation.h>
+#include <frc/Notifier.h>
+#include <frc/Threads.h>
+#include <frc/Timer.h>
+
+// Team 302 includes
+#include <hw/interfaces/IDragonMotorController.h>
+#include <mechanisms/controllers/ControlData.h>
+#include <mechanisms/controllers/ControlModes.h>
+#include <mechanisms/controllers/DragonPID.h>
+#include <mechanisms/controllers/RioControlLoop.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+#include <ctre/phoenix/motorcontrol/ControlFrame.h>
+#include <ctre/phoenix/motorcontrol/StatusFrame.h>
+#include <ctre/phoenix/motorcontrol/can/WPI_TalonFX.h>
+#include <ctre/phoenix/motorcontrol/can/WPI_TalonSRX.h>
+
+using namespace std;
+
+RioControlLoop* RioControlLoop::m_instance = nullptr;
+RioControlLoop* RioControlLoop::GetRioControlLoop()
+{
+    if ( RioControlLoop::m_instance == nullptr )
+    {
+        RioControlLoop::m_instance = new RioControlLoop();
+    }
+    return RioControlLoop::m_instance;
+}
+
+RioControlLoop::RioControlLoop() : LoggableItem(),
+                                   m_loops(),
+                                   m_numLoops(0),
+                                   m_period(units::time::second_t(0.02)),
+                                   m_notifier(),
+                                   m_priorityRequested(false),
+                                   m_lastCycleStart(0.0),
+                                   m_stats(),
+                                   m_publishedStats()
+{
+}
+
+int RioControlLoop::Register
+(
+    shared_ptr<IDragonMotorController>      motor,
+    ControlData*                            controlData
+)
+{
+    if (motor.get() == nullptr || motor.get()->GetSpeedController().get() == nullptr || controlData == nullptr)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("RioControlLoop"), string("Register"), string("missing motor or control data"));
+        return -1;
+    }
+    if (IsRunning() || m_numLoops >= m_maxLoops)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("RioControlLoop"), string("Register"), string("too many loops or already running"));
+        return -1;
+    }
+
+    auto mode = controlData->GetMode();
+    switch (mode)
+    {
+        case ControlModes::CONTROL_TYPE::POSITION_DEGREES:
+        case ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE:
+        case ControlModes::CONTROL_TYPE::POSITION_INCH:
+        case ControlModes::CONTROL_TYPE::VELOCITY_DEGREES:
+        case ControlModes::CONTROL_TYPE::VELOCITY_INCH:
+        case ControlModes::CONTROL_TYPE::VELOCITY_RPS:
+            break;
+
+        default:
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("RioControlLoop"), controlData->GetIdentifier(), string("control mode can't run on the roborio"));
+            return -1;
+    }
+
+    auto handle = m_numLoops;
+    auto& loop = m_loops[handle];
+    loop.motor = motor;
+    loop.output = motor.get()->GetSpeedController();
+    loop.controlData = controlData;
+    loop.mode = mode;
+    // the period isn't known until Start, so the pid gets created there
+    loop.pid.reset();
+    loop.lastCommand = LoopCommand{0.0, false, 0};
+    loop.command.Write(loop.lastCommand);
+    loop.appliedGains = 0;
+    loop.status.Write(LoopStatus{0.0, 0.0, false});
+    loop.wasEnabled = false;
+    m_numLoops++;
+    return handle;
+}
+
+void RioControlLoop::Start
+(
+    units::time::second_t                   period
+)
+{
+    if (IsRunning() || m_numLoops == 0)
+    {
+        return;
+    }
+
+    m_period = std::clamp(period, m_minPeriod, m_maxPeriod);
+    for (auto inx=0; inx<m_numLoops; ++inx)
+    {
+        m_loops[inx].pid = make_unique<DragonPID>(m_loops[inx].controlData, m_period);
+        SetFramePeriods(m_loops[inx].motor.get(), m_period);
+    }
+
+    m_notifier.emplace([this] { RunLoops(); });
+    m_notifier->SetName("RioControlLoop");
+    m_notifier->StartPeriodic(m_period);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("RioControlLoop"), string("loops"), m_numLoops);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("RioControlLoop"), string("period (ms)"), units::time::millisecond_t(m_period).to<double>());
+}
+
+void RioControlLoop::SetTarget
+(
+    int                                     handle,
+    double                                  target
+)
+{
+    if (handle >= 0 && handle < m_numLoops)
+    {
+        auto& loop = m_loops[handle];
+        loop.lastCommand.target = target;
+        loop.lastCommand.enabled = true;
+        loop.command.Write(loop.lastCommand);
+    }
+}
+
+void RioControlLoop::Disable
+(
+    int                                     handle
+)
+{
+    if (handle >= 0 && handle < m_numLoops)
+    {
+        auto& loop = m_loops[handle];
+        loop.lastCommand.target = 0.0;
+        loop.lastCommand.enabled = false;
+        loop.command.Write(loop.lastCommand);
+
+        if (IsRunning())
+        {
+            // a cycle that read the enabled command before this write can still set the motor, so wait for the
+            // control thread to publish that the loop stopped before the next state takes over the motor
+            auto timeout = frc::Timer::GetFPGATimestamp() + m_period * m_disableWaitPeriods;
+            LoopStatus status{0.0, 0.0, true};
+            loop.status.Read(status);
+            while (status.enabled)
+            {
+                if (frc::Timer::GetFPGATimestamp() > timeout)
+                {
+                    Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("RioControlLoop"), loop.controlData->GetIdentifier(), string("loop didn't stop when it was disabled"));
+                    break;
+                }
+                this_thread::sleep_for(chrono::microseconds(100));
+                loop.status.Read(status);
+            }
+        }
+    }
+}
+
+void RioControlLoop::ReloadGains
+(
+    const ControlData*                      controlData
+)
+{
+    for (auto inx=0; inx<m_numLoops; ++inx)
+    {
+        auto& loop = m_loops[inx];
+        if (loop.controlData == controlData)
+        {
+            // the control data was written before the command, so the control thread sees the new values
+            loop.lastCommand.gainsVersion++;
+            loop.command.Write(loop.lastCommand);
+        }
+    }
+}
+
+RioControlLoop::LoopStatus RioControlLoop::GetStatus
+(
+    int                                     handle
+) const
+{
+    LoopStatus status{0.0, 0.0, false};
+    if (handle >= 0 && handle < m_numLoops)
+    {
+        m_loops[handle].status.Read(status);
+    }
+    return status;
+}
+
+void RioControlLoop::RunLoops()
+{
+    if (!m_priorityRequested)
+    {
+        // the notifier callback thread is a normal thread until it asks to be real time
+        m_stats.realTime = frc::SetCurrentThreadPriority(true, m_threadPriority);
+        m_priorityRequested = true;
+    }
+
+    auto start = frc::Timer::GetFPGATimestamp().to<double>();
+    if (m_stats.cycles > 0)
+    {
+        m_stats.maxPeriod = std::max(m_stats.maxPeriod, start - m_lastCycleStart);
+    }
+    m_lastCycleStart = start;
+
+    // the states set their targets while the robot is disabled (e.g. the default state in RobotInit), so the
+    // loops wait for the robot to be enabled instead of integrating an error they can't do anything about
+    auto robotEnabled = frc::DriverStation::IsEnabled();
+
+    for (auto inx=0; inx<m_numLoops; ++inx)
+    {
+        auto& loop = m_loops[inx];
+        LoopCommand command{0.0, loop.wasEnabled, loop.appliedGains};
+        if (!loop.command.Read(command))
+        {
+            // the main loop kept overwriting the command while it was copied; keep the previous one
+            m_stats.overruns++;
+            continue;
+        }
+
+        if (command.gainsVersion != loop.appliedGains)
+        {
+            loop.pid->UpdateGains(loop.controlData);
+            loop.pid->Reset();
+            loop.appliedGains = command.gainsVersion;
+        }
+
+        auto run = robotEnabled && command.enabled;
+        if (run)
+        {
+            // first cycle after the robot or the command was enabled
+            if (!loop.wasEnabled)
+            {
+                loop.pid->Reset();
+            }
+            auto measurement = Measure(loop.motor.get(), loop.mode);
+            auto output = loop.pid->Calculate(0.0, measurement, command.target);
+            loop.output.get()->Set(output);
+            loop.status.Write(LoopStatus{measurement, output, true});
+        }
+        else if (loop.wasEnabled)
+        {
+            loop.status.Write(LoopStatus{0.0, 0.0, false});
+        }
+        loop.wasEnabled = run;
+    }
+
+    m_stats.cycles++;
+    m_stats.maxRunTime = std::max(m_stats.maxRunTime, frc::Timer::GetFPGATimestamp().to<double>() - start);
+    m_publishedStats.Write(m_stats);
+}
+
+void RioControlLoop::SetFramePeriods
+(
+    IDragonMotorController*                 motor,
+    units::time::second_t                   period
+)
+{
+    ctre::phoenix::motorcontrol::can::BaseTalon* talon = motor->GetTalonFX();
+    if (talon == nullptr)
+    {
+        talon = motor->GetTalonSRX();
+    }
+    if (talon == nullptr)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("RioControlLoop"), string("SetFramePeriods"), string("not a talon; the feedback may be older than the loop period"));
+        return;
+    }
+
+    auto milliseconds = static_cast<int>(lround(units::time::millisecond_t(period).to<double>()));
+    talon->SetStatusFramePeriod(ctre::phoenix::motorcontrol::StatusFrameEnhanced::Status_2_Feedback0, static_cast<uint8_t>(milliseconds), 0);
+    talon->SetControlFramePeriod(ctre::phoenix::motorcontrol::ControlFrame::Control_3_General, milliseconds);
+}
+
+double RioControlLoop::Measure
+(
+    const IDragonMotorController*           motor,
+    ControlModes::CONTROL_TYPE              mode
+)
+{
+    switch (mode)
+    {
+        case ControlModes::CONTROL_TYPE::POSITION_DEGREES:
+        case ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE:
+            return motor->GetRotations() * 360.0;
+
+        case ControlModes::CONTROL_TYPE::POSITION_INCH:
+            return motor->GetCountsPerInch() > 0.0 ? motor->GetCounts() / motor->GetCountsPerInch() : 0.0;
+
+        case ControlModes::CONTROL_TYPE::VELOCITY_DEGREES:
+            return motor->GetRPS() * 360.0;
+
+        case ControlModes::CONTROL_TYPE::VELOCITY_INCH:
+            // GetRPS is after the gear ratio, the counts per inch are motor counts
+            return motor->GetCountsPerInch() > 0.0 ? motor->GetRPS() * motor->GetGearRatio() * motor->GetCountsPerRev() / motor->GetCountsPerInch() : 0.0;
+
+        case ControlModes::CONTROL_TYPE::VELOCITY_RPS:
+            return motor->GetRPS();
+
+        default:
+            return 0.0;
+    }
+}
+
+void RioControlLoop::LogInformation() const
+{
+    if (IsRunning())
+    {
+        TimingStats stats{};
+        m_publishedStats.Read(stats);
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("RioControlLoop"), string("cycles"), static_cast<int>(stats.cycles));
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("RioControlLoop"), string("max period (ms)"), stats.maxPeriod * 1000.0);
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("RioControlLoop"), string("max run time (ms)"), stats.maxRunTime * 1000.0);
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("RioControlLoop"), string("command overruns"), static_cast<int>(stats.overruns));
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("RioControlLoop"), string("real time priority"), stats.realTime);
+    }
+}
@@ -0,0 +1,189 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <atomic>
+#include <memory>
+#include <optional>
+
+// FRC includes
+#include <frc/Notifier.h>
+#include <frc/motorcontrol/MotorController.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <LoggableItem.h>
+#include <mechanisms/controllers/ControlData.h>
+#include <mechanisms/controllers/DragonPID.h>
+#include <utils/DragonDoubleBuffer.h>
+
+class IDragonMotorController;
+
+/// @class RioControlLoop
+/// @brief Runs the controllers for ControlData that says CONTROL_RUN_LOCS::ROBORIO on their own thread (a Notifier)
+///        so they aren't limited to the 20 ms robot loop.  The main loop and the control thread never share
+///        anything but double buffers:  the main loop writes each loop's command (enabled + target) and the control
+///        thread writes back the measurement and output.
+///
+///        A loop only runs while its command is enabled and the robot is enabled.  States set targets while the
+///        robot is disabled, so the pid starts fresh on the first cycle the loop runs after either was off.
+///
+///        Start speeds up the talons' feedback status frame and control frame to the loop period; otherwise the
+///        pid would run on the same 20 ms old measurement most cycles and its output would only reach the motor
+///        at the default control frame rate.
+///
+///        Loops are registered while the states are created (before Start) and live for the rest of the match;
+///        nothing is allocated or locked once the thread is running.
+class RioControlLoop : public LoggableItem
+{
+    public:
+        /// @brief  Find or create the control loop thread
+        static RioControlLoop* GetRioControlLoop();
+
+        /// @brief  Add a controller for the motor.  Must be called before Start.
+        /// @param [in] std::shared_ptr<IDragonMotorController> motor:          motor the output is sent to (as percent output)
+        /// @param [in] ControlData*                            controlData:    gains and control mode (position/velocity)
+        /// @return int     handle for SetTarget/Disable/GetStatus or -1 if the loop can't be added
+        int Register
+        (
+            std::shared_ptr<IDragonMotorController>     motor,
+            ControlData*                                controlData
+        );
+
+        /// @brief  Start running the registered loops
+        /// @param [in] units::time::second_t  period:  control period (limited to 1 ms .. 20 ms)
+        void Start
+        (
+            units::time::second_t                       period
+        );
+
+        /// @brief  Enable a loop and set its target (main loop)
+        void SetTarget
+        (
+            int                                         handle,
+            double                                      target
+        );
+
+        /// @brief  Stop driving the motor from this loop (main loop).  Waits (at most a few periods) until the
+        ///         control thread reports the loop stopped, so a cycle that was already running can't set the
+        ///         motor after the next state's Init.
+        void Disable
+        (
+            int                                         handle
+        );
+
+        /// @brief  Have the loops that use the control data reload their gains after it was updated in place.  The
+        ///         control thread picks the new gains up with the next command (main loop).
+        void ReloadGains
+        (
+            const ControlData*                          controlData
+        );
+
+        struct LoopStatus
+        {
+            double      measurement;    ///< last measurement in the control data units (degrees, inches, ...)
+            double      output;         ///< last percent output sent to the motor
+            bool        enabled;        ///< the control thread ran the loop on its last cycle
+        };
+
+        /// @brief  Latest status the control thread published for a loop (main loop)
+        LoopStatus GetStatus
+        (
+            int                                         handle
+        ) const;
+
+        bool IsRunning() const { return m_notifier.has_value(); }
+        units::time::second_t GetPeriod() const { return m_period; }
+
+        /// @brief  log the thread timing
+        void LogInformation() const override;
+
+    private:
+        RioControlLoop();
+        ~RioControlLoop() = default;
+
+        /// @brief  one control period (control thread)
+        void RunLoops();
+
+        /// @brief  send the motor's feedback and control frames every period so each cycle has a new
+        ///         measurement and its output goes out right away (talons only)
+        static void SetFramePeriods
+        (
+            IDragonMotorController*                     motor,
+            units::time::second_t                       period
+        );
+
+        /// @brief  read the motor in the units of the control mode (control thread)
+        static double Measure
+        (
+            const IDragonMotorController*               motor,
+            ControlModes::CONTROL_TYPE                  mode
+        );
+
+        struct LoopCommand
+        {
+            double      target;
+            bool        enabled;
+            int         gainsVersion;   ///< bumped when the control data was updated
+        };
+
+        struct Loop
+        {
+            std::shared_ptr<IDragonMotorController>     motor;
+            std::shared_ptr<frc::MotorController>       output;         // percent output without going through the motor's adapter
+            ControlData*                                controlData;
+            ControlModes::CONTROL_TYPE                  mode;
+            std::unique_ptr<DragonPID>                  pid;
+            DragonDoubleBuffer<LoopCommand>             command;
+            DragonDoubleBuffer<LoopStatus>              status;
+            LoopCommand                                 lastCommand;    // main loop only
+            int                                         appliedGains;   // control thread only
+            bool                                        wasEnabled;     // control thread only; ran on the last cycle
+        };
+
+        struct TimingStats
+        {
+            unsigned int    cycles;
+            double          maxPeriod;      ///< seconds between the two most spread out cycles
+            double          maxRunTime;     ///< seconds spent running the loops in the slowest cycle
+            unsigned int    overruns;       ///< commands skipped because the main loop was writing them
+            bool            realTime;       ///< the thread got real time priority
+        };
+
+        static constexpr int                                m_maxLoops = 16;
+        static constexpr int                                m_threadPriority = 40;
+        const units::time::second_t                         m_minPeriod = units::time::second_t(0.001);
+        const units::time::second_t                         m_maxPeriod = units::time::second_t(0.02);
+        static constexpr int                                m_disableWaitPeriods = 3;
+
+        std::array<Loop, m_maxLoops>                        m_loops;
+        int                                                 m_numLoops;
+        units::time::second_t                               m_period;
+        std::optional<frc::Notifier>                        m_notifier;
+
+        // control thread only
+        bool                                                m_priorityRequested;
+        double                                              m_lastCycleStart;
+        TimingStats                                         m_stats;
+
+        DragonDoubleBuffer<TimingStats>                     m_publishedStats;
+
+        static RioControlLoop*                              m_instance;
+};
@@ -0,0 +1,318 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// FRC includes
+#include <frc/Filesystem.h>
+
+// Team 302 includes
+#include <hw/ctreadapters/DragonControlToCTREAdapterCache.h>
+#include <mechanisms/controllers/ControlData.h>
+#include <mechanisms/controllers/MechanismTargetData.h>
+#include <mechanisms/controllers/RioControlLoop.h>
+#include <mechanisms/controllers/StateDataCache.h>
+#include <mechanisms/controllers/StateDataXmlParser.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+StateDataCache* StateDataCache::m_instance = nullptr;
+StateDataCache* StateDataCache::GetStateDataCache()
+{
+    if ( StateDataCache::m_instance == nullptr )
+    {
+        StateDataCache::m_instance = new StateDataCache();
+    }
+    return StateDataCache::m_instance;
+}
+
+StateDataCache::StateDataCache() : m_files(),
+                                   m_fileNames(),
+                                   m_nextCheck(0),
+                                   m_numReloads(0),
+                                   m_controlData(),
+                                   m_numParsedControlData(0),
+                                   m_image(),
+                                   m_numImageLoads(0),
+                                   m_numXmlLoads(0)
+{
+    // the compiled image is optional; without it every file is parsed from the XML
+    m_image.Map(GetPath(string("statedata.bin")));
+}
+
+const vector<MechanismTargetData*>& StateDataCache::GetTargetData
+(
+    const string&       controlFileName
+)
+{
+    auto itr = m_files.find(controlFileName);
+    if (itr != m_files.end())
+    {
+        return itr->second.targetData;
+    }
+
+    // parse it once; a file that fails is remembered too so it isn't read again
+    auto& file = m_files[controlFileName];
+    m_fileNames.emplace_back(controlFileName);
+
+    // take the timestamp before parsing so a file written while it is being parsed gets parsed again
+    error_code error;
+    file.modified = filesystem::last_write_time(GetPath(controlFileName), error);
+
+    vector<unique_ptr<ControlData>> parsedControlData;
+    auto loaded = m_image.GetStateData(controlFileName, GetPath(controlFileName), parsedControlData, file.ownedTargetData);
+    if (loaded)
+    {
+        m_numImageLoads++;
+    }
+    else
+    {
+        StateDataXmlParser parser;
+        loaded = parser.ParseXML(controlFileName, parsedControlData, file.ownedTargetData);
+        m_numXmlLoads += loaded ? 1 : 0;
+    }
+
+    if (loaded)
+    {
+        m_numParsedControlData += static_cast<int>(parsedControlData.size());
+        for (auto& td : file.ownedTargetData)
+        {
+            auto controlData = Share(td->GetController(), parsedControlData);
+            auto controlData2 = Share(td->GetController2(), parsedControlData);
+            td->SetControllers(controlData, controlData2);
+            file.targetData.emplace_back(td.get());
+        }
+        // the duplicates that are left in parsedControlData are freed here
+
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataCache"), controlFileName + string(" states"), static_cast<int>(file.targetData.size()));
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataCache"), string("control data parsed"), m_numParsedControlData);
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataCache"), string("control data shared"), GetNumSharedControlData());
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataCache"), string("image loads"), m_numImageLoads);
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataCache"), string("XML loads"), m_numXmlLoads);
+    }
+    else
+    {
+        file.ownedTargetData.clear();
+    }
+    return file.targetData;
+}
+
+ControlData* StateDataCache::Share
+(
+    ControlData*                        controlData,
+    vector<unique_ptr<ControlData>>&    parsed
+)
+{
+    if (controlData == nullptr)
+    {
+        return nullptr;
+    }
+
+    for (auto& shared : m_controlData)
+    {
+        if (shared.get() == controlData || shared->HasSameConstants(*controlData))
+        {
+            return shared.get();
+        }
+    }
+
+    for (auto& owned : parsed)
+    {
+        if (owned.get() == controlData)
+        {
+            m_controlData.emplace_back(move(owned));
+            return controlData;
+        }
+    }
+    return controlData;
+}
+
+bool StateDataCache::CheckNextFile()
+{
+    if (m_fileNames.empty())
+    {
+        return false;
+    }
+
+    m_nextCheck = m_nextCheck < m_fileNames.size() ? m_nextCheck : 0;
+    auto fileName = m_fileNames[m_nextCheck];
+    m_nextCheck++;
+
+    error_code error;
+    auto modified = filesystem::last_write_time(GetPath(fileName), error);
+    auto itr = m_files.find(fileName);
+    if (!error && itr != m_files.end() && !itr->second.targetData.empty() && modified != itr->second.modified)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataCache"), string("Reloading"), fileName);
+        itr->second.modified = modified;
+        return Reload(fileName);
+    }
+    return false;
+}
+
+bool StateDataCache::Reload
+(
+    const string&       controlFileName
+)
+{
+    vector<unique_ptr<ControlData>> parsedControlData;
+    vector<unique_ptr<MechanismTargetData>> parsedTargetData;
+    StateDataXmlParser parser;
+    if (!parser.ParseXML(controlFileName, parsedControlData, parsedTargetData))
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateDataCache"), string("reload failed"), controlFileName);
+        return false;
+    }
+    m_numReloads++;
+
+    // match the new states to the existing ones by name
+    struct TunedControl
+    {
+        const MechanismTargetData*  targetData;
+        ControlData*                controlData;
+        const ControlData*          newControlData;
+    };
+    vector<TunedControl> tuned;
+    auto& file = m_files[controlFileName];
+    auto targetsChanged = false;
+    for (auto& newTd : parsedTargetData)
+    {
+        MechanismTargetData* td = nullptr;
+        for (auto existing : file.targetData)
+        {
+            if (existing->GetStateString() == newTd->GetStateString())
+            {
+                td = existing;
+                break;
+            }
+        }
+        if (td == nullptr)
+        {
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateDataCache"), string("new states need a restart"), newTd->GetStateString());
+            continue;
+        }
+
+        targetsChanged = td->UpdateTargets(*newTd) || targetsChanged;
+        if (td->GetController() != nullptr && newTd->GetController() != nullptr)
+        {
+            tuned.emplace_back(TunedControl{td, td->GetController(), newTd->GetController()});
+        }
+        if (td->GetController2() != nullptr && newTd->GetController2() != nullptr)
+        {
+            tuned.emplace_back(TunedControl{td, td->GetController2(), newTd->GetController2()});
+        }
+    }
+
+    for (auto& change : tuned)
+    {
+        if (change.controlData->HasSameConstants(*change.newControlData))
+        {
+            continue;
+        }
+
+        // control data is shared by every state (in any file) that had the same constants, so it can only change
+        // if every state using it wants the same new constants
+        auto consistent = true;
+        for (auto& [name, other] : m_files)
+        {
+            for (auto td : other.targetData)
+            {
+                for (auto cd : {td->GetController(), td->GetController2()})
+                {
+                    if (cd == change.controlData)
+                    {
+                        const ControlData* wanted = cd;
+                        for (auto& t : tuned)
+                        {
+                            wanted = (&other == &file && t.targetData == td && t.controlData == cd) ? t.newControlData : wanted;
+                        }
+                        consistent = consistent && wanted->HasSameConstants(*change.newControlData);
+                    }
+                }
+            }
+        }
+
+        if (consistent)
+        {
+            ApplyConstants(change.controlData, *change.newControlData);
+        }
+        else
+        {
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateDataCache"), string("shared control data needs a restart"), change.controlData->GetIdentifier());
+        }
+    }
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataCache"), string("reloads"), m_numReloads);
+    return targetsChanged;
+}
+
+int StateDataCache::ApplyConstants
+(
+    ControlData*            controlData,
+    const ControlData&      tuned
+)
+{
+    auto changes = controlData->UpdateConstants(tuned);
+    if ((changes & ControlData::CONSTANT_CHANGES::MODE_CHANGED) != 0)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateDataCache"), string("control mode changes need a restart"), controlData->GetIdentifier());
+        return ControlData::CONSTANT_CHANGES::NO_CHANGES;
+    }
+    if (changes != ControlData::CONSTANT_CHANGES::NO_CHANGES)
+    {
+        DragonControlToCTREAdapterCache::ApplyChangesToAll(controlData, changes);
+        RioControlLoop::GetRioControlLoop()->ReloadGains(controlData);
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataCache"), controlData->GetIdentifier() + string(" changes"), changes);
+    }
+    return changes;
+}
+
+int StateDataCache::GetNumFilesUsing
+(
+    const ControlData*      controlData
+) const
+{
+    auto numFiles = 0;
+    for (auto& [name, file] : m_files)
+    {
+        for (auto td : file.targetData)
+        {
+            if (td->GetController() == controlData || td->GetController2() == controlData)
+            {
+                numFiles++;
+                break;
+            }
+        }
+    }
+    return numFiles;
+}
+
+string StateDataCache::GetPath
+(
+    const string&       controlFileName
+)
+{
+    return frc::filesystem::GetDeployDirectory() + string("/states/") + controlFileName;
+}
@@ -0,0 +1,143 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <mechanisms/controllers/ControlData.h>
+#include <mechanisms/controllers/MechanismTargetData.h>
+#include <mechanisms/controllers/StateDataImage.h>
+
+// Third Party Includes
+
+/// @class StateDataCache
+/// @brief Parses each states/*.xml file the first time a state manager asks for it and keeps the results, so
+///        mechanisms that share a control file (and state managers created again) don't parse it again.  Control
+///        data with the same constants is shared across all of the files.  Everything handed out is owned by the
+///        cache and stays valid for the life of the program.
+///
+///        Files are built from the compiled states/statedata.bin image (see StateDataImage) when it is deployed and
+///        current; otherwise the XML is parsed.
+///
+///        While disabled, CheckNextFile watches the file timestamps (one file per call).  A redeployed file is parsed
+///        again and its targets and gains are copied into the objects that are already handed out, and only the
+///        gains that changed are sent to the motor controllers, so tuning doesn't need a restart.  Adding or removing
+///        states or changing a control mode still does.
+class StateDataCache
+{
+    public:
+        /// @brief  Find or create the cache
+        static StateDataCache* GetStateDataCache();
+
+        /// @brief  Get the state data for a control file, parsing it the first time
+        /// @param [in] const std::string& controlFileName - control file name (in the deploy states directory)
+        /// @return const std::vector<MechanismTargetData*>& - state data (empty if the file couldn't be parsed)
+        const std::vector<MechanismTargetData*>& GetTargetData
+        (
+            const std::string&      controlFileName
+        );
+
+        /// @brief  number of control data objects parsed and the number kept after sharing duplicates
+        int GetNumParsedControlData() const { return m_numParsedControlData; }
+        int GetNumSharedControlData() const { return static_cast<int>(m_controlData.size()); }
+
+        /// @brief  Re-parse the next file if it changed since it was parsed and apply the differences.  Call from DisabledPeriodic.
+        /// @return bool - true if any state targets changed (the states need StateMgrHelper::ReloadStateTargets)
+        bool CheckNextFile();
+
+        /// @brief  Copy new constants into a control data that was handed out and send the ones that changed to the
+        ///         motor controllers and roborio control loops using it
+        /// @param [in] ControlData*         controlData - control data owned by the cache
+        /// @param [in] const ControlData&   tuned - control data with the new constants
+        /// @return int - ControlData::CONSTANT_CHANGES bits that were applied
+        int ApplyConstants
+        (
+            ControlData*            controlData,
+            const ControlData&      tuned
+        );
+
+        /// @brief  number of control files with a state using a control data.  Control data is shared by every state
+        ///         that had the same constants, so tuning one used by more than one file would change other mechanisms.
+        /// @param [in] const ControlData*   controlData - control data owned by the cache
+        /// @return int - number of files
+        int GetNumFilesUsing
+        (
+            const ControlData*      controlData
+        ) const;
+
+        /// @brief  number of files built from the compiled image and from the XML
+        int GetNumImageLoads() const { return m_numImageLoads; }
+        int GetNumXmlLoads() const { return m_numXmlLoads; }
+
+        /// @brief  number of files that were parsed again because they changed
+        int GetNumReloads() const { return m_numReloads; }
+
+        /// @brief  control data owned by the cache (shared by the states)
+        const std::vector<std::unique_ptr<ControlData>>& GetControlData() const { return m_controlData; }
+
+    private:
+        StateDataCache();
+        ~StateDataCache() = default;
+
+        /// @brief  Get the shared control data with the same constants, taking ownership of controlData if there isn't one yet
+        ControlData* Share
+        (
+            ControlData*                                    controlData,
+            std::vector<std::unique_ptr<ControlData>>&      parsed
+        );
+
+        /// @brief  Parse a changed file again and copy its targets and gains into the existing state data
+        /// @return bool - true if any state targets changed
+        bool Reload
+        (
+            const std::string&                              controlFileName
+        );
+
+        /// @brief  full path of a control file
+        static std::string GetPath
+        (
+            const std::string&                              controlFileName
+        );
+
+        struct StateFile
+        {
+            std::vector<std::unique_ptr<MechanismTargetData>>   ownedTargetData;
+            std::vector<MechanismTargetData*>                   targetData;
+            std::filesystem::file_time_type                     modified;
+        };
+
+        std::map<std::string, StateFile>            m_files;
+        std::vector<std::string>                    m_fileNames;
+        size_t                                      m_nextCheck;
+        int                                         m_numReloads;
+        std::vector<std::unique_ptr<ControlData>>   m_controlData;
+        int                                         m_numParsedControlData;
+        StateDataImage                              m_image;
+        int                                         m_numImageLoads;
+        int                                         m_numXmlLoads;
+
+        static StateDataCache*                      m_instance;
+};
@@ -0,0 +1,281 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// FRC includes
+
+// Team 302 includes
+#include <mechanisms/controllers/ControlData.h>
+#include <mechanisms/controllers/ControlModes.h>
+#include <mechanisms/controllers/MechanismTargetData.h>
+#include <mechanisms/controllers/StateDataImage.h>
+#include <utils/Logger.h>
+#include <utils/XmlName.h>
+
+// Third Party Includes
+
+using namespace std;
+
+// compileStateData in build.gradle writes these enum values
+static_assert(ControlModes::CONTROL_TYPE::PERCENT_OUTPUT == 0 &&
+              ControlModes::CONTROL_TYPE::POSITION_INCH == 1 &&
+              ControlModes::CONTROL_TYPE::POSITION_DEGREES == 3 &&
+              ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE == 4 &&
+              ControlModes::CONTROL_TYPE::VELOCITY_INCH == 5 &&
+              ControlModes::CONTROL_TYPE::VELOCITY_DEGREES == 6 &&
+              ControlModes::CONTROL_TYPE::VELOCITY_RPS == 7 &&
+              ControlModes::CONTROL_TYPE::VOLTAGE == 8 &&
+              ControlModes::CONTROL_TYPE::CURRENT == 9 &&
+              ControlModes::CONTROL_TYPE::TRAPEZOID == 10 &&
+              ControlModes::CONTROL_TYPE::MOTION_PROFILE == 11 &&
+              ControlModes::CONTROL_TYPE::MOTION_PROFILE_ARC == 12, "update the modes in compileStateData (build.gradle)");
+static_assert(ControlModes::CONTROL_RUN_LOCS::MOTOR_CONTROLLER == 0 &&
+              ControlModes::CONTROL_RUN_LOCS::ROBORIO == 1, "update the servers in compileStateData (build.gradle)");
+static_assert(MechanismTargetData::SOLENOID::NONE == 0 &&
+              MechanismTargetData::SOLENOID::ON == 1 &&
+              MechanismTargetData::SOLENOID::REVERSE == 2, "update the solenoids in compileStateData (build.gradle)");
+
+StateDataImage::StateDataImage() : m_image(nullptr),
+                                   m_size(0),
+                                   m_buffer(),
+                                   m_header()
+{
+}
+
+StateDataImage::~StateDataImage()
+{
+    Unmap();
+}
+
+bool StateDataImage::Map
+(
+    const string&       imageFileName
+)
+{
+    Unmap();
+
+#ifndef _WIN32
+    auto fd = open(imageFileName.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat info;
+    void* image = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size >= static_cast<off_t>(sizeof(Header)))
+    {
+        image = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);      // the mapping stays valid
+    if (image == MAP_FAILED)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateDataImage"), string("can't map"), imageFileName);
+        return false;
+    }
+    m_image = static_cast<const uint8_t*>(image);
+    m_size = static_cast<size_t>(info.st_size);
+#else
+    // no mmap in the Windows desktop simulation, so read the image into memory instead
+    ifstream imageFile(imageFileName, ios::binary);
+    if (!imageFile.is_open())
+    {
+        return false;
+    }
+    m_buffer.assign(istreambuf_iterator<char>(imageFile), istreambuf_iterator<char>());
+    if (m_buffer.size() < sizeof(Header))
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateDataImage"), string("can't map"), imageFileName);
+        Unmap();
+        return false;
+    }
+    m_image = reinterpret_cast<const uint8_t*>(m_buffer.data());
+    m_size = m_buffer.size();
+#endif
+    m_header = GetRecord<Header>(0);
+
+    // everything is checked here so the lookups only need to check the per file indices
+    uint64_t recordsSize = sizeof(Header) + static_cast<uint64_t>(m_header.numFiles) * sizeof(FileRecord) +
+                           static_cast<uint64_t>(m_header.numControlData) * sizeof(ControlRecord) +
+                           static_cast<uint64_t>(m_header.numTargets) * sizeof(TargetRecord);
+    auto valid = memcmp(m_header.magic, "S302", sizeof(m_header.magic)) == 0 &&
+                 m_header.version == m_version &&
+                 m_header.imageSize == m_size &&
+                 m_header.stringsOffset == recordsSize &&
+                 static_cast<uint64_t>(m_header.stringsOffset) + m_header.stringsSize == m_size &&
+                 m_header.stringsSize > 0 &&
+                 m_image[m_size-1] == '\0';
+    if (!valid)
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateDataImage"), string("invalid image"), imageFileName);
+        Unmap();
+        return false;
+    }
+
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataImage"), string("files"), static_cast<int>(m_header.numFiles));
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataImage"), string("size (KB)"), m_size / 1024.0);
+    return true;
+}
+
+void StateDataImage::Unmap()
+{
+#ifndef _WIN32
+    if (m_image != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(m_image), m_size);
+    }
+#else
+    m_buffer.clear();
+#endif
+    m_image = nullptr;
+    m_size = 0;
+}
+
+const char* StateDataImage::GetString
+(
+    uint32_t        offset
+) const
+{
+    // the table ends with a NUL so any offset inside it is terminated
+    return offset < m_header.stringsSize ? reinterpret_cast<const char*>(m_image + m_header.stringsOffset + offset) : "";
+}
+
+bool StateDataImage::GetStateData
+(
+    const string&                               controlFileName,
+    const string&                               xmlFileName,
+    vector<unique_ptr<ControlData>>&            controlData,
+    vector<unique_ptr<MechanismTargetData>>&    targetData
+) const
+{
+    if (m_image == nullptr)
+    {
+        return false;
+    }
+
+    auto filesOffset = sizeof(Header);
+    auto controlOffset = filesOffset + m_header.numFiles * sizeof(FileRecord);
+    auto targetOffset = controlOffset + m_header.numControlData * sizeof(ControlRecord);
+
+    for (uint32_t inx=0; inx<m_header.numFiles; ++inx)
+    {
+        auto file = GetRecord<FileRecord>(filesOffset + inx * sizeof(FileRecord));
+        if (controlFileName != GetString(file.name))
+        {
+            continue;
+        }
+
+        // the XML is the source of truth, so ignore records that weren't compiled from the XML that is deployed
+        ifstream xmlFile(xmlFileName, ios::binary);
+        auto xmlHash = XmlName::FNV_OFFSET;
+        char buffer[4096];
+        while (xmlFile.read(buffer, sizeof(buffer)) || xmlFile.gcount() > 0)
+        {
+            xmlHash = XmlName::Hash(buffer, static_cast<size_t>(xmlFile.gcount()), xmlHash);
+        }
+        if (!xmlFile.is_open() || xmlHash != file.xmlHash)
+        {
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateDataImage"), string("stale image"), controlFileName);
+            return false;
+        }
+        if (static_cast<uint64_t>(file.firstControlData) + file.numControlData > m_header.numControlData ||
+            static_cast<uint64_t>(file.firstTarget) + file.numTargets > m_header.numTargets)
+        {
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateDataImage"), string("invalid records"), controlFileName);
+            return false;
+        }
+
+        vector<unique_ptr<ControlData>> parsedControlData;
+        vector<ControlData*> controlDataVector;
+        for (uint32_t cdInx=file.firstControlData; cdInx<file.firstControlData+file.numControlData; ++cdInx)
+        {
+            auto record = GetRecord<ControlRecord>(controlOffset + cdInx * sizeof(ControlRecord));
+            if (record.mode >= static_cast<uint32_t>(ControlModes::CONTROL_TYPE::MAX_CONTROL_TYPES) || record.server >= static_cast<uint32_t>(ControlModes::CONTROL_RUN_LOCS::MAX_CONTROL_RUN_LOCS))
+            {
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateDataImage"), string("invalid control data"), controlFileName);
+                return false;
+            }
+            auto cd = new ControlData(static_cast<ControlModes::CONTROL_TYPE>(record.mode),
+                                      static_cast<ControlModes::CONTROL_RUN_LOCS>(record.server),
+                                      string(GetString(record.identifier)),
+                                      record.proportional,
+                                      record.integral,
+                                      record.derivative,
+                                      record.feedforward,
+                                      record.izone,
+                                      record.maxAcceleration,
+                                      record.cruiseVelocity,
+                                      record.peak,
+                                      record.nominal);
+            parsedControlData.emplace_back(cd);
+            controlDataVector.push_back(cd);
+        }
+
+        vector<unique_ptr<MechanismTargetData>> parsedTargetData;
+        for (uint32_t tdInx=file.firstTarget; tdInx<file.firstTarget+file.numTargets; ++tdInx)
+        {
+            auto record = GetRecord<TargetRecord>(targetOffset + tdInx * sizeof(TargetRecord));
+            if (record.solenoid > static_cast<uint32_t>(MechanismTargetData::SOLENOID::REVERSE))
+            {
+                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateDataImage"), string("invalid target"), controlFileName);
+                return false;
+            }
+            array<double,3> function1Coeff = {record.function1Coeff[0], record.function1Coeff[1], record.function1Coeff[2]};
+            array<double,3> function2Coeff = {record.function2Coeff[0], record.function2Coeff[1], record.function2Coeff[2]};
+            auto td = new MechanismTargetData(string(GetString(record.state)),
+                                              string(GetString(record.controlDataIdentifier)),
+                                              string(GetString(record.controlDataIdentifier2)),
+                                              record.value,
+                                              record.secondValue,
+                                              record.robotPitch,
+                                              0.0,
+                                              string("N/A"),
+                                              0.0,
+                                              string("N/A"),
+                                              0.0,
+                                              string("N/A"),
+                                              static_cast<MechanismTargetData::SOLENOID>(record.solenoid),
+                                              function1Coeff,
+                                              function2Coeff);
+            td->Update(controlDataVector);
+            parsedTargetData.emplace_back(td);
+        }
+
+        // only hand the objects out once the whole file was good
+        move(parsedControlData.begin(), parsedControlData.end(), back_inserter(controlData));
+        move(parsedTargetData.begin(), parsedTargetData.end(), back_inserter(targetData));
+        return true;
+    }
+    return false;
+}
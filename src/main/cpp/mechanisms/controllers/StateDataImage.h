@@ -0,0 +1,163 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <mechanisms/controllers/ControlData.h>
+#include <mechanisms/controllers/MechanismTargetData.h>
+
+// Third Party Includes
+
+/// @class StateDataImage
+/// @brief The states/*.xml files compiled into one binary image by compileStateData in build.gradle (which also
+///        validates them against stateData.dtd).  The image is memory mapped and the control data and state targets
+///        are built straight from its fixed size records, so no XML is parsed at startup.
+///        The XML stays the source of truth:  a file that isn't in the image, or whose deployed XML doesn't hash
+///        (XmlName::Hash) to the one it was compiled from, returns false so the caller parses the XML instead.
+///
+///        robot.xml isn't compiled.  It builds the hardware through the factories (motors, chassis, sensors,
+///        mechanisms), so an image would need a record type and a second construction path for each of them that
+///        has to be kept in step with the parsers, robot.dtd and the factory arguments, and the devices themselves
+///        (CAN configuration) take far longer to create than the document takes to parse.  XmlConfigDocument
+///        parses it in place and the parsers switch on hashed names, which is what the image saves for it.
+///        The state files are the ones worth compiling:  they are flat, identical record types that are loaded
+///        once per mechanism.
+class StateDataImage
+{
+    public:
+        StateDataImage();
+        ~StateDataImage();
+        StateDataImage(const StateDataImage&) = delete;
+        StateDataImage& operator=(const StateDataImage&) = delete;
+
+        /// @brief  Map the image and check its header
+        /// @param [in] const std::string& imageFileName - full path of the image
+        /// @return bool - true if the image can be used
+        bool Map
+        (
+            const std::string&      imageFileName
+        );
+
+        /// @brief  true if an image is mapped
+        bool IsMapped() const { return m_image != nullptr; }
+
+        /// @brief  Build the state data for one control file from the image
+        /// @param [in] const std::string& controlFileName - control file name (in the deploy states directory)
+        /// @param [in] const std::string& xmlFileName - full path of the XML the image has to match
+        /// @param [out] std::vector<std::unique_ptr<ControlData>>& - control data defined in the file
+        /// @param [out] std::vector<std::unique_ptr<MechanismTargetData>>& - state data (linked to the control data)
+        /// @return bool - true if the file was in the image and is current
+        bool GetStateData
+        (
+            const std::string&                                  controlFileName,
+            const std::string&                                  xmlFileName,
+            std::vector<std::unique_ptr<ControlData>>&          controlData,
+            std::vector<std::unique_ptr<MechanismTargetData>>&  targetData
+        ) const;
+
+    private:
+        void Unmap();
+
+        /// @brief  string from the string table ("" if the offset is bad)
+        const char* GetString
+        (
+            uint32_t        offset
+        ) const;
+
+        /// @brief  copy a record out of the image (the mapping has no alignment guarantees for the compiler)
+        template <typename T> T GetRecord
+        (
+            size_t          offset
+        ) const
+        {
+            T record;
+            memcpy(&record, m_image + offset, sizeof(T));
+            return record;
+        }
+
+        // records written by compileStateData in build.gradle (little endian like the roboRIO)
+        struct Header
+        {
+            char        magic[4];           ///< "S302"
+            uint32_t    version;            ///< m_version
+            uint32_t    numFiles;
+            uint32_t    numControlData;
+            uint32_t    numTargets;
+            uint32_t    stringsOffset;
+            uint32_t    stringsSize;
+            uint32_t    imageSize;
+        };
+        struct FileRecord
+        {
+            uint32_t    name;               ///< string offset of the XML file name
+            uint32_t    firstControlData;
+            uint32_t    numControlData;
+            uint32_t    firstTarget;
+            uint32_t    numTargets;
+            uint32_t    padding;
+            uint64_t    xmlHash;            ///< FNV-1a hash of the XML the records were compiled from
+        };
+        struct ControlRecord
+        {
+            uint32_t    identifier;         ///< string offset
+            uint32_t    mode;               ///< ControlModes::CONTROL_TYPE
+            uint32_t    server;             ///< ControlModes::CONTROL_RUN_LOCS
+            uint32_t    padding;
+            double      proportional;
+            double      integral;
+            double      derivative;
+            double      feedforward;
+            double      izone;
+            double      maxAcceleration;
+            double      cruiseVelocity;
+            double      peak;
+            double      nominal;
+        };
+        struct TargetRecord
+        {
+            uint32_t    state;              ///< string offset
+            uint32_t    controlDataIdentifier;  ///< string offset
+            uint32_t    controlDataIdentifier2; ///< string offset ("" if there isn't a second controller)
+            uint32_t    solenoid;           ///< MechanismTargetData::SOLENOID
+            double      value;
+            double      secondValue;
+            double      robotPitch;
+            double      function1Coeff[3];
+            double      function2Coeff[3];
+        };
+        static_assert(sizeof(Header) == 32, "header must match the build.gradle writer");
+        static_assert(sizeof(FileRecord) == 32, "file record must match the build.gradle writer");
+        static_assert(sizeof(ControlRecord) == 88, "control record must match the build.gradle writer");
+        static_assert(sizeof(TargetRecord) == 88, "target record must match the build.gradle writer");
+
+        static constexpr uint32_t   m_version = 2;
+
+        const uint8_t*              m_image;
+        size_t                      m_size;
+        std::vector<char>           m_buffer;       // holds the image on Windows (desktop simulation), which has no mmap
+        Header                      m_header;
+};
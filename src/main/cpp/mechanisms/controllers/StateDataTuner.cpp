@@ -0,0 +1,180 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <networktables/NetworkTable.h>
+#include <networktables/NetworkTableInstance.h>
+
+// Team 302 includes
+#include <mechanisms/StateMgrHelper.h>
+#include <mechanisms/controllers/ControlData.h>
+#include <mechanisms/controllers/StateDataCache.h>
+#include <mechanisms/controllers/StateDataTuner.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+StateDataTuner* StateDataTuner::m_instance = nullptr;
+StateDataTuner* StateDataTuner::GetStateDataTuner()
+{
+    if ( StateDataTuner::m_instance == nullptr )
+    {
+        StateDataTuner::m_instance = new StateDataTuner();
+    }
+    return StateDataTuner::m_instance;
+}
+
+StateDataTuner::StateDataTuner() : LoggableItem(),
+                                   m_table(nt::NetworkTableInstance::GetDefault().GetTable("Tuning")),
+                                   m_names(),
+                                   m_publishedReloads(0),
+                                   m_published(false),
+                                   m_nextOverride(0),
+                                   m_numOverrides(0),
+                                   m_numRejectedOverrides(0),
+                                   m_numTargetReloads(0)
+{
+    m_table->PutBoolean("enabled", false);
+}
+
+void StateDataTuner::DisabledPeriodic()
+{
+    auto cache = StateDataCache::GetStateDataCache();
+    if ( cache->CheckNextFile() )
+    {
+        StateMgrHelper::ReloadStateTargets();
+        m_numTargetReloads++;
+    }
+
+    if ( !m_table->GetBoolean("enabled", false) )
+    {
+        m_published = false;
+        return;
+    }
+
+    // (re)publish when tuning starts and after a file changed so the table doesn't undo the file
+    if ( !m_published || m_publishedReloads != cache->GetNumReloads() )
+    {
+        Publish();
+    }
+    else
+    {
+        ApplyNextOverride();
+    }
+}
+
+void StateDataTuner::Publish()
+{
+    auto cache = StateDataCache::GetStateDataCache();
+    auto& controlData = cache->GetControlData();
+    m_names.clear();
+    for ( auto& cd : controlData )
+    {
+        // control data in different files can use the same identifier
+        auto name = cd->GetIdentifier();
+        auto count = 1;
+        while ( find(m_names.begin(), m_names.end(), name) != m_names.end() )
+        {
+            count++;
+            name = cd->GetIdentifier() + string(" (") + to_string(count) + string(")");
+        }
+        m_names.emplace_back(name);
+
+        PublishConstants(m_table->GetSubTable(name).get(), cd.get());
+    }
+    m_publishedReloads = cache->GetNumReloads();
+    m_published = true;
+    m_nextOverride = 0;
+}
+
+void StateDataTuner::PublishConstants
+(
+    nt::NetworkTable*       table,
+    const ControlData*      controlData
+)
+{
+    table->PutNumber("P", controlData->GetP());
+    table->PutNumber("I", controlData->GetI());
+    table->PutNumber("D", controlData->GetD());
+    table->PutNumber("F", controlData->GetF());
+    table->PutNumber("IZone", controlData->GetIZone());
+    table->PutNumber("MaxAcceleration", controlData->GetMaxAcceleration());
+    table->PutNumber("CruiseVelocity", controlData->GetCruiseVelocity());
+    table->PutNumber("Peak", controlData->GetPeakValue());
+    table->PutNumber("Nominal", controlData->GetNominalValue());
+}
+
+bool StateDataTuner::ApplyNextOverride()
+{
+    auto cache = StateDataCache::GetStateDataCache();
+    auto& controlData = cache->GetControlData();
+    if ( controlData.empty() || controlData.size() != m_names.size() )
+    {
+        return false;
+    }
+
+    m_nextOverride = m_nextOverride < controlData.size() ? m_nextOverride : 0;
+    auto cd = controlData[m_nextOverride].get();
+    auto& name = m_names[m_nextOverride];
+    auto table = m_table->GetSubTable(name);
+    m_nextOverride++;
+
+    ControlData tuned( cd->GetMode(),
+                       cd->GetRunLoc(),
+                       cd->GetIdentifier(),
+                       table->GetNumber("P", cd->GetP()),
+                       table->GetNumber("I", cd->GetI()),
+                       table->GetNumber("D", cd->GetD()),
+                       table->GetNumber("F", cd->GetF()),
+                       table->GetNumber("IZone", cd->GetIZone()),
+                       table->GetNumber("MaxAcceleration", cd->GetMaxAcceleration()),
+                       table->GetNumber("CruiseVelocity", cd->GetCruiseVelocity()),
+                       table->GetNumber("Peak", cd->GetPeakValue()),
+                       table->GetNumber("Nominal", cd->GetNominalValue()) );
+    if ( cd->HasSameConstants(tuned) )
+    {
+        return false;
+    }
+
+    // the control data is shared with states in other files, so the override would retune other mechanisms
+    if ( cache->GetNumFilesUsing(cd) > 1 )
+    {
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR, string("StateDataTuner"), string("shared control data can't be tuned"), name);
+        PublishConstants(table.get(), cd);
+        m_numRejectedOverrides++;
+        return false;
+    }
+
+    m_numOverrides++;
+    return cache->ApplyConstants(cd, tuned) != ControlData::CONSTANT_CHANGES::NO_CHANGES;
+}
+
+void StateDataTuner::LogInformation() const
+{
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataTuner"), string("file reloads"), StateDataCache::GetStateDataCache()->GetNumReloads());
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataTuner"), string("target reloads"), m_numTargetReloads);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataTuner"), string("overrides"), m_numOverrides);
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("StateDataTuner"), string("rejected overrides"), m_numRejectedOverrides);
+}
@@ -0,0 +1,83 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <networktables/NetworkTable.h>
+
+// Team 302 includes
+#include <LoggableItem.h>
+#include <mechanisms/controllers/ControlData.h>
+
+/// @class StateDataTuner
+/// @brief Tunes the state data while the robot is disabled without a restart:
+///         - redeployed states/*.xml files are parsed again (StateDataCache::CheckNextFile) and their targets and
+///           gains are applied in place
+///         - when Tuning/enabled is set in the network tables, every control data's constants are published under
+///           Tuning/<identifier> and edits there override the file values
+///        Only the gains that changed are sent to the motor controllers.  Control data is shared by the states that
+///        had the same constants, so an override changes all of them.  An override of control data that states in
+///        other control files (other mechanisms) share is rejected and the table is put back, the same as a file
+///        reload that would change shared control data; give the states distinct constants in the XML to tune them.
+///        Each call checks one file and one control data so the cost per loop stays flat.
+class StateDataTuner : public LoggableItem
+{
+    public:
+        /// @brief  Find or create the tuner
+        static StateDataTuner* GetStateDataTuner();
+
+        /// @brief  Check for changed files and network table overrides.  Call from DisabledPeriodic.
+        void DisabledPeriodic();
+
+        /// @brief  log how much was tuned
+        void LogInformation() const override;
+
+    private:
+        StateDataTuner();
+        ~StateDataTuner() = default;
+
+        /// @brief  put the current constants of every control data in the network table
+        void Publish();
+
+        /// @brief  put a control data's constants in its sub table
+        void PublishConstants
+        (
+            nt::NetworkTable*       table,
+            const ControlData*      controlData
+        );
+
+        /// @brief  apply the network table values for the next control data if they were edited
+        /// @return bool - true if any constants changed
+        bool ApplyNextOverride();
+
+        std::shared_ptr<nt::NetworkTable>   m_table;
+        std::vector<std::string>            m_names;        // sub table for each of the cache's control data
+        int                                 m_publishedReloads;
+        bool                                m_published;
+        size_t                              m_nextOverride;
+        int                                 m_numOverrides;
+        int                                 m_numRejectedOverrides;
+        int                                 m_numTargetReloads;
+
+        static StateDataTuner*              m_instance;
+};
@@ -33,7 +33,6 @@
 // C++ Includes
 #include <memory>
 #include <string>
-#include <cstring>
 
 // FRC includes
 #include <frc/Filesystem.h>
@@ -41,9 +40,9 @@
 // Team 302 includes
 #include <mechanisms/controllers/ControlData.h>
 #include <mechanisms/controllers/MechanismTargetData.h>
-#include <mechanisms/MechanismFactory.h>
-#include <mechanisms/MechanismTypes.h>
 #include <utils/Logger.h>
+#include <utils/XmlConfigDocument.h>
+#include <utils/XmlName.h>
 #include <mechanisms/controllers/ControlDataXmlParser.h>
 #include <mechanisms/controllers/MechanismTargetXmlParser.h>
 #include <mechanisms/controllers/StateDataXmlParser.h>
@@ -56,100 +55,111 @@ using namespace std;
 
 
 /// @brief      Parse a mechanismState.xml file
-/// @param [in] MechanismTypes::MECHANISM_TYPE  - mechanism that the states are for
-/// @return     state data
-vector<MechanismTargetData*> StateDataXmlParser::ParseXML
+/// @param [in] const std::string&  - control file name (in the deploy states directory)
+/// @param [out] std::vector<std::unique_ptr<ControlData>>& - control data defined in the file
+/// @param [out] std::vector<std::unique_ptr<MechanismTargetData>>& - state data (linked to the control data)
+/// @return     bool - true if the file was parsed
+bool StateDataXmlParser::ParseXML
 (
-    MechanismTypes::MECHANISM_TYPE mechanism
+    const string&                               controlFileName,
+    vector<unique_ptr<ControlData>>&            controlData,
+    vector<unique_ptr<MechanismTargetData>>&    targetData
 )
 {
     bool hasError = false;
-    vector<MechanismTargetData*> targetDataVector;
 
     // set the file to parse
 	auto filename = frc::filesystem::GetDeployDirectory();
     filename += string("/states/");
-    auto mech = MechanismFactory::GetMechanismFactory()->GetMechanism(mechanism);
-    if (mech == nullptr)
+    if (controlFileName.empty())
     {
-        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("StateDataXmlParser"), string("ParseXML"), string("invalid mechanism") );
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("StateDataXmlParser"), string("ParseXML"), string("mechanism without control file") );
         hasError = true;
     }
 
-    if ( !hasError && mech != nullptr)
+    if (!hasError)
     {
-        auto mechFile = mech->GetControlFileName();
-        if (mechFile.empty())
+        // load the xml file into memory (parse it)
+        filename += controlFileName;
+        XmlConfigDocument config;
+        xml_parse_result result = config.Load(filename);
+        auto& doc = config.GetDocument();
+
+        // if it is good
+        if (result)
         {
-            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("StateDataXmlParser"), string("ParseXML"), string("mechanism without control file") );
-            hasError = true;
-        }
+            unique_ptr<ControlDataXmlParser> controlDataXML = make_unique<ControlDataXmlParser>();
+            unique_ptr<MechanismTargetXmlParser> mechanismTargetXML = make_unique<MechanismTargetXmlParser>();
 
-        if (!hasError)
-        {
-            // load the xml file into memory (parse it)
-            filename += mechFile;
-            xml_document doc;
-            xml_parse_result result = doc.load_file(filename.c_str());
+            vector<ControlData*> controlDataVector;
 
-            // if it is good
-            if (result)
-            {
-                unique_ptr<ControlDataXmlParser> controlDataXML = make_unique<ControlDataXmlParser>();
-                unique_ptr<MechanismTargetXmlParser> mechanismTargetXML = make_unique<MechanismTargetXmlParser>();
-
-                vector<ControlData*> controlDataVector;
-
-                // get the root node <robot>
-                xml_node parent = doc.root();
-                for (xml_node node = parent.first_child(); node; node = node.next_sibling())
-                {   
-                    // loop through the direct children of <robot> and call the appropriate parser
-                    for (xml_node child = node.first_child(); child; child = child.next_sibling())
+            // get the root node <robot>
+            xml_node parent = doc.root();
+            for (xml_node node = parent.first_child(); node; node = node.next_sibling())
+            {   
+                // loop through the direct children of <robot> and call the appropriate parser
+                for (xml_node child = node.first_child(); child; child = child.next_sibling())
+                {
+                    switch ( XmlName::Hash( child.name() ) )
                     {
-                        if (strcmp(child.name(), "controlData") == 0)
+                        case XmlName::Hash( "controlData" ):
                         {
-                            controlDataVector.push_back( controlDataXML.get()->ParseXML( child ) );
+                            auto cd = controlDataXML.get()->ParseXML( child );
+                            if (cd != nullptr)
+                            {
+                                controlData.emplace_back( cd );
+                                controlDataVector.push_back( cd );
+                            }
+                            break;
                         }
-                        else if (strcmp(child.name(), "mechanismTarget") == 0)
+
+                        case XmlName::Hash( "mechanismTarget" ):
                         {
-                            targetDataVector.push_back( mechanismTargetXML.get()->ParseXML( child ) );
+                            auto td = mechanismTargetXML.get()->ParseXML( child );
+                            if (td != nullptr)
+                            {
+                                targetData.emplace_back( td );
+                            }
+                            break;
                         }
-                        else
+
+                        default:
                         {
                             string msg = "unknown child ";
                             msg += child.name();
                             Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("StateDataXmlParser"), string("ParseXML"), msg );
+                            break;
                         }
                     }
                 }
-                
-                for ( auto td : targetDataVector )
-                {
-                    td->Update( controlDataVector );
-                }
             }
-            else
+            
+            for ( auto& td : targetData )
             {
-                string msg = "XML [";
-                msg += filename;
-                msg += "] parsed with errors, attr value: [";
-                msg += doc.child( "prototype" ).attribute( "attr" ).value();
-                msg += "]";
-                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("StateDataXmlParser"), string("ParseXML (1) "), msg );
-
-                msg = "Error description: ";
-                msg += result.description();
-                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("StateDataXmlParser"), string("ParseXML (2) "), msg );
-
-                msg = "Error offset: ";
-                msg += result.offset;
-                msg += " error at ...";
-                msg += filename;
-                msg += result.offset;
-                Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("StateDataXmlParser"), string("ParseXML (3) "), msg );
+                td->Update( controlDataVector );
             }
         }
+        else
+        {
+            string msg = "XML [";
+            msg += filename;
+            msg += "] parsed with errors, attr value: [";
+            msg += doc.child( "prototype" ).attribute( "attr" ).value();
+            msg += "]";
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("StateDataXmlParser"), string("ParseXML (1) "), msg );
+
+            msg = "Error description: ";
+            msg += result.description();
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("StateDataXmlParser"), string("ParseXML (2) "), msg );
+
+            msg = "Error offset: ";
+            msg += result.offset;
+            msg += " error at ...";
+            msg += filename;
+            msg += result.offset;
+            Logger::GetLogger()->LogData(LOGGER_LEVEL::ERROR_ONCE, string("StateDataXmlParser"), string("ParseXML (3) "), msg );
+            hasError = true;
+        }
     }
-    return targetDataVector;
+    return !hasError;
 }
@@ -15,9 +15,11 @@
 //====================================================================================================================================================
 
 #pragma once
+#include <memory>
+#include <string>
 #include <vector>
 
-#include <mechanisms/MechanismTypes.h>
+#include <mechanisms/controllers/ControlData.h>
 #include <mechanisms/controllers/MechanismTargetData.h>
 
 //========================================================================================================
@@ -31,7 +33,7 @@
 ///     This parsing leverages the 3rd party Open Source Pugixml library (https://pugixml.org/).
 ///
 ///     The state definition XML files are in:  /home/lvuser/config/states/XXX.xml where the XXX
-///     is the mechanism name.
+///     is the mechanism name.  StateDataCache parses each file once and shares the results.
 ///
 //========================================================================================================
 class StateDataXmlParser
@@ -41,10 +43,14 @@ class StateDataXmlParser
         virtual ~StateDataXmlParser() = default;
 
         /// @brief      Parse a mechanismState.xml file
-        /// @param [in] MechanismTypes::MECHANISM_TYPE  - mechanism that the states are for
-        /// @return     state data
-        std::vector<MechanismTargetData*> ParseXML
+        /// @param [in] const std::string&  - control file name (in the deploy states directory)
+        /// @param [out] std::vector<std::unique_ptr<ControlData>>& - control data defined in the file
+        /// @param [out] std::vector<std::unique_ptr<MechanismTargetData>>& - state data (linked to the control data)
+        /// @return     bool - true if the file was parsed
+        bool ParseXML
         (
-            MechanismTypes::MECHANISM_TYPE mechanism
+            const std::string&                                  controlFileName,
+            std::vector<std::unique_ptr<ControlData>>&          controlData,
+            std::vector<std::unique_ptr<MechanismTargetData>>&  targetData
         );
 };
@@ -17,7 +17,6 @@
 // FRC includes
 
 // Team 302 includes
-#include <TeleopControl.h>
 #include <auton/PrimitiveParams.h>
 #include <mechanisms/MechanismFactory.h>
 #include <mechanisms/base/StateMgr.h>
@@ -57,46 +56,13 @@ ExampleStateMgr::ExampleStateMgr() : StateMgr(),
     stateMap[m_exampleReverseXmlString] = m_reverseState;  
 
     Init(m_example, stateMap);
+    SetTransitionTable(m_transitions.data(), m_transitions.size());
     if (m_example != nullptr)
     {
         m_example->AddStateMgr(this);
     }
 }   
 
-/// @brief Check if driver inputs or sensors trigger a state transition
-void ExampleStateMgr::CheckForStateTransition()
-{
-
-    if ( m_example != nullptr )
-    {    
-        auto currentState = static_cast<EXAMPLE_STATE>(GetCurrentState());
-        auto targetState = currentState;
-
-        auto controller = TeleopControl::GetInstance();
-        auto isForwardSelected   = controller != nullptr ? controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::EXAMPLE_FORWARD) : false;
-        auto isReverseSelected   = controller != nullptr ? controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::EXAMPLE_REVERSE) : false;
-
-        if (isForwardSelected)
-        {
-            targetState = EXAMPLE_STATE::FORWARD;
-        }
-        else if (isReverseSelected)
-        {
-            targetState = EXAMPLE_STATE::REVERSE;
-        }
-        else
-        {
-            targetState = EXAMPLE_STATE::OFF;
-        }
-
-        if (targetState != currentState)
-        {
-            SetCurrentState(targetState, true);
-        }
-        
-    }
-}
-
 /// @brief  Get the current Parameter parm value for the state of this mechanism
 /// @param PrimitiveParams* currentParams current set of primitive parameters
 /// @returns int state id - -1 indicates that there is not a state to set
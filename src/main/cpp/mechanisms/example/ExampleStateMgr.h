@@ -16,12 +16,15 @@
 #pragma once
 
 // C++ Includes
+#include <array>
 #include <string>
 
 // FRC includes
 
 // Team 302 includes
+#include <TeleopControl.h>
 #include <mechanisms/base/StateMgr.h>
+#include <mechanisms/base/StateTransition.h>
 #include <mechanisms/example/Example.h>
 #include <mechanisms/StateStruc.h>
 
@@ -59,7 +62,6 @@ class ExampleStateMgr : public StateMgr
             PrimitiveParams*    currentParams
         ) override;
 
-        void CheckForStateTransition() override;
     private:
 
         ExampleStateMgr();
@@ -71,4 +73,13 @@ class ExampleStateMgr : public StateMgr
         const StateStruc m_offState = {EXAMPLE_STATE::OFF, m_exampleOffXmlString, StateType::EXAMPLE_STATE, true};
         const StateStruc m_forwardState = {EXAMPLE_STATE::FORWARD, m_exampleForwardXmlString, StateType::EXAMPLE_STATE, false};
         const StateStruc m_reverseState = {EXAMPLE_STATE::REVERSE, m_exampleReverseXmlString, StateType::EXAMPLE_STATE, false};
+
+        // run forward or reverse while the button is held
+        static constexpr std::array<StateTransition, 4> m_transitions
+        {{
+            {StateTransition::ANY_STATE,    StateTransition::BUTTON, TeleopControl::FUNCTION_IDENTIFIER::EXAMPLE_FORWARD, StateTransition::RISING,  EXAMPLE_STATE::FORWARD},
+            {StateTransition::ANY_STATE,    StateTransition::BUTTON, TeleopControl::FUNCTION_IDENTIFIER::EXAMPLE_REVERSE, StateTransition::RISING,  EXAMPLE_STATE::REVERSE},
+            {EXAMPLE_STATE::FORWARD,        StateTransition::BUTTON, TeleopControl::FUNCTION_IDENTIFIER::EXAMPLE_FORWARD, StateTransition::FALLING, EXAMPLE_STATE::OFF},
+            {EXAMPLE_STATE::REVERSE,        StateTransition::BUTTON, TeleopControl::FUNCTION_IDENTIFIER::EXAMPLE_REVERSE, StateTransition::FALLING, EXAMPLE_STATE::OFF}
+        }};
 };
\ No newline at end of file
@@ -0,0 +1,102 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <atomic>
+#include <type_traits>
+
+/// @class DragonDoubleBuffer
+/// @brief Lock free hand off of the latest value from one writer thread to one reader thread (a seqlock).  The
+///        sequence number is odd while a write is in progress; each write bumps it twice and fills the buffer the
+///        last value wasn't published in.  The reader copies the published buffer and keeps the copy if the
+///        sequence was even and the writer can't have started on that buffer while it was copying.  Neither side
+///        ever blocks; if the reader keeps getting overrun it keeps its previous value.
+template <typename T>
+class DragonDoubleBuffer
+{
+    static_assert(std::is_trivially_copyable<T>::value, "DragonDoubleBuffer values are copied without locks");
+
+    public:
+        DragonDoubleBuffer() : m_buffers(), m_sequence(0)
+        {
+        }
+        explicit DragonDoubleBuffer
+        (
+            const T&    initialValue
+        ) : m_buffers{initialValue, initialValue},
+            m_sequence(0)
+        {
+        }
+        ~DragonDoubleBuffer() = default;
+
+        /// @brief  publish a new value (writer thread only)
+        void Write
+        (
+            const T&    value
+        )
+        {
+            auto sequence = m_sequence.load(std::memory_order_relaxed);
+            // mark the write in progress before any of the data stores can be seen
+            m_sequence.store(sequence+1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_buffers[BufferIndex(sequence+2)] = value;
+            m_sequence.store(sequence+2, std::memory_order_release);
+        }
+
+        /// @brief  copy the latest value (reader thread only)
+        /// @param [out] T&   value:  latest value; unchanged if the writer kept overrunning the copy
+        /// @return bool    true if value was updated
+        bool Read
+        (
+            T&          value
+        ) const
+        {
+            for (auto attempt=0; attempt<m_maxAttempts; ++attempt)
+            {
+                auto sequence = m_sequence.load(std::memory_order_acquire);
+                if ((sequence & 1U) != 0)
+                {
+                    // a write is in progress; it only takes as long as copying one value
+                    continue;
+                }
+                T copy = m_buffers[BufferIndex(sequence)];
+                std::atomic_thread_fence(std::memory_order_acquire);
+                // one more write (sequence + 2) only touched the other buffer; the write after that (sequence + 3)
+                // is the first that could have stored into the buffer that was copied
+                if (m_sequence.load(std::memory_order_relaxed) - sequence <= 2U)
+                {
+                    value = copy;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// @brief  number of values written so far
+        unsigned int GetSequence() const { return m_sequence.load(std::memory_order_acquire) / 2U; }
+
+    private:
+        /// @brief  buffer holding the value published at an (even) sequence number
+        static constexpr unsigned int BufferIndex(unsigned int sequence) { return (sequence / 2U) & 1U; }
+
+        static constexpr int            m_maxAttempts = 8;
+
+        T                               m_buffers[2];
+        std::atomic<unsigned int>       m_sequence;
+};
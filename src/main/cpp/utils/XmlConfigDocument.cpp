@@ -0,0 +1,125 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// FRC includes
+#include <frc/Timer.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <utils/Logger.h>
+#include <utils/XmlConfigDocument.h>
+
+// Third Party Includes
+#include <pugixml/pugixml.hpp>
+
+using namespace std;
+
+mutex XmlConfigDocument::m_mutex;
+vector<vector<char>> XmlConfigDocument::m_freeBuffers;
+int XmlConfigDocument::m_numLoads = 0;
+size_t XmlConfigDocument::m_bytesLoaded = 0;
+units::time::second_t XmlConfigDocument::m_loadTime = units::time::second_t(0.0);
+
+XmlConfigDocument::XmlConfigDocument() : m_doc(),
+                                         m_buffer()
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (!m_freeBuffers.empty())
+    {
+        m_buffer = move(m_freeBuffers.back());
+        m_freeBuffers.pop_back();
+    }
+}
+
+XmlConfigDocument::~XmlConfigDocument()
+{
+    // the document points into the buffer, so free it before the buffer is handed to someone else
+    m_doc.reset();
+    lock_guard<mutex> lock(m_mutex);
+    m_freeBuffers.emplace_back(move(m_buffer));
+}
+
+pugi::xml_parse_result XmlConfigDocument::Load
+(
+    const string&       fileName
+)
+{
+    auto start = frc::Timer::GetFPGATimestamp();
+    m_doc.reset();
+
+    pugi::xml_parse_result result;
+    auto file = fopen(fileName.c_str(), "rb");
+    if (file == nullptr)
+    {
+        result.status = pugi::status_file_not_found;
+        return result;
+    }
+
+    // one read of the whole file; the buffer keeps its capacity between files
+    size_t size = 0;
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        auto end = ftell(file);
+        size = end > 0 ? static_cast<size_t>(end) : 0;
+    }
+    rewind(file);
+    m_buffer.resize(size);
+    auto numRead = size > 0 ? fread(m_buffer.data(), 1, size, file) : 0;
+    fclose(file);
+    if (numRead != size || size == 0)
+    {
+        result.status = pugi::status_io_error;
+        return result;
+    }
+
+    result = m_doc.load_buffer_inplace(m_buffer.data(), size, m_parseOptions, pugi::encoding_utf8);
+
+    units::time::second_t elapsed = frc::Timer::GetFPGATimestamp() - start;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_numLoads++;
+        m_bytesLoaded += size;
+        m_loadTime += elapsed;
+    }
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("XmlConfigDocument"), fileName + string(" (ms)"), units::time::millisecond_t(elapsed).to<double>());
+    return result;
+}
+
+int XmlConfigDocument::GetNumLoads()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_numLoads;
+}
+
+size_t XmlConfigDocument::GetBytesLoaded()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_bytesLoaded;
+}
+
+units::time::second_t XmlConfigDocument::GetLoadTime()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_loadTime;
+}
@@ -0,0 +1,78 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <mutex>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <units/time.h>
+
+// Team 302 includes
+
+// Third Party Includes
+#include <pugixml/pugixml.hpp>
+
+/// @class XmlConfigDocument
+/// @brief Loads one of the deploy XML configuration files (robot.xml, states/*.xml, auton/*.xml) for the parsers.
+///        The file is read with one read into a buffer and pugixml parses it in place with the minimal flags (no
+///        escapes, end of line or attribute whitespace conversion; the config files don't use them), so the
+///        document points into the buffer instead of copying every name and value.
+///
+///        The buffers are reused:  one is taken from a free list when a file is loaded and given back when the
+///        document is destroyed, so the nested loads at startup (robot.xml -> states/*.xml) need two buffers for
+///        the whole run instead of one allocation per file.  The load time of each file is logged.
+class XmlConfigDocument
+{
+    public:
+        XmlConfigDocument();
+        ~XmlConfigDocument();
+        XmlConfigDocument(const XmlConfigDocument&) = delete;
+        XmlConfigDocument& operator=(const XmlConfigDocument&) = delete;
+
+        /// @brief  Read and parse a file
+        /// @param [in] const std::string& fileName - full path of the file
+        /// @return pugi::xml_parse_result - parse status (status_file_not_found / status_io_error if it can't be read)
+        pugi::xml_parse_result Load
+        (
+            const std::string&      fileName
+        );
+
+        /// @brief  the parsed document; valid until this object is destroyed or Load is called again
+        const pugi::xml_document& GetDocument() const { return m_doc; }
+
+        /// @brief  files loaded, bytes read and time spent loading since the program started
+        static int GetNumLoads();
+        static size_t GetBytesLoaded();
+        static units::time::second_t GetLoadTime();
+
+    private:
+        pugi::xml_document                          m_doc;
+        std::vector<char>                           m_buffer;
+
+        static constexpr unsigned int               m_parseOptions = pugi::parse_minimal;
+
+        // buffers given back by destroyed documents and the load statistics
+        static std::mutex                           m_mutex;
+        static std::vector<std::vector<char>>       m_freeBuffers;
+        static int                                  m_numLoads;
+        static size_t                               m_bytesLoaded;
+        static units::time::second_t                m_loadTime;
+};
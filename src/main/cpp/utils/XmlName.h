@@ -0,0 +1,80 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <cstdint>
+
+/// @class XmlName
+/// @brief Compile time hash of XML element and attribute names so the config parsers can switch on a name
+///        instead of running a chain of strcmp calls:
+///
+///            switch ( XmlName::Hash( attr.name() ) )
+///            {
+///                case XmlName::Hash( "canId" ):
+///
+///        Each name is hashed once (64 bit FNV-1a) and the case labels are constants.  Two names in the same switch
+///        that hash to the same value don't compile (duplicate case value).
+///
+///        The same hash over a block of bytes fingerprints the deployed files that have a compiled copy (.traj and 
+///        statedata.bin); build.gradle computes it the same way.
+class XmlName
+{
+    public:
+        XmlName() = delete;
+        ~XmlName() = delete;
+
+        /// @brief hash an element or attribute name
+        /// @param [in] const char* name - NUL terminated name
+        /// @return uint64_t hash
+        static constexpr uint64_t Hash
+        (
+            const char*     name
+        )
+        {
+            uint64_t hash = FNV_OFFSET;
+            for ( ; *name != '\0'; ++name )
+            {
+                hash = ( hash ^ static_cast<unsigned char>( *name ) ) * FNV_PRIME;
+            }
+            return hash;
+        }
+
+        /// @brief hash a block of bytes; pass the previous result as the seed to hash a file in chunks
+        /// @param [in] const char* data - bytes to hash
+        /// @param [in] size_t      size - number of bytes
+        /// @param [in] uint64_t    hash - result for the bytes before these (FNV_OFFSET for the first block)
+        /// @return uint64_t hash
+        static constexpr uint64_t Hash
+        (
+            const char*     data,
+            size_t          size,
+            uint64_t        hash
+        )
+        {
+            for ( size_t inx=0; inx<size; ++inx )
+            {
+                hash = ( hash ^ static_cast<unsigned char>( data[inx] ) ) * FNV_PRIME;
+            }
+            return hash;
+        }
+
+        static constexpr uint64_t FNV_OFFSET = 14695981039346656037ULL;
+        static constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+};
@@ -0,0 +1,244 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+// FRC includes
+#include <frc/geometry/Rotation2d.h>
+#include <frc/geometry/Translation2d.h>
+#include <frc/Timer.h>
+#include <networktables/NetworkTable.h>
+#include <networktables/NetworkTableInstance.h>
+
+// Team 302 includes
+#include <hw/DragonLimelight.h>
+#include <hw/factories/LimelightFactory.h>
+#include <utils/Logger.h>
+#include <vision/DragonVision.h>
+#include <vision/DragonVisionTarget.h>
+
+// Third Party Includes
+
+using namespace std;
+
+DragonVision* DragonVision::m_instance = nullptr;
+DragonVision* DragonVision::GetDragonVision()
+{
+    if ( DragonVision::m_instance == nullptr )
+    {
+        DragonVision::m_instance = new DragonVision();
+    }
+    return DragonVision::m_instance;
+}
+
+DragonVision::DragonVision() : LoggableItem(),
+                               m_cameras(),
+                               m_listeners(),
+                               m_mutex(),
+                               m_pending(),
+                               m_numPending(0),
+                               m_droppedFrames(0),
+                               m_stats(),
+                               m_received(),
+                               m_measurements(),
+                               m_latestTarget(),
+                               m_hasLatestTarget(false),
+                               m_windowStart(units::time::second_t(0.0)),
+                               m_reportedStats(),
+                               m_reportedDroppedFrames(0)
+{
+    m_measurements.reserve(m_maxPendingFrames);
+}
+
+void DragonVision::Init()
+{
+    if (!m_cameras.empty())
+    {
+        return;
+    }
+
+    for (auto& [tableName, limelight] : LimelightFactory::GetLimelightFactory()->GetLimelights())
+    {
+        m_cameras.emplace_back(limelight);
+    }
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stats.assign(m_cameras.size(), CameraStats{});
+    }
+    m_reportedStats.assign(m_cameras.size(), CameraStats{});
+    m_windowStart = frc::Timer::GetFPGATimestamp();
+
+    // the limelight updates its pipeline latency with every processed frame, so use it as the frame notification
+    auto ntInstance = nt::NetworkTableInstance::GetDefault();
+    for (int inx=0; inx<static_cast<int>(m_cameras.size()); ++inx)
+    {
+        auto table = ntInstance.GetTable(m_cameras[inx]->GetNetworkTableName());
+        m_listeners.emplace_back(table->AddListener("tl",
+                                                    nt::EventFlags::kValueAll,
+                                                    [this, inx](nt::NetworkTable* table, std::string_view key, const nt::Event& event) { OnFrame(inx); }));
+    }
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("DragonVision"), string("Cameras"), static_cast<int>(m_cameras.size()));
+}
+
+void DragonVision::OnFrame
+(
+    int     cameraIndex
+)
+{
+    // runs on the network table listener thread:  only copy the raw values (the conversions in ToTarget can log)
+    auto limelight = m_cameras[cameraIndex];
+    units::time::second_t latency = limelight->GetPipelineLatency() + limelight->GetCaptureLatency();
+
+    RawFrame frame{};
+    frame.cameraIndex = cameraIndex;
+    frame.timestamp = frc::Timer::GetFPGATimestamp() - latency;
+    frame.hasTarget = limelight->HasTarget();
+    if (frame.hasTarget)
+    {
+        frame.tx = limelight->GetTx();
+        frame.ty = limelight->GetTy();
+        frame.area = limelight->GetTargetArea();
+    }
+    frame.hasBotPose = limelight->GetBotPose(frame.botPose);
+
+    lock_guard<mutex> lock(m_mutex);
+    auto& stats = m_stats[cameraIndex];
+    stats.frames++;
+    stats.latencySum += latency;
+    stats.maxLatency = latency > stats.maxLatency ? latency : stats.maxLatency;
+
+    if (frame.hasTarget || frame.hasBotPose)
+    {
+        if (m_numPending < m_maxPendingFrames)
+        {
+            m_pending[m_numPending] = frame;
+            m_numPending++;
+        }
+        else
+        {
+            m_droppedFrames++;
+        }
+    }
+}
+
+void DragonVision::Periodic()
+{
+    m_measurements.clear();
+    auto now = frc::Timer::GetFPGATimestamp();
+    auto windowDone = (now - m_windowStart) >= m_statsWindow;
+    auto numReceived = 0;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        copy(m_pending.begin(), m_pending.begin()+m_numPending, m_received.begin());
+        numReceived = m_numPending;
+        m_numPending = 0;
+
+        if (windowDone)
+        {
+            auto elapsed = now - m_windowStart;
+            for (unsigned int inx=0; inx<m_stats.size(); ++inx)
+            {
+                auto& stats = m_stats[inx];
+                auto& reported = m_reportedStats[inx];
+                reported.framesPerSecond = stats.frames / elapsed.to<double>();
+                reported.avgLatency = stats.frames > 0 ? stats.latencySum / stats.frames : units::time::second_t(0.0);
+                reported.worstLatency = stats.maxLatency;
+                stats = CameraStats{};
+            }
+            m_reportedDroppedFrames = m_droppedFrames;
+        }
+    }
+    if (windowDone)
+    {
+        m_windowStart = now;
+    }
+
+    for (auto inx=0; inx<numReceived; ++inx)
+    {
+        m_measurements.emplace_back(ToTarget(m_received[inx]));
+    }
+
+    // each camera is already in order, but the cameras interleave
+    sort(m_measurements.begin(), m_measurements.end(), [](const DragonVisionTarget& a, const DragonVisionTarget& b) { return a.timestamp < b.timestamp; });
+
+    for (auto& frame : m_measurements)
+    {
+        if (frame.hasTarget && (!m_hasLatestTarget || frame.timestamp >= m_latestTarget.timestamp))
+        {
+            m_latestTarget = frame;
+            m_hasLatestTarget = true;
+        }
+    }
+}
+
+DragonVisionTarget DragonVision::ToTarget
+(
+    const RawFrame&     raw
+) const
+{
+    DragonVisionTarget frame{};
+    frame.cameraIndex = raw.cameraIndex;
+    frame.timestamp = raw.timestamp;
+    frame.hasTarget = raw.hasTarget;
+    if (frame.hasTarget)
+    {
+        auto limelight = m_cameras[raw.cameraIndex];
+        frame.verticalOffset = limelight->GetTargetVerticalOffset(raw.tx, raw.ty);
+        frame.area = raw.area;
+
+        // target relative to the camera lens (limelight angles are positive to the right, WPI y is positive to the left)
+        auto tx = limelight->GetTargetHorizontalOffset(raw.tx, raw.ty);
+        auto cameraDistance = limelight->EstimateTargetDistance(frame.verticalOffset);
+        frc::Translation2d cameraToTarget{units::length::meter_t(cameraDistance), frc::Rotation2d(-1.0*tx)};
+
+        // move it into robot coordinates using the camera mounting transform
+        auto robotToCamera = limelight->GetRobotToCameraTransform();
+        frame.robotToTarget = cameraToTarget.RotateBy(robotToCamera.Rotation()) + robotToCamera.Translation();
+        frame.distance = units::length::inch_t(frame.robotToTarget.Norm());
+        frame.horizontalAngle = units::angle::radian_t(-1.0*atan2(frame.robotToTarget.Y().to<double>(), frame.robotToTarget.X().to<double>()));
+    }
+    frame.hasBotPose = raw.hasBotPose;
+    frame.botPose = raw.botPose;
+    return frame;
+}
+
+const DragonVisionTarget* DragonVision::GetLatestTarget() const
+{
+    if (m_hasLatestTarget && (frc::Timer::GetFPGATimestamp() - m_latestTarget.timestamp) < m_maxTargetAge)
+    {
+        return &m_latestTarget;
+    }
+    return nullptr;
+}
+
+void DragonVision::LogInformation() const
+{
+    for (unsigned int inx=0; inx<m_cameras.size(); ++inx)
+    {
+        auto name = m_cameras[inx]->GetNetworkTableName();
+        auto& stats = m_reportedStats[inx];
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("DragonVision"), name + string(" fps"), stats.framesPerSecond);
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("DragonVision"), name + string(" avg latency (ms)"), units::time::millisecond_t(stats.avgLatency).to<double>());
+        Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("DragonVision"), name + string(" max latency (ms)"), units::time::millisecond_t(stats.worstLatency).to<double>());
+    }
+    Logger::GetLogger()->LogData(LOGGER_LEVEL::PRINT, string("DragonVision"), string("dropped frames"), m_reportedDroppedFrames);
+}
@@ -0,0 +1,130 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <mutex>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <networktables/NetworkTable.h>
+#include <units/angle.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <LoggableItem.h>
+#include <vision/DragonVisionTarget.h>
+
+class DragonLimelight;
+
+/// @class DragonVision
+/// @brief Owns every limelight defined in robot.xml.  Each camera is subscribed to on the network table
+///        listener thread and its frames are merged into one time ordered measurement stream that the
+///        pose estimator and the targeting code read once per robot loop.
+class DragonVision : public LoggableItem
+{
+    public:
+        /// @brief Find or create the vision manager
+        static DragonVision* GetDragonVision();
+
+        /// @brief Subscribe to every limelight the LimelightFactory created.  Call after robot.xml is parsed.
+        void Init();
+
+        /// @brief Move the frames received since the last call into the measurement stream.  Call once per robot loop
+        ///        before anything reads GetMeasurements().
+        void Periodic();
+
+        /// @brief Frames received during the last Periodic() call ordered by capture time (oldest first)
+        const std::vector<DragonVisionTarget>& GetMeasurements() const { return m_measurements; }
+
+        /// @brief Most recent frame from any camera that saw the target
+        /// @returns const DragonVisionTarget*  target or nullptr if no camera has seen it recently
+        const DragonVisionTarget* GetLatestTarget() const;
+
+        /// @brief Number of cameras being merged
+        int GetNumberOfCameras() const { return static_cast<int>(m_cameras.size()); }
+
+        /// @brief log per camera latency and frame rate
+        void LogInformation() const override;
+
+    private:
+        DragonVision();
+        ~DragonVision() = default;
+
+        /// @brief Called from the network table listener thread when a camera publishes a new frame
+        void OnFrame
+        (
+            int     cameraIndex
+        );
+
+        /// @brief The network table values of one frame, copied on the listener thread.  They are turned into a
+        ///        DragonVisionTarget on the main loop since the limelight conversions can log.
+        struct RawFrame
+        {
+            int                         cameraIndex;
+            units::time::second_t       timestamp;          ///< FPGA time the frame was captured (latency removed)
+            bool                        hasTarget;
+            units::angle::degree_t      tx;
+            units::angle::degree_t      ty;
+            double                      area;
+            bool                        hasBotPose;
+            frc::Pose2d                 botPose;
+        };
+
+        /// @brief Convert a raw frame into robot relative values
+        DragonVisionTarget ToTarget
+        (
+            const RawFrame&     raw
+        ) const;
+
+        struct CameraStats
+        {
+            int                         frames;             ///< frames received in the current window
+            units::time::second_t       latencySum;         ///< summed latency in the current window
+            units::time::second_t       maxLatency;         ///< worst latency in the current window
+            double                      framesPerSecond;    ///< frame rate from the last complete window
+            units::time::second_t       avgLatency;         ///< average latency from the last complete window
+            units::time::second_t       worstLatency;       ///< worst latency from the last complete window
+        };
+
+        static constexpr int                            m_maxPendingFrames = 64;
+        const units::time::second_t                     m_maxTargetAge = units::time::second_t(0.25);
+        const units::time::second_t                     m_statsWindow = units::time::second_t(1.0);
+
+        std::vector<DragonLimelight*>                   m_cameras;
+        std::vector<NT_Listener>                        m_listeners;
+
+        // shared with the listener thread; guarded by m_mutex
+        std::mutex                                      m_mutex;
+        std::array<RawFrame, m_maxPendingFrames>        m_pending;
+        int                                             m_numPending;
+        int                                             m_droppedFrames;
+        std::vector<CameraStats>                        m_stats;
+
+        // main loop only
+        std::array<RawFrame, m_maxPendingFrames>        m_received;
+        std::vector<DragonVisionTarget>                 m_measurements;
+        DragonVisionTarget                              m_latestTarget;
+        bool                                            m_hasLatestTarget;
+        units::time::second_t                           m_windowStart;
+        std::vector<CameraStats>                        m_reportedStats;
+        int                                             m_reportedDroppedFrames;
+
+        static DragonVision*                            m_instance;
+};
@@ -0,0 +1,40 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Translation2d.h>
+#include <units/angle.h>
+#include <units/length.h>
+#include <units/time.h>
+
+/// @struct DragonVisionTarget
+/// @brief  One camera frame reduced to robot relative values.  Angles use the limelight convention
+///         (positive horizontal angle is to the right of the robot front).
+struct DragonVisionTarget
+{
+    int                     cameraIndex;        ///< index of the camera in DragonVision
+    units::time::second_t   timestamp;          ///< FPGA time the frame was captured (latency removed)
+    bool                    hasTarget;          ///< the camera saw the retro-reflective target
+    units::angle::degree_t  horizontalAngle;    ///< angle from the robot front to the target measured at the robot center
+    units::angle::degree_t  verticalOffset;     ///< vertical offset reported by the camera
+    units::length::inch_t   distance;           ///< floor distance from the robot center to the target
+    double                  area;               ///< percent of the image covered by the target
+    frc::Translation2d      robotToTarget;      ///< target location in robot coordinates
+    bool                    hasBotPose;         ///< the camera solved the robot pose from field targets
+    frc::Pose2d             botPose;            ///< solved robot pose in field coordinates
+};
@@ -0,0 +1,143 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// Entering a motor state only switches the motor controller to the adapter that was prepared when the state
+// was created (see DragonControlToCTREAdapterCache), so moving between states must not create adapters or
+// send configuration calls.  The one exception is a motor with more closed loop controls than the talon has
+// profile slots:  two controls that share a slot reload the PIDF constants when switching between them.
+
+// C++ Includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include "gtest/gtest.h"
+
+// Team 302 includes
+#include <hw/DistanceAngleCalcStruc.h>
+#include <hw/DragonFalcon.h>
+#include <hw/ctreadapters/DragonControlToCTREAdapter.h>
+#include <hw/usages/MotorControllerUsage.h>
+#include <mechanisms/base/Mech1IndMotor.h>
+#include <mechanisms/base/Mech1MotorState.h>
+#include <mechanisms/base/StateMgr.h>
+#include <mechanisms/controllers/ControlData.h>
+#include <mechanisms/controllers/ControlModes.h>
+#include <mechanisms/MechanismTypes.h>
+
+using namespace std;
+
+namespace
+{
+    /// @brief  state manager with one Mech1MotorState per control data on a single falcon; state 0 is the default
+    class AdapterTestStateMgr : public StateMgr
+    {
+        public:
+            AdapterTestStateMgr
+            (
+                int                         canID,
+                const vector<ControlData*>& controls
+            ) : StateMgr(),
+                m_motor(make_shared<DragonFalcon>(string("AdapterTest"), 
+                                                  MotorControllerUsage::MOTOR_CONTROLLER_USAGE::EXAMPLE, 
+                                                  canID, 
+                                                  string(""), 
+                                                  0, 
+                                                  DistanceAngleCalcStruc{2048, 1.0, 1.0, 1.0, 1.0}, 
+                                                  IDragonMotorController::MOTOR_TYPE::FALCON500)),
+                m_mech(MechanismTypes::MECHANISM_TYPE::EXAMPLE, string("adapterTest.xml"), string("AdapterTest"), m_motor),
+                m_states()
+            {
+                for ( unsigned int slot=0; slot<controls.size(); ++slot )
+                {
+                    m_states.emplace_back(make_unique<Mech1MotorState>(&m_mech, string("STATE")+to_string(slot), slot, controls[slot], 1.0));
+                    AddState(&m_mech, slot, m_states.back().get(), nullptr, slot == 0);
+                }
+            }
+
+        private:
+            shared_ptr<IDragonMotorController>      m_motor;
+            Mech1IndMotor                           m_mech;
+            vector<unique_ptr<Mech1MotorState>>     m_states;
+    };
+
+    unique_ptr<ControlData> CreateControl
+    (
+        ControlModes::CONTROL_TYPE  mode,
+        double                      kP
+    )
+    {
+        return make_unique<ControlData>(mode, ControlModes::CONTROL_RUN_LOCS::MOTOR_CONTROLLER, string("control"), 
+                                        kP, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0);
+    }
+}
+
+TEST(ControlAdapterStateTest, TransitionsDontConfigure)
+{
+    auto percent = CreateControl(ControlModes::CONTROL_TYPE::PERCENT_OUTPUT, 0.0);
+    auto position = CreateControl(ControlModes::CONTROL_TYPE::POSITION_DEGREES, 0.5);
+    auto velocity = CreateControl(ControlModes::CONTROL_TYPE::VELOCITY_RPS, 0.1);
+    AdapterTestStateMgr stateMgr(61, {percent.get(), position.get(), velocity.get()});
+
+    auto created = DragonControlToCTREAdapter::GetNumCreated();
+    auto configCalls = DragonControlToCTREAdapter::GetNumConfigCalls();
+    for ( auto inx=0; inx<5; ++inx )
+    {
+        stateMgr.SetCurrentState(1, true);
+        stateMgr.SetCurrentState(0, true);
+        stateMgr.SetCurrentState(2, true);
+        stateMgr.SetCurrentState(1, true);
+        stateMgr.SetCurrentState(0, true);
+    }
+    EXPECT_EQ(stateMgr.GetCurrentState(), 0);
+    EXPECT_EQ(DragonControlToCTREAdapter::GetNumCreated(), created);
+    EXPECT_EQ(DragonControlToCTREAdapter::GetNumConfigCalls(), configCalls);
+}
+
+TEST(ControlAdapterStateTest, SharedProfileSlotReloadsPID)
+{
+    // six closed loop controls on four profile slots:  controls 4 and 5 share slots 0 and 1
+    vector<unique_ptr<ControlData>> controls;
+    vector<ControlData*> controlPtrs;
+    for ( auto inx=0; inx<6; ++inx )
+    {
+        controls.emplace_back(CreateControl(ControlModes::CONTROL_TYPE::POSITION_DEGREES, 0.1*(inx+1)));
+        controlPtrs.emplace_back(controls.back().get());
+    }
+    AdapterTestStateMgr stateMgr(62, controlPtrs);
+
+    auto created = DragonControlToCTREAdapter::GetNumCreated();
+    auto configCalls = DragonControlToCTREAdapter::GetNumConfigCalls();
+
+    // states with their own slot only select the slot
+    stateMgr.SetCurrentState(2, true);
+    stateMgr.SetCurrentState(3, true);
+    stateMgr.SetCurrentState(2, true);
+    EXPECT_EQ(DragonControlToCTREAdapter::GetNumCreated(), created);
+    EXPECT_EQ(DragonControlToCTREAdapter::GetNumConfigCalls(), configCalls);
+
+    // states 0 and 4 share slot 0, so each switch between them sends kP, kI, kD and kF again
+    constexpr int pidConfigCalls = 4;
+    for ( auto inx=0; inx<3; ++inx )
+    {
+        stateMgr.SetCurrentState(4, true);
+        stateMgr.SetCurrentState(0, true);
+    }
+    EXPECT_EQ(DragonControlToCTREAdapter::GetNumCreated(), created);
+    EXPECT_EQ(DragonControlToCTREAdapter::GetNumConfigCalls(), configCalls + 6*pidConfigCalls);
+}
@@ -0,0 +1,109 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+// FRC includes
+#include "gtest/gtest.h"
+
+// Team 302 includes
+#include <utils/DragonDoubleBuffer.h>
+
+namespace
+{
+    // every field holds the same count, so a torn copy has fields that don't match
+    struct Payload
+    {
+        uint64_t    values[8];
+    };
+
+    Payload MakePayload(uint64_t count)
+    {
+        Payload payload;
+        for (auto& value : payload.values)
+        {
+            value = count;
+        }
+        return payload;
+    }
+}
+
+TEST(DragonDoubleBufferTest, ReadsLatestValue)
+{
+    DragonDoubleBuffer<Payload> buffer(MakePayload(0));
+    Payload value = MakePayload(99);
+    EXPECT_TRUE(buffer.Read(value));
+    EXPECT_EQ(value.values[0], 0U);
+
+    for (uint64_t count=1; count<5; ++count)
+    {
+        buffer.Write(MakePayload(count));
+        EXPECT_TRUE(buffer.Read(value));
+        EXPECT_EQ(value.values[7], count);
+        EXPECT_EQ(buffer.GetSequence(), count);
+    }
+}
+
+TEST(DragonDoubleBufferTest, NoTornReadsUnderContention)
+{
+    DragonDoubleBuffer<Payload> buffer(MakePayload(0));
+    std::atomic<bool> done(false);
+
+    // the writer never waits, so the reader is overrun as often as the scheduler allows
+    std::thread writer([&]
+    {
+        uint64_t count = 0;
+        auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+        while (std::chrono::steady_clock::now() < end)
+        {
+            for (auto inx=0; inx<1000; ++inx)
+            {
+                buffer.Write(MakePayload(++count));
+            }
+        }
+        done.store(true);
+    });
+
+    uint64_t reads = 0;
+    uint64_t torn = 0;
+    uint64_t backwards = 0;
+    uint64_t last = 0;
+    while (!done.load())
+    {
+        Payload value;
+        if (buffer.Read(value))
+        {
+            reads++;
+            for (auto field : value.values)
+            {
+                torn += field != value.values[0] ? 1 : 0;
+            }
+            backwards += value.values[0] < last ? 1 : 0;
+            last = value.values[0];
+        }
+    }
+    writer.join();
+
+    RecordProperty("Reads", static_cast<int>(reads));
+    EXPECT_GT(reads, 0U);
+    EXPECT_EQ(torn, 0U);
+    EXPECT_EQ(backwards, 0U);
+}
@@ -0,0 +1,158 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// DragonMotorModel against values worked out by hand from the MotorData table (12 V):
+//      R = 12 / stall current          Kv = free speed (rad/s) / (12 - R * free current)      Kt = stall torque / stall current
+// The volts per newton meter at the output, R / (motors * gear ratio * Kt), simplifies to 12 / (motors * gear ratio * stall torque).
+
+// C++ Includes
+#include <cmath>
+
+// FRC includes
+#include "gtest/gtest.h"
+#include <units/angle.h>
+#include <units/angular_velocity.h>
+#include <units/current.h>
+#include <units/length.h>
+#include <units/mass.h>
+#include <units/moment_of_inertia.h>
+#include <units/voltage.h>
+
+// Team 302 includes
+#include <hw/DragonMotorModel.h>
+
+namespace
+{
+    constexpr double RPM_TO_RADIANS_PER_SECOND = 2.0 * 3.14159265358979323846 / 60.0;
+
+    constexpr DragonMotorModel FALCON(IDragonMotorController::MOTOR_TYPE::FALCON500, 1, 1.0);
+    constexpr DragonMotorModel NEO(IDragonMotorController::MOTOR_TYPE::NEOMOTOR, 1, 1.0);
+
+    // the model is usable at compile time
+    static_assert(FALCON.IsValid() && NEO.IsValid());
+    static_assert(FALCON.GetResistance() > 0.0 && FALCON.GetKv() > 0.0 && FALCON.GetKt() > 0.0);
+    static_assert(!DragonMotorModel(IDragonMotorController::MOTOR_TYPE::NONE, 1, 1.0).IsValid());
+}
+
+TEST(DragonMotorModelTest, Falcon500Constants)
+{
+    auto r = 12.0 / 257.0;
+    EXPECT_NEAR(FALCON.GetResistance(), r, 1e-9);                                       // 0.04669 ohm
+    EXPECT_NEAR(FALCON.GetKv(), 6380.0*RPM_TO_RADIANS_PER_SECOND / (12.0 - r*1.5), 1e-9);  // 56.00 rad/s per volt
+    EXPECT_NEAR(FALCON.GetKv(), 56.003, 1e-3);
+    EXPECT_NEAR(FALCON.GetKt(), 4.69 / 257.0, 1e-12);                                   // 0.01825 Nm per amp
+    EXPECT_NEAR(FALCON.GetKs(), r*1.5, 1e-12);
+}
+
+TEST(DragonMotorModelTest, NeoConstants)
+{
+    auto r = 12.0 / 166.0;
+    EXPECT_NEAR(NEO.GetResistance(), r, 1e-9);                                          // 0.07229 ohm
+    EXPECT_NEAR(NEO.GetKv(), 5880.0*RPM_TO_RADIANS_PER_SECOND / (12.0 - r*1.3), 1e-9);   // 51.72 rad/s per volt
+    EXPECT_NEAR(NEO.GetKv(), 51.718, 1e-3);
+    EXPECT_NEAR(NEO.GetKt(), 3.36 / 166.0, 1e-12);                                      // 0.02024 Nm per amp
+}
+
+TEST(DragonMotorModelTest, InvalidArgumentsDefault)
+{
+    // bad motor counts and gear ratios fall back to 1
+    DragonMotorModel model(IDragonMotorController::MOTOR_TYPE::FALCON500, 0, -2.0);
+    EXPECT_EQ(model.GetNumMotors(), 1);
+    EXPECT_DOUBLE_EQ(model.GetGearRatio(), 1.0);
+
+    // unknown motors have no constants
+    DragonMotorModel none(IDragonMotorController::MOTOR_TYPE::UNKNOWN_MOTOR, 1, 1.0);
+    EXPECT_FALSE(none.IsValid());
+    EXPECT_DOUBLE_EQ(none.Flywheel(units::moment_of_inertia::kilogram_square_meter_t(1.0)).kV, 0.0);
+    EXPECT_DOUBLE_EQ(none.PredictCurrent(units::voltage::volt_t(12.0), units::angular_velocity::radians_per_second_t(0.0)).to<double>(), 0.0);
+}
+
+TEST(DragonMotorModelTest, FlywheelFeedforward)
+{
+    // one falcon geared 1.5:1 (motor turns per wheel turn) spinning 0.01 kg m^2
+    DragonMotorModel model(IDragonMotorController::MOTOR_TYPE::FALCON500, 1, 1.5);
+    auto ff = model.Flywheel(units::moment_of_inertia::kilogram_square_meter_t(0.01));
+    EXPECT_NEAR(ff.kS, 0.07004, 1e-5);                              // 12/257 * 1.5 A
+    EXPECT_NEAR(ff.kV, 1.5 / 56.003, 1e-5);                         // 0.02678 V per rad/s
+    EXPECT_NEAR(ff.kA, 12.0 / (1.5 * 4.69) * 0.01, 1e-9);           // 0.01706 V per rad/s^2
+    EXPECT_DOUBLE_EQ(ff.kG, 0.0);
+}
+
+TEST(DragonMotorModelTest, ElevatorFeedforward)
+{
+    // two neos geared 10:1 lifting 5 kg on a 2 cm drum
+    DragonMotorModel model(IDragonMotorController::MOTOR_TYPE::NEOMOTOR, 2, 10.0);
+    auto ff = model.Elevator(units::mass::kilogram_t(5.0), units::length::meter_t(0.02));
+    auto voltsPerNm = 12.0 / (2 * 10.0 * 3.36);                     // 0.1786
+    EXPECT_NEAR(ff.kV, 10.0 / (51.718 * 0.02), 1e-3);               // 9.668 V per m/s
+    EXPECT_NEAR(ff.kA, voltsPerNm * 5.0 * 0.02, 1e-9);              // 0.01786 V per m/s^2
+    EXPECT_NEAR(ff.kG, voltsPerNm * 5.0 * 9.80665 * 0.02, 1e-9);    // 0.1751 V
+    EXPECT_NEAR(ff.kG, 0.1751, 1e-4);
+
+    // no drum, no feedforward
+    EXPECT_DOUBLE_EQ(model.Elevator(units::mass::kilogram_t(5.0), units::length::meter_t(0.0)).kV, 0.0);
+
+    // the drivetrain is the same without gravity
+    auto drive = model.Drivetrain(units::mass::kilogram_t(5.0), units::length::meter_t(0.02));
+    EXPECT_DOUBLE_EQ(drive.kV, ff.kV);
+    EXPECT_DOUBLE_EQ(drive.kA, ff.kA);
+    EXPECT_DOUBLE_EQ(drive.kG, 0.0);
+}
+
+TEST(DragonMotorModelTest, ArmFeedforward)
+{
+    // one falcon geared 100:1 swinging a 3 kg arm with the center of mass 0.5 m out and 1 kg m^2 about the pivot
+    DragonMotorModel model(IDragonMotorController::MOTOR_TYPE::FALCON500, 1, 100.0);
+    auto ff = model.Arm(units::mass::kilogram_t(3.0), units::length::meter_t(0.5), units::moment_of_inertia::kilogram_square_meter_t(1.0));
+    auto voltsPerNm = 12.0 / (100.0 * 4.69);                        // 0.02559
+    EXPECT_NEAR(ff.kV, 100.0 / 56.003, 1e-4);                       // 1.786 V per rad/s
+    EXPECT_NEAR(ff.kA, voltsPerNm * 1.0, 1e-9);
+    EXPECT_NEAR(ff.kG, voltsPerNm * 3.0 * 9.80665 * 0.5, 1e-9);     // 0.3764 V at horizontal
+    EXPECT_NEAR(ff.kG, 0.3764, 1e-4);
+
+    // gravity is scaled by the cosine of the arm angle
+    EXPECT_NEAR(ff.CalculateArm(units::angle::radian_t(0.0), 0.0, 0.0), ff.kG, 1e-12);
+    EXPECT_NEAR(ff.CalculateArm(units::angle::radian_t(3.14159265358979323846/2.0), 0.0, 0.0), 0.0, 1e-12);
+}
+
+TEST(DragonMotorModelTest, CurrentAtStallAndFreeSpeed)
+{
+    DragonMotorModel model(IDragonMotorController::MOTOR_TYPE::FALCON500, 1, 10.0);
+
+    // stalled at 12 V each motor draws the stall current; at free speed only the free current
+    EXPECT_NEAR(model.PredictCurrent(units::voltage::volt_t(12.0), units::angular_velocity::radians_per_second_t(0.0)).to<double>(), 257.0, 1e-9);
+    auto freeSpeed = units::angular_velocity::radians_per_second_t(6380.0 * RPM_TO_RADIANS_PER_SECOND / 10.0);
+    EXPECT_NEAR(model.PredictCurrent(units::voltage::volt_t(12.0), freeSpeed).to<double>(), 1.5, 1e-9);
+}
+
+TEST(DragonMotorModelTest, CurrentLimitRoundTrip)
+{
+    // the voltage MaxVoltageForCurrent allows draws exactly the limit, at any speed and for either motor
+    for (auto type : {IDragonMotorController::MOTOR_TYPE::FALCON500, IDragonMotorController::MOTOR_TYPE::NEOMOTOR})
+    {
+        DragonMotorModel model(type, 2, 8.14);
+        for (auto speed : {-30.0, 0.0, 10.0, 45.0})
+        {
+            for (auto limit : {0.0, 20.0, 40.0, 80.0})
+            {
+                auto outputSpeed = units::angular_velocity::radians_per_second_t(speed);
+                auto voltage = model.MaxVoltageForCurrent(units::current::ampere_t(limit), outputSpeed);
+                EXPECT_NEAR(model.PredictCurrent(voltage, outputSpeed).to<double>(), limit, 1e-9) << "speed " << speed << " limit " << limit;
+            }
+        }
+    }
+}
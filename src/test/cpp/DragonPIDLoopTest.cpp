@@ -0,0 +1,261 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+// C++ Includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+// FRC includes
+#include "gtest/gtest.h"
+#include <frc/controller/PIDController.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <mechanisms/controllers/ControlData.h>
+#include <mechanisms/controllers/ControlModes.h>
+#include <mechanisms/controllers/DragonPID.h>
+#include <mechanisms/controllers/DragonPIDLoop.h>
+
+namespace
+{
+    constexpr double PERIOD = 0.02;
+    const units::time::second_t LOOP_PERIOD = units::time::second_t(PERIOD);
+
+    struct TestConstGains : DragonPIDConstGains
+    {
+        static constexpr double kP = 0.5;
+        static constexpr double kI = 2.0;
+        static constexpr double kD = 0.01;
+        static constexpr double minOutput = -1.0;
+        static constexpr double maxOutput = 1.0;
+    };
+
+    DragonPIDGains TestGains()
+    {
+        DragonPIDGains gains;
+        gains.kP = TestConstGains::kP;
+        gains.kI = TestConstGains::kI;
+        gains.kD = TestConstGains::kD;
+        gains.minOutput = TestConstGains::minOutput;
+        gains.maxOutput = TestConstGains::maxOutput;
+        return gains;
+    }
+}
+
+TEST(DragonPIDLoopTest, NoIntegralWindupWhileSaturated)
+{
+    DragonPIDGains gains;
+    gains.kP = 1.0;
+    gains.kI = 10.0;
+    gains.minOutput = -1.0;
+    gains.maxOutput = 1.0;
+    DragonPIDState state;
+
+    // the proportional term alone saturates the output, so the integral must not grow
+    for (auto inx=0; inx<100; ++inx)
+    {
+        EXPECT_DOUBLE_EQ(DragonPIDStep(gains, state, 0.0, 10.0, PERIOD), 1.0);
+    }
+    EXPECT_DOUBLE_EQ(state.integral, 0.0);
+
+    // once the error is small the output comes off the limit right away
+    auto output = DragonPIDStep(gains, state, 0.0, 0.5, PERIOD);
+    EXPECT_NEAR(output, 0.5 + 10.0*0.5*PERIOD, 1e-12);
+
+    // saturated the other way
+    state = DragonPIDState{};
+    for (auto inx=0; inx<100; ++inx)
+    {
+        EXPECT_DOUBLE_EQ(DragonPIDStep(gains, state, 0.0, -10.0, PERIOD), -1.0);
+    }
+    EXPECT_DOUBLE_EQ(state.integral, 0.0);
+}
+
+TEST(DragonPIDLoopTest, IntegralUnwindsWhileSaturated)
+{
+    DragonPIDGains gains;
+    gains.kP = 1.0;
+    gains.kI = 10.0;
+    gains.minOutput = -1.0;
+    gains.maxOutput = 1.0;
+    DragonPIDState state;
+    state.integral = 0.9;
+
+    // saturated high, but the error is negative so the integral is allowed to shrink
+    DragonPIDStep(gains, state, 0.2, 0.0, PERIOD);
+    EXPECT_NEAR(state.integral, 0.9 - 10.0*0.2*PERIOD, 1e-12);
+}
+
+TEST(DragonPIDLoopTest, IZoneResetsIntegral)
+{
+    DragonPIDGains gains;
+    gains.kI = 1.0;
+    gains.iZone = 2.0;
+    DragonPIDState state;
+
+    for (auto inx=0; inx<10; ++inx)
+    {
+        DragonPIDStep(gains, state, 0.0, 1.0, PERIOD);
+    }
+    EXPECT_NEAR(state.integral, 10*1.0*PERIOD, 1e-12);
+
+    // outside the zone the integral is cleared, not just held
+    EXPECT_DOUBLE_EQ(DragonPIDStep(gains, state, 0.0, 2.0, PERIOD), 0.0);
+    EXPECT_DOUBLE_EQ(state.integral, 0.0);
+
+    // and starts again from zero back inside the zone
+    DragonPIDStep(gains, state, 0.0, 1.0, PERIOD);
+    EXPECT_NEAR(state.integral, PERIOD, 1e-12);
+}
+
+TEST(DragonPIDLoopTest, OutputAndIntegralClamped)
+{
+    DragonPIDGains gains;
+    gains.kP = 100.0;
+    gains.minOutput = -0.5;
+    gains.maxOutput = 0.8;
+    DragonPIDState state;
+
+    EXPECT_DOUBLE_EQ(DragonPIDStep(gains, state, 0.0, 1.0, PERIOD), 0.8);
+    EXPECT_DOUBLE_EQ(DragonPIDStep(gains, state, 0.0, -1.0, PERIOD), -0.5);
+    EXPECT_NEAR(DragonPIDStep(gains, state, 0.0, 0.001, PERIOD), 0.1, 1e-12);
+
+    gains = DragonPIDGains{};
+    gains.kI = 10.0;
+    gains.iLimit = 0.3;
+    state = DragonPIDState{};
+    for (auto inx=0; inx<100; ++inx)
+    {
+        DragonPIDStep(gains, state, 0.0, 1.0, PERIOD);
+    }
+    EXPECT_DOUBLE_EQ(state.integral, 0.3);
+}
+
+TEST(DragonPIDLoopTest, NoDerivativeKick)
+{
+    DragonPIDGains gains;
+    gains.kP = 1.0;
+    gains.kD = 1.0;
+    DragonPIDState state;
+
+    // first step:  there is no previous measurement, so no derivative no matter how far the measurement is from 0
+    EXPECT_DOUBLE_EQ(DragonPIDStep(gains, state, 10.0, 12.0, PERIOD), 2.0);
+
+    // a setpoint change doesn't kick either (derivative on measurement)
+    EXPECT_DOUBLE_EQ(DragonPIDStep(gains, state, 10.0, 20.0, PERIOD), 10.0);
+
+    // a measurement change does
+    EXPECT_NEAR(DragonPIDStep(gains, state, 10.1, 20.0, PERIOD), 9.9 - 0.1/PERIOD, 1e-9);
+
+    // and after a Reset the first step has no derivative again
+    DragonPIDLoop<> loop(LOOP_PERIOD, gains);
+    loop.Calculate(0.0, 0.0);
+    loop.Reset();
+    EXPECT_DOUBLE_EQ(loop.Calculate(5.0, 5.0), 0.0);
+}
+
+TEST(DragonPIDLoopTest, MeasuredPeriodFallback)
+{
+    DragonPIDGains gains;
+    gains.kI = 1.0;
+    DragonPIDLoop<> loop(LOOP_PERIOD, gains);
+
+    // unusable periods fall back to the fixed period:  zero, negative, 5 periods or more
+    auto expected = 0.0;
+    for (auto dt : {0.0, -0.01, 5.0*PERIOD, 10.0})
+    {
+        loop.Calculate(0.0, 1.0, units::time::second_t(dt));
+        expected += PERIOD;
+        EXPECT_NEAR(loop.GetState().integral, expected, 1e-12) << "dt " << dt;
+    }
+
+    // usable periods are used as measured
+    for (auto dt : {0.005, 0.05, 4.9*PERIOD})
+    {
+        loop.Calculate(0.0, 1.0, units::time::second_t(dt));
+        expected += dt;
+        EXPECT_NEAR(loop.GetState().integral, expected, 1e-12) << "dt " << dt;
+    }
+}
+
+TEST(DragonPIDLoopTest, ConstGainsMatchRuntimeGains)
+{
+    // the compile time gains take no space in the loop and give the same outputs as the same run time gains
+    static_assert(std::is_empty_v<TestConstGains>);
+    static_assert(sizeof(DragonPIDLoop<TestConstGains>) < sizeof(DragonPIDLoop<DragonPIDGains>));
+
+    DragonPIDLoop<TestConstGains> constLoop(LOOP_PERIOD);
+    DragonPIDLoop<> loop(LOOP_PERIOD, TestGains());
+
+    auto measurement = 0.0;
+    for (auto inx=0; inx<500; ++inx)
+    {
+        auto setpoint = inx < 250 ? 3.0 : -1.0;
+        auto constOutput = constLoop.Calculate(measurement, setpoint);
+        EXPECT_DOUBLE_EQ(constOutput, loop.Calculate(measurement, setpoint));
+        measurement += constOutput * PERIOD * 5.0;
+    }
+    EXPECT_DOUBLE_EQ(constLoop.GetState().integral, loop.GetState().integral);
+}
+
+TEST(DragonPIDLoopTest, TimingComparison)
+{
+    constexpr int steps = 1000000;
+    volatile double measurement = 0.3;
+    volatile double setpoint = 1.0;
+
+    // best of a few runs so the first one doesn't pay for warming up the cache
+    auto time = [&](auto&& step)
+    {
+        auto best = std::numeric_limits<double>::infinity();
+        for (auto run=0; run<3; ++run)
+        {
+            auto sum = 0.0;
+            auto start = std::chrono::steady_clock::now();
+            for (auto inx=0; inx<steps; ++inx)
+            {
+                sum += step(measurement, setpoint);
+            }
+            auto end = std::chrono::steady_clock::now();
+            EXPECT_TRUE(std::isfinite(sum));
+            best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count() / steps);
+        }
+        return best;
+    };
+
+    DragonPIDLoop<TestConstGains> constLoop(LOOP_PERIOD);
+    DragonPIDLoop<> loop(LOOP_PERIOD, TestGains());
+    ControlData controlData(ControlModes::CONTROL_TYPE::POSITION_INCH, ControlModes::CONTROL_RUN_LOCS::ROBORIO, "timing", 
+                            TestConstGains::kP, TestConstGains::kI, TestConstGains::kD, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0);
+    DragonPID dragonPID(&controlData, LOOP_PERIOD);
+    frc2::PIDController wpiPID(TestConstGains::kP, TestConstGains::kI, TestConstGains::kD, LOOP_PERIOD);
+    wpiPID.SetIntegratorRange(-1.0, 1.0);
+
+    auto constTime = time([&](double m, double s) { return constLoop.Calculate(m, s); });
+    auto loopTime = time([&](double m, double s) { return loop.Calculate(m, s); });
+    auto dragonTime = time([&](double m, double s) { return dragonPID.Calculate(0.0, m, s); });
+    auto wpiTime = time([&](double m, double s) { return wpiPID.Calculate(m, s); });
+
+    // nanoseconds per step; written to the test report (--gtest_output=xml)
+    RecordProperty("ConstGainsNs", static_cast<int>(constTime));
+    RecordProperty("RuntimeGainsNs", static_cast<int>(loopTime));
+    RecordProperty("DragonPIDNs", static_cast<int>(dragonTime));
+    RecordProperty("WPIPIDControllerNs", static_cast<int>(wpiTime));
+}